@@ -19,6 +19,17 @@ VALUES_PER_LINE = 10                          # For readability in the output fi
 IMAGENET_MEAN = np.array([0.485, 0.456, 0.406], dtype=np.float32)
 IMAGENET_STD = np.array([0.229, 0.224, 0.225], dtype=np.float32)
 
+# Usage: python generate_input_image.py [--raw IMAGE OUTPUT]
+# --raw writes IMAGE preprocessed the same way to OUTPUT as raw float32 (C, H, W)
+# instead of the header, e.g. to fill a directory for squeezenet_calibrate_directory()
+RAW_FILENAME = None
+if len(sys.argv) == 4 and sys.argv[1] == "--raw":
+    INPUT_FILENAME, RAW_FILENAME = sys.argv[2], sys.argv[3]
+    OUTPUT_FILENAME = RAW_FILENAME
+elif len(sys.argv) != 1:
+    print("Usage: python generate_input_image.py [--raw IMAGE OUTPUT]")
+    sys.exit(1)
+
 # --- Main Conversion Logic ---
 print(f"Converting '{INPUT_FILENAME}' to '{OUTPUT_FILENAME}'...")
 
@@ -72,6 +83,12 @@ if flattened_data.size != EXPECTED_SIZE:
     print(f"ERROR: Flattened data size ({flattened_data.size}) does not match expected size ({EXPECTED_SIZE}).")
     sys.exit(1)
 
+# Raw mode: just the float32 values
+if RAW_FILENAME:
+    flattened_data.astype(np.float32).tofile(RAW_FILENAME)
+    print(f"{RAW_FILENAME} generated successfully from {INPUT_FILENAME}.")
+    sys.exit(0)
+
 # 10. Write the output file (input_image.h)
 print(f"Writing data to {OUTPUT_FILENAME}...")
 try:
@@ -14,14 +14,14 @@ import sys
 CPP_NUM_CLASSES = 10 # Example: Set to 10 if using CIFAR-10 size output
 
 # Output file path relative to this script's location
-OUTPUT_FILENAME = "../squeezenet_weights.h"
+OUTPUT_FILENAME = "../squeezenet_weights.cpp" # Definitions; squeezenet_weights.h declares them
 VALUES_PER_LINE = 10 # For readability in the output file
 
 # --- Helper function to write a tensor to the C++ file ---
 def write_cpp_array(f, cpp_var_name, tensor, values_per_line=10):
-    """Writes a PyTorch tensor into a C++ static const float array."""
+    """Writes a PyTorch tensor into a C++ float array definition (const in HLS)."""
     f.write(f"// Shape: {list(tensor.shape)}\n")
-    f.write(f"static const float {cpp_var_name}[{tensor.numel()}] = {{\n")
+    f.write(f"WEIGHTS_CONST float {cpp_var_name}[{tensor.numel()}] = {{\n")
 
     # Flatten the tensor and iterate through its values
     flat_tensor = tensor.detach().cpu().view(-1) # Flatten
@@ -86,9 +86,7 @@ print(f"Extracting weights and writing to {os.path.basename(output_path)}...")
 try:
     with open(output_path, "w") as f:
         # --- Header ---
-        f.write("#ifndef SQUEEZENET_WEIGHTS_H\n")
-        f.write("#define SQUEEZENET_WEIGHTS_H\n\n")
-        f.write('#include "squeezenet_params.h"\n\n')
+        f.write('#include "squeezenet_weights.h"\n\n')
         f.write("// ==========================================================================\n")
         f.write("// === SqueezeNet 1.1 Weights and Biases ====================================\n")
         f.write("// ==========================================================================\n")
@@ -175,8 +173,6 @@ try:
              print(f"  Writing {cpp_name} (Shape: {list(tensor.shape)} -> {tensor.numel()})")
              write_cpp_array(f, cpp_name, tensor, VALUES_PER_LINE)
 
-        # --- Footer ---
-        f.write("\n#endif // SQUEEZENET_WEIGHTS_H\n")
 
 except IOError as e:
     print(f"\nERROR: Could not write to file '{output_path}': {e}")
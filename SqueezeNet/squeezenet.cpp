@@ -1,5 +1,15 @@
 #include "squeezenet.h"
-#include <cfloat> // For FLT_MIN
+#include "squeezenet_arena.h"
+#include "squeezenet_batch.h"
+#include "squeezenet_calibration.h"
+#include "squeezenet_fixed.h"
+#include "squeezenet_gemm.h"
+#include "squeezenet_nchwc.h"
+#include "squeezenet_quant.h"
+#include "squeezenet_simd.h"
+#include "squeezenet_threads.h"
+#include "squeezenet_typed.h"
+#include "squeezenet_winograd.h"
 
 //--------------------------------------------------------------------------
 // Convolution Layer Implementation
@@ -16,45 +26,28 @@ void convolution(
     int PadH, int PadW,          // Padding in H, W
     bool apply_relu              // Flag to apply ReLU activation
 ) {
-    // Output Feature Map (OFM) Loops
-    OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
-        OUT_H_LOOP: for (int oh = 0; oh < OutH; ++oh) {
-            OUT_W_LOOP: for (int ow = 0; ow < OutW; ++ow) {
-#pragma HLS PIPELINE II=1 // Suggest pipelining the innermost loops calculation
-
-                float sum = biases[oc]; // Initialize with bias
-
-                // Kernel Loops
-                IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
-                    KERNEL_H_LOOP: for (int kh = 0; kh < KH; ++kh) {
-                        KERNEL_W_LOOP: for (int kw = 0; kw < KW; ++kw) {
-#pragma HLS UNROLL factor=2 // Example: Unroll the innermost loop slightly if resources allow
-
-                            int ih = oh * StrideH + kh - PadH;
-                            int iw = ow * StrideW + kw - PadW;
-
-                            // Check bounds (for padding)
-                            if (ih >= 0 && ih < InH && iw >= 0 && iw < InW) {
-                                // Input index: Channel * H * W + Row * W + Col
-                                int input_idx = ic * InH * InW + ih * InW + iw;
-                                // Weight index: OutC * InC*KH*KW + InC * KH*KW + KernelH * KW + KernelW
-                                int weight_idx = oc * (InC * KH * KW) + ic * (KH * KW) + kh * KW + kw;
-                                sum += input[input_idx] * weights[weight_idx];
-                            }
-                            // If padding: implicitly multiply by 0, so do nothing
-                        }
-                    }
-                }
-
-                // Apply ReLU if requested
-                float result = apply_relu ? relu_activation(sum) : sum;
-
-                // Output index: Channel * H * W + Row * W + Col
-                int output_idx = oc * OutH * OutW + oh * OutW + ow;
-                output[output_idx] = result;
-            }
-        }
+#ifndef __SYNTHESIS__
+    // Host builds: 1x1 layers go to the pointwise engine, other large layers
+    // to the im2col + blocked SGEMM backend
+    ConvBackend backend = conv_select_backend(InC, OutH, OutW, OutC, KH, KW,
+                                              StrideH, StrideW, PadH, PadW);
+    if (backend == CONV_BACKEND_POINTWISE) {
+        pointwise_convolution(input, weights, biases, output,
+                              OutH * OutW, InC, OutC, apply_relu);
+        return;
+    }
+    if (backend == CONV_BACKEND_GEMM) {
+        convolution_gemm(input, weights, biases, output,
+                         InH, InW, InC, OutH, OutW, OutC,
+                         KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
+        return;
     }
+#endif
+
+    // Direct loop nest (squeezenet_typed.h)
+    convolution<float, float>(input, weights, biases, output,
+                              InH, InW, InC, OutH, OutW, OutC,
+                              KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
 }
 
 
@@ -69,39 +62,66 @@ void max_pooling(
     int KH, int KW,              // Pooling kernel dimensions H, W
     int StrideH, int StrideW     // Stride in H, W
 ) {
-    POOL_C_LOOP: for (int c = 0; c < InC; ++c) {
-        POOL_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
-            POOL_OW_LOOP: for (int ow = 0; ow < OutW; ++ow) {
-#pragma HLS PIPELINE II=1
-
-                float max_val = -FLT_MAX; // Initialize with a very small number
-
-                POOL_KH_LOOP: for (int kh = 0; kh < KH; ++kh) {
-                    POOL_KW_LOOP: for (int kw = 0; kw < KW; ++kw) {
-#pragma HLS UNROLL factor=2 // Example
-
-                        int ih = oh * StrideH + kh;
-                        int iw = ow * StrideW + kw;
-
-                        // Check bounds (no padding in typical max pool)
-                        if (ih < InH && iw < InW) {
-                            int input_idx = c * InH * InW + ih * InW + iw;
-                            if (input[input_idx] > max_val) {
-                                max_val = input[input_idx];
-                            }
-                        }
-                    }
-                }
-                int output_idx = c * OutH * OutW + oh * OutW + ow;
-                output[output_idx] = max_val;
-            }
-        }
+#ifndef __SYNTHESIS__
+    // Host builds: vectorized row-max kernel when AVX2/AVX-512 is available
+    if (simd_kernels().level != SIMD_SCALAR && InW <= SIMD_MAX_ROW_WIDTH) {
+        max_pooling_simd(input, output, InH, InW, InC, OutH, OutW,
+                         KH, KW, StrideH, StrideW);
+        return;
     }
+#endif
+
+    max_pooling<float>(input, output, InH, InW, InC, OutH, OutW,
+                       KH, KW, StrideH, StrideW);
 }
 
 //--------------------------------------------------------------------------
 // Fire Module Implementation
 //--------------------------------------------------------------------------
+// Expand Convolution (1x1) + ReLU
+static void fire_expand1x1(
+    const float squeeze_buf[], float output[],
+    int InH, int InW, int SqueezeC, int OutH, int OutW,
+    const float weights[], const float biases[], int Expand1x1C)
+{
+    convolution(
+        squeeze_buf, weights, biases, output,
+        InH, InW, SqueezeC,     // Input Dims (from squeeze)
+        OutH, OutW, Expand1x1C, // Output Dims (OutH/W should match InH/W)
+        1, 1,                   // Kernel Dims
+        1, 1,                   // Stride
+        0, 0,                   // Padding
+        true                    // Apply ReLU
+    );
+}
+
+// Expand Convolution (3x3 with padding=1) + ReLU
+static void fire_expand3x3(
+    const float squeeze_buf[], float output[],
+    int InH, int InW, int SqueezeC, int OutH, int OutW,
+    const float weights[], const float biases[], int Expand3x3C)
+{
+    bool done = false;
+#ifndef __SYNTHESIS__
+    // Host builds: Winograd F(4x4,3x3); falls back to convolution() if the
+    // layer failed its tolerance check
+    done = winograd_conv3x3(
+        squeeze_buf, weights, biases, output,
+        OutH, OutW, SqueezeC, Expand3x3C, true);
+#endif
+    if (!done) {
+        convolution(
+            squeeze_buf, weights, biases, output,
+            InH, InW, SqueezeC,     // Input Dims (from squeeze)
+            OutH, OutW, Expand3x3C, // Output Dims (Pad=1, Stride=1 keeps H,W same)
+            3, 3,                   // Kernel Dims
+            1, 1,                   // Stride
+            1, 1,                   // Padding = 1 for 'same' with 3x3 kernel
+            true                    // Apply ReLU
+        );
+    }
+}
+
 void fire_module(
     const float input[],              // Input feature map (flattened)
     float output[],                   // Output feature map (flattened)
@@ -121,10 +141,12 @@ void fire_module(
     const float expand3x3_biases[],
     int Expand3x3C,
 	// --- Internal Buffers ---
-	float squeeze_buf[],			   // Temp buffer for squeeze output (Size: InH * InW * SqueezeC)
-	float expand1x1_buf[],             // Temp buffer for expand 1x1 output (Size: OutH * OutW * Expand1x1C)
-	float expand3x3_buf[]              // Temp buffer for expand 3x3 output (Size: OutH * OutW * Expand3x3C)
+	float squeeze_buf[]			       // Temp buffer for squeeze output (Size: InH * InW * SqueezeC)
 ) {
+    // Channel slices of the CHW output: concatenation by construction
+    float* expand1x1_out = output;
+    float* expand3x3_out = output + Expand1x1C * OutH * OutW;
+
     // 1. Squeeze Convolution (1x1) + ReLU
     convolution(
         input, squeeze_weights, squeeze_biases, squeeze_buf,
@@ -136,39 +158,205 @@ void fire_module(
         true                    // Apply ReLU
     );
 
-    // 2. Expand Convolution (1x1) + ReLU
-    convolution(
-        squeeze_buf, expand1x1_weights, expand1x1_biases, expand1x1_buf,
-        InH, InW, SqueezeC,     // Input Dims (from squeeze)
-        OutH, OutW, Expand1x1C, // Output Dims (OutH/W should match InH/W)
-        1, 1,                   // Kernel Dims
-        1, 1,                   // Stride
-        0, 0,                   // Padding
-        true                    // Apply ReLU
-    );
+    // 2./3. Expand 1x1 and 3x3 + ReLU: independent branches that only read
+    // squeeze_buf. Host builds run them concurrently.
+#ifndef __SYNTHESIS__
+    parallel_branches((double)OutH * OutW * SqueezeC * (Expand1x1C + 9 * Expand3x3C), {
+        [&] { fire_expand1x1(squeeze_buf, expand1x1_out, InH, InW, SqueezeC, OutH, OutW,
+                             expand1x1_weights, expand1x1_biases, Expand1x1C); },
+        [&] { fire_expand3x3(squeeze_buf, expand3x3_out, InH, InW, SqueezeC, OutH, OutW,
+                             expand3x3_weights, expand3x3_biases, Expand3x3C); }
+    });
+#else
+    fire_expand1x1(squeeze_buf, expand1x1_out, InH, InW, SqueezeC, OutH, OutW,
+                   expand1x1_weights, expand1x1_biases, Expand1x1C);
+    fire_expand3x3(squeeze_buf, expand3x3_out, InH, InW, SqueezeC, OutH, OutW,
+                   expand3x3_weights, expand3x3_biases, Expand3x3C);
+#endif
+}
 
-    // 3. Expand Convolution (3x3 with padding=1) + ReLU
-    convolution(
-        squeeze_buf, expand3x3_weights, expand3x3_biases, expand3x3_buf,
-        InH, InW, SqueezeC,     // Input Dims (from squeeze)
-        OutH, OutW, Expand3x3C, // Output Dims (Pad=1, Stride=1 keeps H,W same)
-        3, 3,                   // Kernel Dims
-        1, 1,                   // Stride
-        1, 1,                   // Padding = 1 for 'same' with 3x3 kernel
-        true                    // Apply ReLU
-    );
+//--------------------------------------------------------------------------
+// Tile-Fused Fire Module Implementation
+//--------------------------------------------------------------------------
+// Fire output rows [r0, r1) of an H x W map, written to `output` with row 0
+// = image row r0 and channels out_hw floats apart. For each sub-band
+// [b0, b1), band_buf holds squeeze rows b0-1 .. b1: band row b is image row
+// b0 - 1 + b, channel stride (FIRE_TILE_ROWS + 2) * W. Rows above/below the
+// image are stored as zeros, so they double as the 3x3 expand's vertical
+// padding and only its first/last column needs checks.
+static void fire_rows(
+    const float input[], int H, int W, int InC,
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    int r0, int r1, float output[], int out_hw, float band_buf[])
+{
+    const int band_h = FIRE_TILE_ROWS + 2;
+    const int band_hw = band_h * W;
+    const int ow_lo = window_interior_begin(W, 1, 1);
+    const int ow_hi = window_interior_end(W, W, 3, 1, 1);
+    float* expand3x3_out = output + Expand1x1C * out_hw; // Concatenation is free
+
+    FIRE_BAND_LOOP: for (int b0 = r0; b0 < r1; b0 += FIRE_TILE_ROWS) {
+        int b1 = (b0 + FIRE_TILE_ROWS < r1) ? b0 + FIRE_TILE_ROWS : r1;
+
+        // 1. Squeeze (1x1) + ReLU for the band and its halo rows
+        BAND_SQUEEZE_C_LOOP: for (int sc = 0; sc < SqueezeC; ++sc) {
+            BAND_SQUEEZE_H_LOOP: for (int b = 0; b < b1 - b0 + 2; ++b) {
+                int h = b0 - 1 + b;
+                bool in_image = (h >= 0 && h < H);
+                float* band_row = band_buf + sc * band_hw + b * W;
+                BAND_SQUEEZE_W_LOOP: for (int w = 0; w < W; ++w) {
+#pragma HLS PIPELINE II=1
+                    band_row[w] = in_image ?
+                        conv_pixel<false>(input, squeeze_weights, squeeze_biases[sc],
+                                          H, W, InC, 1, 1, sc, h, w, true) : 0.0f;
+                }
+            }
+        }
+
+        // 2. Expand 1x1 + ReLU into output channels [0, Expand1x1C)
+        BAND_EXPAND1x1_C_LOOP: for (int oc = 0; oc < Expand1x1C; ++oc) {
+            BAND_EXPAND1x1_H_LOOP: for (int h = b0; h < b1; ++h) {
+                float* out_row = output + oc * out_hw + (h - r0) * W;
+                BAND_EXPAND1x1_W_LOOP: for (int w = 0; w < W; ++w) {
+#pragma HLS PIPELINE II=1
+                    out_row[w] = conv_pixel<false>(band_buf, expand1x1_weights, expand1x1_biases[oc],
+                                                   band_h, W, SqueezeC, 1, 1, oc, h - b0 + 1, w, true);
+                }
+            }
+        }
 
-    // 4. Concatenate expand1x1_buf and expand3x3_buf into output
-    int expand1x1_size = OutH * OutW * Expand1x1C;
-    int expand3x3_size = OutH * OutW * Expand3x3C;
+        // 3. Expand 3x3 (pad 1) + ReLU into output channels [Expand1x1C, OutC)
+        BAND_EXPAND3x3_C_LOOP: for (int oc = 0; oc < Expand3x3C; ++oc) {
+            BAND_EXPAND3x3_H_LOOP: for (int h = b0; h < b1; ++h) {
+                float* out_row = expand3x3_out + oc * out_hw + (h - r0) * W;
+                int ih0 = h - b0; // Band row of the top tap
+                BAND_EXPAND3x3_BORDER_L_LOOP: for (int w = 0; w < ow_lo; ++w) {
+#pragma HLS PIPELINE II=1
+                    out_row[w] = conv_pixel<true>(band_buf, expand3x3_weights, expand3x3_biases[oc],
+                                                  band_h, W, SqueezeC, 3, 3, oc, ih0, w - 1, true);
+                }
+                BAND_EXPAND3x3_INTERIOR_LOOP: for (int w = ow_lo; w < ow_hi; ++w) {
+#pragma HLS PIPELINE II=1
+                    out_row[w] = conv_pixel<false>(band_buf, expand3x3_weights, expand3x3_biases[oc],
+                                                   band_h, W, SqueezeC, 3, 3, oc, ih0, w - 1, true);
+                }
+                BAND_EXPAND3x3_BORDER_R_LOOP: for (int w = ow_hi; w < W; ++w) {
+#pragma HLS PIPELINE II=1
+                    out_row[w] = conv_pixel<true>(band_buf, expand3x3_weights, expand3x3_biases[oc],
+                                                  band_h, W, SqueezeC, 3, 3, oc, ih0, w - 1, true);
+                }
+            }
+        }
+    }
+}
+
+void fire_module_rows(
+    const float input[], float output[],
+    int H, int W, int InC,
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    float band_buf[])
+{
+    fire_rows(input, H, W, InC,
+              squeeze_weights, squeeze_biases, SqueezeC,
+              expand1x1_weights, expand1x1_biases, Expand1x1C,
+              expand3x3_weights, expand3x3_biases, Expand3x3C,
+              0, H, output, H * W, band_buf);
+}
+
+
+//--------------------------------------------------------------------------
+// Fused Producer + Max Pooling Implementation
+//--------------------------------------------------------------------------
+void max_pool_band(
+    const float band[], int rows, int W, int C, int band_hw,
+    float output[], int OutH, int OutW, int p0, int p1, int K, int S)
+{
+#ifndef __SYNTHESIS__
+    // Host builds: vectorized kernel, one channel plane of the band at a time
+    if (simd_kernels().level != SIMD_SCALAR && W <= SIMD_MAX_ROW_WIDTH) {
+        for (int c = 0; c < C; ++c) {
+            max_pooling_simd(band + c * band_hw, output + c * OutH * OutW + p0 * OutW,
+                             rows, W, 1, p1 - p0, OutW, K, K, S, S);
+        }
+        return;
+    }
+#endif
+
+    if (K == 3 && S == 2 && OutW <= POOL_MAX_W_OUT) {
+        POOL_BAND3S2_C_LOOP: for (int c = 0; c < C; ++c) {
+            max_pool_3x3s2(band + c * band_hw, rows, W,
+                           output + c * OutH * OutW + p0 * OutW, p1 - p0, OutW);
+        }
+        return;
+    }
 
-    CONCAT_1x1: for(int i = 0; i < expand1x1_size; ++i) {
+    // No padding, so only the last rows/cols can have clipped windows
+    const int ow_hi = window_interior_end(W, OutW, K, S, 0);
+
+    POOL_BAND_C_LOOP: for (int c = 0; c < C; ++c) {
+        const float* in_c = band + c * band_hw;
+        POOL_BAND_OH_LOOP: for (int oh = p0; oh < p1; ++oh) {
+            int ih0 = (oh - p0) * S; // Band row of the top tap
+            int w_hi = (ih0 + K <= rows) ? ow_hi : 0;
+            float* out_row = output + c * OutH * OutW + oh * OutW;
+
+            POOL_BAND_OW_INTERIOR_LOOP: for (int ow = 0; ow < w_hi; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = pool_pixel<false>(in_c, rows, W, K, K, ih0, ow * S);
+            }
+            POOL_BAND_OW_BORDER_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
 #pragma HLS PIPELINE II=1
-        output[i] = expand1x1_buf[i];
+                out_row[ow] = pool_pixel<true>(in_c, rows, W, K, K, ih0, ow * S);
+            }
+        }
     }
-    CONCAT_3x3: for(int i = 0; i < expand3x3_size; ++i) {
+}
+
+void pool_band_carry(float band[], int C, int band_hw, int W, int src_row, int rows) {
+    CARRY_C_LOOP: for (int c = 0; c < C; ++c) {
+        CARRY_ROW_LOOP: for (int i = 0; i < rows * W; ++i) {
 #pragma HLS PIPELINE II=1
-        output[expand1x1_size + i] = expand3x3_buf[i];
+            band[c * band_hw + i] = band[c * band_hw + src_row * W + i];
+        }
+    }
+}
+
+void fire_module_pool_rows(
+    const float input[], float output[],
+    int H, int W, int InC,
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    int PoolK, int PoolS, int PoolH, int PoolW,
+    float squeeze_band[], float pool_band[])
+{
+    const int OutC = Expand1x1C + Expand3x3C;
+    const int band_hw = POOL_BAND_ROWS * W;
+    const int carry = PoolK - PoolS; // Fire rows shared by neighbouring pool bands
+    int prev_rows = 0;
+
+    FIRE_POOL_BAND_LOOP: for (int p0 = 0; p0 < PoolH; p0 += POOL_TILE_ROWS) {
+        int p1 = (p0 + POOL_TILE_ROWS < PoolH) ? p0 + POOL_TILE_ROWS : PoolH;
+        int first = p0 * PoolS;                       // Fire row in band row 0
+        int last = (p1 - 1) * PoolS + PoolK;
+        int rows = ((last < H) ? last : H) - first;
+        int kept = (p0 > 0) ? carry : 0;
+
+        // Reuse the rows the previous band already computed, then fill the rest
+        if (kept > 0) {
+            pool_band_carry(pool_band, OutC, band_hw, W, prev_rows - kept, kept);
+        }
+        fire_rows(input, H, W, InC,
+                  squeeze_weights, squeeze_biases, SqueezeC,
+                  expand1x1_weights, expand1x1_biases, Expand1x1C,
+                  expand3x3_weights, expand3x3_biases, Expand3x3C,
+                  first + kept, first + rows, pool_band + kept * W, band_hw, squeeze_band);
+        max_pool_band(pool_band, rows, W, OutC, band_hw, output, PoolH, PoolW, p0, p1, PoolK, PoolS);
+        prev_rows = rows;
     }
 }
 
@@ -181,22 +369,76 @@ void global_average_pooling(
     float output[],             // Output vector (size: InC)
     int InH, int InW, int InC  // Input dimensions H, W, C
 ) {
-    GAP_C_LOOP: for (int c = 0; c < InC; ++c) {
-#pragma HLS PIPELINE II=1 // Pipeline channel processing
-
-        float sum = 0.0f;
-        GAP_H_LOOP: for (int h = 0; h < InH; ++h) {
-            GAP_W_LOOP: for (int w = 0; w < InW; ++w) {
-                // Inner loops might be automatically unrolled by HLS
-                int input_idx = c * InH * InW + h * InW + w;
-                sum += input[input_idx];
-            }
-        }
-        output[c] = sum / (float)(InH * InW);
+#ifndef __SYNTHESIS__
+    if (simd_kernels().level != SIMD_SCALAR) {
+        global_average_pooling_simd(input, output, InH, InW, InC);
+        return;
     }
+#endif
+
+    global_average_pooling<float, float>(input, output, InH, InW, InC);
 }
 
 
+//--------------------------------------------------------------------------
+// Network Steps (CHW)
+//--------------------------------------------------------------------------
+// Conv1 + ReLU + MaxPool1 (fused: conv1 rows are pooled band by band)
+void squeezenet_step_conv1(float arena[], const float input[], float output[]) {
+#pragma HLS INLINE
+    convolution_pool_fixed<INPUT_H, INPUT_W, INPUT_C, CONV1_C_OUT, CONV1_KH, CONV1_S, CONV1_P,
+                           POOL1_K, POOL1_S>(
+        input, conv1_weights, conv1_biases, output,
+        squeezenet_tensor(arena, ARENA_CONV1), true);
+}
+
+// Fire n on an InH x InW map
+#define SQUEEZENET_FIRE_STEP(n, InH, InW) \
+    void squeezenet_step_fire##n(float arena[], const float input[], float output[]) { \
+        _Pragma("HLS INLINE") \
+        fire_module_fixed<InH, InW, FIRE##n##_C_IN, FIRE##n##_S1x1, FIRE##n##_E1x1, FIRE##n##_E3x3>( \
+            input, output, \
+            fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, \
+            fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, \
+            fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, \
+            squeezenet_tensor(arena, ARENA_SQUEEZE##n)); \
+    }
+
+// Fire n + MaxPool (fused; the fire band lives in arena tensor Band)
+#define SQUEEZENET_FIRE_POOL_STEP(n, InH, InW, PoolK, PoolS, Band) \
+    void squeezenet_step_fire##n(float arena[], const float input[], float output[]) { \
+        _Pragma("HLS INLINE") \
+        fire_module_pool_fixed<InH, InW, FIRE##n##_C_IN, FIRE##n##_S1x1, FIRE##n##_E1x1, FIRE##n##_E3x3, \
+                               PoolK, PoolS>( \
+            input, output, \
+            fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, \
+            fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, \
+            fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, \
+            squeezenet_tensor(arena, ARENA_SQUEEZE##n), squeezenet_tensor(arena, Band)); \
+    }
+
+SQUEEZENET_FIRE_STEP(2, POOL1_H_OUT, POOL1_W_OUT)
+SQUEEZENET_FIRE_STEP(3, FIRE2_H_OUT, FIRE2_W_OUT)
+SQUEEZENET_FIRE_POOL_STEP(4, FIRE3_H_OUT, FIRE3_W_OUT, POOL4_K, POOL4_S, ARENA_FIRE4)
+SQUEEZENET_FIRE_STEP(5, POOL4_H_OUT, POOL4_W_OUT)
+SQUEEZENET_FIRE_STEP(6, FIRE5_H_OUT, FIRE5_W_OUT)
+SQUEEZENET_FIRE_STEP(7, FIRE6_H_OUT, FIRE6_W_OUT)
+SQUEEZENET_FIRE_POOL_STEP(8, FIRE7_H_OUT, FIRE7_W_OUT, POOL8_K, POOL8_S, ARENA_FIRE8)
+SQUEEZENET_FIRE_STEP(9, POOL8_H_OUT, POOL8_W_OUT)
+#undef SQUEEZENET_FIRE_STEP
+#undef SQUEEZENET_FIRE_POOL_STEP
+
+// Conv10 (Classifier) + ReLU + Global Average Pooling, fused: only the
+// logits are written, the conv10 map is never stored
+// NOTE: SqueezeNet paper usually doesn't have ReLU after the final conv,
+//       but some implementations might.
+void squeezenet_step_classifier(float arena[], const float input[], float output[]) {
+#pragma HLS INLINE
+    (void)arena;
+    classifier_gap_fixed<FIRE9_H_OUT, FIRE9_W_OUT, CONV10_C_IN, CONV10_C_OUT>(
+        input, conv10_weights, conv10_biases, output);
+}
+
 //--------------------------------------------------------------------------
 // Top-level SqueezeNet Function Implementation
 //--------------------------------------------------------------------------
@@ -213,138 +455,80 @@ void SqueezeNet(
     #pragma HLS INTERFACE s_axilite port=input_image  bundle=control
     #pragma HLS INTERFACE s_axilite port=output_logits bundle=control
 
-    // --- Intermediate Buffers (Static Allocation) ---
-    // These need to be large enough for the largest feature map they hold.
-    // Using two buffers and alternating can sometimes save memory, but let's
-    // use dedicated buffers for clarity first. Size these based on squeezenet_params.h
-    static float buf_conv1[BUF_CONV1_SIZE];
-    static float buf_pool1[BUF_POOL1_SIZE];
-    static float buf_fire2[BUF_FIRE2_SIZE];
-    static float buf_fire3[BUF_FIRE3_SIZE];
-    static float buf_fire4[BUF_FIRE4_SIZE];
-    static float buf_pool4[BUF_POOL4_SIZE];
-    static float buf_fire5[BUF_FIRE5_SIZE];
-    static float buf_fire6[BUF_FIRE6_SIZE];
-    static float buf_fire7[BUF_FIRE7_SIZE];
-    static float buf_fire8[BUF_FIRE8_SIZE];
-    static float buf_pool8[BUF_POOL8_SIZE];
-    static float buf_fire9[BUF_FIRE9_SIZE];
-    static float buf_conv10[BUF_CONV10_SIZE];
-
-	// Buffers for internal Fire module use (sized to max possible needed)
-	static float fire_squeeze_buf[MAX_FIRE_SQUEEZE_SIZE];
-	static float fire_expand1x1_buf[MAX_FIRE_EXPAND_SIZE];
-	static float fire_expand3x3_buf[MAX_FIRE_EXPAND_SIZE];
+    // Default context: the same single static arena as before
+    static InferenceContext default_context;
+    squeezenet_inference(default_context, input_image, output_logits);
+}
 
+//--------------------------------------------------------------------------
+// Reentrant SqueezeNet Implementation
+//--------------------------------------------------------------------------
+void squeezenet_inference(
+    InferenceContext& ctx,
+    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+    float output_logits[NUM_CLASSES]
+) {
+#ifndef __SYNTHESIS__
+    // Host builds, calibration session: the unfused layer-by-layer pipeline,
+    // which stores every layer output for the collector (squeezenet_calibration.h)
+    if (calibration_active()) {
+        squeezenet_inference_batch(ctx.arena, 1, input_image, output_logits);
+        return;
+    }
+    // Int8 network when selected (squeezenet_quant.h)
+    if (inference_precision() == PRECISION_INT8) {
+        squeezenet_int8(ctx.arena, input_image, output_logits);
+        return;
+    }
+    // Per-layer precision policy when selected (squeezenet_precision.h)
+    if (inference_precision() == PRECISION_MIXED) {
+        squeezenet_mixed(ctx.arena, precision_policy(), input_image, output_logits);
+        return;
+    }
+    // Channel-blocked pipeline when selected (squeezenet_nchwc.h)
+    if (activation_layout() == ACTIVATION_LAYOUT_NCHW8C) {
+        squeezenet_nchw8c(ctx.arena, input_image, output_logits);
+        return;
+    }
+#endif
+
+    // --- Intermediate Buffers (Activation Arena) ---
+    // Every feature map and fire squeeze scratch sits in the context's arena
+    // at the offset planned from its lifetime (squeezenet_arena.h), so maps
+    // that are never live at the same time share memory.
+    float* arena = ctx.arena;
+    float* buf_pool1 = squeezenet_tensor(arena, ARENA_POOL1);
+    float* buf_fire2 = squeezenet_tensor(arena, ARENA_FIRE2);
+    float* buf_fire3 = squeezenet_tensor(arena, ARENA_FIRE3);
+    float* buf_pool4 = squeezenet_tensor(arena, ARENA_POOL4);
+    float* buf_fire5 = squeezenet_tensor(arena, ARENA_FIRE5);
+    float* buf_fire6 = squeezenet_tensor(arena, ARENA_FIRE6);
+    float* buf_fire7 = squeezenet_tensor(arena, ARENA_FIRE7);
+    float* buf_pool8 = squeezenet_tensor(arena, ARENA_POOL8);
+    float* buf_fire9 = squeezenet_tensor(arena, ARENA_FIRE9);
+
+    // --- Compile-Time Shape Checks ---
+    // The params.h output sizes must agree with what each kernel computes
+    static_assert(CONV1_KH == CONV1_KW && CONV10_KH == CONV10_KW, "square kernels only");
+    static_assert(conv_out_dim(INPUT_H, CONV1_KH, CONV1_S, CONV1_P) == CONV1_H_OUT &&
+                  conv_out_dim(INPUT_W, CONV1_KW, CONV1_S, CONV1_P) == CONV1_W_OUT, "conv1 shape");
+    static_assert(conv_out_dim(CONV1_H_OUT, POOL1_K, POOL1_S, 0) == POOL1_H_OUT, "pool1 shape");
+    static_assert(conv_out_dim(FIRE4_H_OUT, POOL4_K, POOL4_S, 0) == POOL4_H_OUT, "pool4 shape");
+    static_assert(conv_out_dim(FIRE8_H_OUT, POOL8_K, POOL8_S, 0) == POOL8_H_OUT, "pool8 shape");
+    static_assert(conv_out_dim(FIRE9_H_OUT, CONV10_KH, CONV10_S, CONV10_P) == CONV10_H_OUT, "conv10 shape");
+    static_assert(CONV10_KH == 1 && CONV10_S == 1 && CONV10_P == 0, "fused classifier expects a 1x1 conv10");
 
     // --- Layer Execution ---
-    // Conv1 + ReLU
-    convolution(input_image, conv1_weights, conv1_biases, buf_conv1,
-                INPUT_H, INPUT_W, INPUT_C,
-                CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
-                CONV1_KH, CONV1_KW, CONV1_S, CONV1_S, CONV1_P, CONV1_P, true);
-
-    // MaxPool1
-    max_pooling(buf_conv1, buf_pool1,
-                CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
-                POOL1_H_OUT, POOL1_W_OUT,
-                POOL1_K, POOL1_K, POOL1_S, POOL1_S);
-
-    // Fire2
-    fire_module(buf_pool1, buf_fire2,
-                POOL1_H_OUT, POOL1_W_OUT, POOL1_C_OUT,
-                FIRE2_H_OUT, FIRE2_W_OUT, FIRE2_C_OUT,
-                fire2_squeeze1x1_weights, fire2_squeeze1x1_biases, FIRE2_S1x1,
-                fire2_expand1x1_weights, fire2_expand1x1_biases, FIRE2_E1x1,
-                fire2_expand3x3_weights, fire2_expand3x3_biases, FIRE2_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Fire3
-    fire_module(buf_fire2, buf_fire3,
-                FIRE2_H_OUT, FIRE2_W_OUT, FIRE2_C_OUT,
-                FIRE3_H_OUT, FIRE3_W_OUT, FIRE3_C_OUT,
-                fire3_squeeze1x1_weights, fire3_squeeze1x1_biases, FIRE3_S1x1,
-                fire3_expand1x1_weights, fire3_expand1x1_biases, FIRE3_E1x1,
-                fire3_expand3x3_weights, fire3_expand3x3_biases, FIRE3_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Fire4
-    fire_module(buf_fire3, buf_fire4,
-                FIRE3_H_OUT, FIRE3_W_OUT, FIRE3_C_OUT,
-                FIRE4_H_OUT, FIRE4_W_OUT, FIRE4_C_OUT,
-                fire4_squeeze1x1_weights, fire4_squeeze1x1_biases, FIRE4_S1x1,
-                fire4_expand1x1_weights, fire4_expand1x1_biases, FIRE4_E1x1,
-                fire4_expand3x3_weights, fire4_expand3x3_biases, FIRE4_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // MaxPool4
-    max_pooling(buf_fire4, buf_pool4,
-                FIRE4_H_OUT, FIRE4_W_OUT, FIRE4_C_OUT,
-                POOL4_H_OUT, POOL4_W_OUT,
-                POOL4_K, POOL4_K, POOL4_S, POOL4_S);
-
-    // Fire5
-    fire_module(buf_pool4, buf_fire5,
-                POOL4_H_OUT, POOL4_W_OUT, POOL4_C_OUT,
-                FIRE5_H_OUT, FIRE5_W_OUT, FIRE5_C_OUT,
-                fire5_squeeze1x1_weights, fire5_squeeze1x1_biases, FIRE5_S1x1,
-                fire5_expand1x1_weights, fire5_expand1x1_biases, FIRE5_E1x1,
-                fire5_expand3x3_weights, fire5_expand3x3_biases, FIRE5_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Fire6
-    fire_module(buf_fire5, buf_fire6,
-                FIRE5_H_OUT, FIRE5_W_OUT, FIRE5_C_OUT,
-                FIRE6_H_OUT, FIRE6_W_OUT, FIRE6_C_OUT,
-                fire6_squeeze1x1_weights, fire6_squeeze1x1_biases, FIRE6_S1x1,
-                fire6_expand1x1_weights, fire6_expand1x1_biases, FIRE6_E1x1,
-                fire6_expand3x3_weights, fire6_expand3x3_biases, FIRE6_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Fire7
-    fire_module(buf_fire6, buf_fire7,
-                FIRE6_H_OUT, FIRE6_W_OUT, FIRE6_C_OUT,
-                FIRE7_H_OUT, FIRE7_W_OUT, FIRE7_C_OUT,
-                fire7_squeeze1x1_weights, fire7_squeeze1x1_biases, FIRE7_S1x1,
-                fire7_expand1x1_weights, fire7_expand1x1_biases, FIRE7_E1x1,
-                fire7_expand3x3_weights, fire7_expand3x3_biases, FIRE7_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Fire8
-    fire_module(buf_fire7, buf_fire8,
-                FIRE7_H_OUT, FIRE7_W_OUT, FIRE7_C_OUT,
-                FIRE8_H_OUT, FIRE8_W_OUT, FIRE8_C_OUT,
-                fire8_squeeze1x1_weights, fire8_squeeze1x1_biases, FIRE8_S1x1,
-                fire8_expand1x1_weights, fire8_expand1x1_biases, FIRE8_E1x1,
-                fire8_expand3x3_weights, fire8_expand3x3_biases, FIRE8_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // MaxPool8
-     max_pooling(buf_fire8, buf_pool8,
-                 FIRE8_H_OUT, FIRE8_W_OUT, FIRE8_C_OUT,
-                 POOL8_H_OUT, POOL8_W_OUT,
-                 POOL8_K, POOL8_K, POOL8_S, POOL8_S);
-
-    // Fire9
-    fire_module(buf_pool8, buf_fire9,
-                POOL8_H_OUT, POOL8_W_OUT, POOL8_C_OUT,
-                FIRE9_H_OUT, FIRE9_W_OUT, FIRE9_C_OUT,
-                fire9_squeeze1x1_weights, fire9_squeeze1x1_biases, FIRE9_S1x1,
-                fire9_expand1x1_weights, fire9_expand1x1_biases, FIRE9_E1x1,
-                fire9_expand3x3_weights, fire9_expand3x3_biases, FIRE9_E3x3,
-				fire_squeeze_buf, fire_expand1x1_buf, fire_expand3x3_buf);
-
-    // Conv10 (Classifier) + ReLU
-    // NOTE: SqueezeNet paper usually doesn't have ReLU after the final conv,
-    //       but some implementations might. Set apply_relu=false if needed.
-    convolution(buf_fire9, conv10_weights, conv10_biases, buf_conv10,
-                FIRE9_H_OUT, FIRE9_W_OUT, FIRE9_C_OUT,
-                CONV10_H_OUT, CONV10_W_OUT, CONV10_C_OUT,
-                CONV10_KH, CONV10_KW, CONV10_S, CONV10_S, CONV10_P, CONV10_P, true); // Apply ReLU here?
-
-    // Global Average Pooling
-    global_average_pooling(buf_conv10, output_logits,
-                           CONV10_H_OUT, CONV10_W_OUT, CONV10_C_OUT);
+    squeezenet_step_conv1(arena, input_image, buf_pool1);
+    squeezenet_step_fire2(arena, buf_pool1, buf_fire2);
+    squeezenet_step_fire3(arena, buf_fire2, buf_fire3);
+    squeezenet_step_fire4(arena, buf_fire3, buf_pool4);
+    squeezenet_step_fire5(arena, buf_pool4, buf_fire5);
+    squeezenet_step_fire6(arena, buf_fire5, buf_fire6);
+    squeezenet_step_fire7(arena, buf_fire6, buf_fire7);
+    squeezenet_step_fire8(arena, buf_fire7, buf_pool8);
+    squeezenet_step_fire9(arena, buf_pool8, buf_fire9);
+    squeezenet_step_classifier(arena, buf_fire9, output_logits);
 
     // Output `output_logits` now contains the final class scores (before softmax)
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <cmath> // For fmaxf, expf
 #include "squeezenet_params.h"
 #include "squeezenet_weights.h" // Include weights here
+#include "squeezenet_arena.h"   // For the InferenceContext arena size
 
 // Basic ReLU activation function
 inline float relu_activation(float x) {
@@ -11,6 +12,21 @@ inline float relu_activation(float x) {
     return (x < 0.0f) ? 0.0f : x;
 }
 
+// Output positions [begin, end) along one axis whose K-tap window (stride S,
+// padding P) lies entirely inside an input of size In. Only outputs outside
+// this range can touch padding (or a window clipped at the edge), so only
+// they need per-tap bounds checks.
+constexpr int window_interior_begin(int Out, int S, int P) {
+    return ((P + S - 1) / S < Out) ? (P + S - 1) / S : Out;
+}
+
+constexpr int window_interior_end(int In, int Out, int K, int S, int P) {
+    return (In + P - K < 0) ? window_interior_begin(Out, S, P) :
+           ((In + P - K) / S + 1 > Out) ? Out :
+           ((In + P - K) / S + 1 < window_interior_begin(Out, S, P)) ? window_interior_begin(Out, S, P) :
+           (In + P - K) / S + 1;
+}
+
 // Convolution Layer
 void convolution(
     const float input[],         // Input feature map (flattened)
@@ -37,6 +53,9 @@ void max_pooling(
 
 // Fire Module
 // Contains: Squeeze (Conv 1x1) -> ReLU -> Expand (Conv 1x1 + Conv 3x3) -> ReLU -> Concatenate
+// The expand layers write straight into their channel slice of `output`
+// (CHW: expand1x1 at channel 0, expand3x3 at channel Expand1x1C), so the
+// concatenation needs no copy.
 void fire_module(
     const float input[],              // Input feature map (flattened)
     float output[],                   // Output feature map (flattened)
@@ -57,9 +76,49 @@ void fire_module(
     const float expand3x3_biases[],
     int Expand3x3C,                    // Number of output channels for Expand 3x3 layer
 	// --- Internal Buffers ---
-	float squeeze_buf[],			   // Temp buffer for squeeze output
-	float expand1x1_buf[],             // Temp buffer for expand 1x1 output
-	float expand3x3_buf[]              // Temp buffer for expand 3x3 output
+	float squeeze_buf[]			       // Temp buffer for squeeze output
+);
+
+// Tile-fused Fire Module (same result as fire_module(), H x W preserved)
+// Works through the map in bands of FIRE_TILE_ROWS rows: the squeeze output
+// of one band plus its one-row halo is kept in band_buf and read by both
+// expand layers right away, so the full squeeze map is never written out.
+// The expand layers write straight into their channel half of `output`.
+void fire_module_rows(
+    const float input[],              // Input feature map (flattened)
+    float output[],                   // Output feature map (flattened)
+    int H, int W, int InC,            // Input dimensions (output is H x W too)
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    float band_buf[]                  // Squeeze band (Size: SqueezeC * (FIRE_TILE_ROWS + 2) * W)
+);
+
+// Fused Producer + Max Pooling (no padding, like max_pooling())
+// The producer map is only ever held POOL_BAND_ROWS rows at a time: band row 0
+// is producer row p0 * S, channels are band_hw floats apart. max_pool_band()
+// writes pooled rows [p0, p1) of the OutH x OutW output from the `rows` valid
+// band rows; pool_band_carry() moves the rows shared with the next band
+// (band rows [src_row, src_row + rows)) to the top of the band.
+void max_pool_band(
+    const float band[], int rows, int W, int C, int band_hw,
+    float output[], int OutH, int OutW, int p0, int p1, int K, int S);
+
+void pool_band_carry(float band[], int C, int band_hw, int W, int src_row, int rows);
+
+// Tile-fused Fire Module + Max Pooling: fire rows are produced into pool_band
+// (OutC x POOL_BAND_ROWS x W) and pooled into the PoolH x PoolW output, so the
+// full-resolution fire output is never stored
+void fire_module_pool_rows(
+    const float input[],              // Input feature map (flattened)
+    float output[],                   // Pooled output (OutC x PoolH x PoolW)
+    int H, int W, int InC,            // Input dimensions (fire output is H x W too)
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    int PoolK, int PoolS, int PoolH, int PoolW,
+    float squeeze_band[],             // Squeeze band (see fire_module_rows)
+    float pool_band[]                 // Fire band (Size: OutC * POOL_BAND_ROWS * W)
 );
 
 // Global Average Pooling Layer
@@ -70,7 +129,40 @@ void global_average_pooling(
 );
 
 
-// Top-level SqueezeNet function
+// Per-inference state. Every activation of one SqueezeNet pass lives in the
+// context's arena (squeezenet_arena.h); weights are shared read-only and the
+// host backends keep their packing scratch per thread, so threads running
+// squeezenet_inference() on separate contexts do not interfere. A context is
+// a few MB: allocate it on the heap (or make it static), not on the stack.
+struct InferenceContext {
+    float arena[SQUEEZENET_ARENA_SIZE];
+};
+
+// Reentrant SqueezeNet on the caller's context
+void squeezenet_inference(
+    InferenceContext& ctx,                                 // Activation storage for this call
+    const float input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
+    float output_logits[NUM_CLASSES]                       // Output logits (before Softmax)
+);
+
+// Network steps of the CHW path, in order: each reads one feature map and
+// writes the next (step 1 reads the image, the classifier writes the logits)
+// with its scratch taken from `arena` at the planned offsets.
+// squeezenet_inference() runs them back to back; the host frame pipeline
+// (squeezenet_pipeline.h) runs groups of them on separate cores.
+void squeezenet_step_conv1(float arena[], const float input[], float output[]);      // conv1 + pool1
+void squeezenet_step_fire2(float arena[], const float input[], float output[]);
+void squeezenet_step_fire3(float arena[], const float input[], float output[]);
+void squeezenet_step_fire4(float arena[], const float input[], float output[]);      // fire4 + pool4
+void squeezenet_step_fire5(float arena[], const float input[], float output[]);
+void squeezenet_step_fire6(float arena[], const float input[], float output[]);
+void squeezenet_step_fire7(float arena[], const float input[], float output[]);
+void squeezenet_step_fire8(float arena[], const float input[], float output[]);      // fire8 + pool8
+void squeezenet_step_fire9(float arena[], const float input[], float output[]);
+void squeezenet_step_classifier(float arena[], const float input[], float output[]); // conv10 + GAP
+
+// Top-level SqueezeNet function (HLS top; runs on a static default context,
+// so it is not reentrant)
 void SqueezeNet(
     const float input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
     float output_logits[NUM_CLASSES]                       // Output logits (before Softmax)
@@ -0,0 +1,252 @@
+#ifndef SQUEEZENET_ARENA_H
+#define SQUEEZENET_ARENA_H
+
+#include "squeezenet_params.h"
+#include "squeezenet_simd.h" // For NCHWC_BLOCK
+
+// ==========================================================================
+// === Activation Arena Planner =============================================
+// ==========================================================================
+// SqueezeNet is a straight chain: a feature map is written by one layer and
+// read by the next (or the next two, around a pool), so at most a couple of
+// maps are live at any time. Instead of one static buffer per map, the
+// network declares its tensors with their lifetimes, i.e. the first step
+// that writes and the last step that reads them. arena_plan() then assigns
+// each one an offset in a single arena.
+//
+// Tensors are placed largest first, at the lowest offset that does not
+// overlap any already placed tensor whose lifetime intersects its own. The
+// whole plan is constexpr: offsets and the arena size are compile-time
+// constants (usable as array bounds and by HLS), and a tensor table that
+// does not fit fails to compile instead of aliasing at run time.
+// ==========================================================================
+
+#define ARENA_MAX_TENSORS 32 // Entries per plan
+#define ARENA_ALIGN 16       // Offsets are multiples of 16 floats (64 bytes)
+
+// One activation tensor of a network
+struct ArenaTensor {
+    const char* name;
+    int size;   // Floats
+    int first;  // Step that writes it
+    int last;   // Last step that reads it
+};
+
+// Result of arena_plan(); all sizes in floats
+struct ArenaPlan {
+    int offset[ARENA_MAX_TENSORS]; // Per tensor, in table order
+    int size;                      // Arena size (peak footprint)
+    int live_peak;                 // Largest total of simultaneously live tensors (lower bound)
+    int dedicated;                 // Total with one buffer per tensor
+};
+
+constexpr int arena_align(int n) {
+    return (n + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+}
+
+constexpr bool arena_lifetimes_overlap(const ArenaTensor& a, const ArenaTensor& b) {
+    return a.first <= b.last && b.first <= a.last;
+}
+
+template<int N>
+constexpr ArenaPlan arena_plan(const ArenaTensor (&tensors)[N]) {
+    static_assert(N <= ARENA_MAX_TENSORS, "too many arena tensors");
+    ArenaPlan plan = {};
+
+    // Largest first (insertion sort, so equal sizes keep table order)
+    int order[ARENA_MAX_TENSORS] = {};
+    for (int i = 0; i < N; ++i) {
+        int j = i;
+        while (j > 0 && tensors[order[j - 1]].size < tensors[i].size) {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+
+    for (int k = 0; k < N; ++k) {
+        const ArenaTensor& t = tensors[order[k]];
+        // Bump past every conflicting tensor in the way until the slot is free;
+        // each bump only skips offsets that overlap that tensor, so the result
+        // is the lowest free offset
+        int offset = 0;
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (int j = 0; j < k; ++j) {
+                const ArenaTensor& u = tensors[order[j]];
+                int u_begin = plan.offset[order[j]];
+                int u_end = u_begin + arena_align(u.size);
+                if (arena_lifetimes_overlap(t, u) &&
+                    offset < u_end && u_begin < offset + arena_align(t.size)) {
+                    offset = u_end;
+                    moved = true;
+                }
+            }
+        }
+        plan.offset[order[k]] = offset;
+        if (offset + arena_align(t.size) > plan.size) {
+            plan.size = offset + arena_align(t.size);
+        }
+    }
+
+    int last_step = 0;
+    for (int i = 0; i < N; ++i) {
+        plan.dedicated += tensors[i].size;
+        last_step = (tensors[i].last > last_step) ? tensors[i].last : last_step;
+    }
+    for (int step = 0; step <= last_step; ++step) {
+        int live = 0;
+        for (int i = 0; i < N; ++i) {
+            if (tensors[i].first <= step && step <= tensors[i].last) {
+                live += arena_align(tensors[i].size);
+            }
+        }
+        plan.live_peak = (live > plan.live_peak) ? live : plan.live_peak;
+    }
+    return plan;
+}
+
+//--------------------------------------------------------------------------
+// SqueezeNet() Activation Tensors
+//--------------------------------------------------------------------------
+// Steps: 0 conv1 + pool1, 1-2 fire2-3, 3 fire4 + pool4, 4-6 fire5-7,
+// 7 fire8 + pool8, 8 fire9, 9 conv10 + GAP (each "+" is one fused stage).
+// The input image and the logits live outside the arena. A fire module's
+// squeeze scratch and a fused stage's producer band are only live for their
+// step: one band in the HLS design, a whole map on the host, where the
+// GEMM/Winograd backends work on full maps (see FIRE_SQUEEZE_BUF_SIZE).
+#ifdef __SYNTHESIS__
+#define ARENA_FIRE_SQUEEZE(n) (FIRE##n##_S1x1 * (FIRE_TILE_ROWS + 2) * FIRE##n##_W_OUT)
+#define ARENA_POOL_BAND(C, H, W) ((C) * POOL_BAND_ROWS * (W))
+#else
+#define ARENA_FIRE_SQUEEZE(n) (FIRE##n##_S1x1 * FIRE##n##_H_OUT * FIRE##n##_W_OUT)
+#define ARENA_POOL_BAND(C, H, W) ((C) * (H) * (W))
+#endif
+
+enum SqueezeNetTensor {
+    ARENA_CONV1, ARENA_POOL1,
+    ARENA_FIRE2, ARENA_FIRE3, ARENA_FIRE4, ARENA_POOL4,
+    ARENA_FIRE5, ARENA_FIRE6, ARENA_FIRE7, ARENA_FIRE8, ARENA_POOL8,
+    ARENA_FIRE9,
+    ARENA_SQUEEZE2, ARENA_SQUEEZE3, ARENA_SQUEEZE4, ARENA_SQUEEZE5,
+    ARENA_SQUEEZE6, ARENA_SQUEEZE7, ARENA_SQUEEZE8, ARENA_SQUEEZE9,
+    SQUEEZENET_NUM_TENSORS
+};
+
+static constexpr ArenaTensor squeezenet_tensors[SQUEEZENET_NUM_TENSORS] = {
+    {"conv1 band", ARENA_POOL_BAND(CONV1_C_OUT, CONV1_H_OUT, CONV1_W_OUT), 0, 0},
+    {"pool1",    BUF_POOL1_SIZE,  0,  1},
+    {"fire2",    BUF_FIRE2_SIZE,  1,  2},
+    {"fire3",    BUF_FIRE3_SIZE,  2,  3},
+    {"fire4 band", ARENA_POOL_BAND(FIRE4_C_OUT, FIRE4_H_OUT, FIRE4_W_OUT), 3, 3},
+    {"pool4",    BUF_POOL4_SIZE,  3,  4},
+    {"fire5",    BUF_FIRE5_SIZE,  4,  5},
+    {"fire6",    BUF_FIRE6_SIZE,  5,  6},
+    {"fire7",    BUF_FIRE7_SIZE,  6,  7},
+    {"fire8 band", ARENA_POOL_BAND(FIRE8_C_OUT, FIRE8_H_OUT, FIRE8_W_OUT), 7, 7},
+    {"pool8",    BUF_POOL8_SIZE,  7,  8},
+    {"fire9",    BUF_FIRE9_SIZE,  8,  9},
+    {"squeeze2", ARENA_FIRE_SQUEEZE(2),  1,  1},
+    {"squeeze3", ARENA_FIRE_SQUEEZE(3),  2,  2},
+    {"squeeze4", ARENA_FIRE_SQUEEZE(4),  3,  3},
+    {"squeeze5", ARENA_FIRE_SQUEEZE(5),  4,  4},
+    {"squeeze6", ARENA_FIRE_SQUEEZE(6),  5,  5},
+    {"squeeze7", ARENA_FIRE_SQUEEZE(7),  6,  6},
+    {"squeeze8", ARENA_FIRE_SQUEEZE(8),  7,  7},
+    {"squeeze9", ARENA_FIRE_SQUEEZE(9),  8,  8},
+};
+
+static constexpr ArenaPlan squeezenet_arena_plan = arena_plan(squeezenet_tensors);
+
+// Tensor t inside an arena of squeezenet_arena_plan.size floats
+inline float* squeezenet_tensor(float arena[], int t) {
+#pragma HLS INLINE
+    return arena + squeezenet_arena_plan.offset[t];
+}
+
+#ifndef __SYNTHESIS__
+//--------------------------------------------------------------------------
+// squeezenet_nchw8c() Activation Tensors (Host Builds Only)
+//--------------------------------------------------------------------------
+// Steps: 0 input reorder, 1 conv1 + pool1, 2 fire2-4 + pool4, 3 fire5-8 +
+// pool8, 4 fire9, 5 conv10 + GAP. Channel counts are rounded up to whole
+// NCHW8c blocks. Squeeze scratch is one haloed band, conv1's fused pool
+// keeps one POOL_BAND_ROWS band of conv1, and the classifier only keeps one
+// conv10 output row. The fire groups run depth-first (fire_group_nchw8c()):
+// each of their fires keeps a window of rows instead of a whole map.
+#define NCHWC_SQUEEZE_BAND(n) (FIRE##n##_S1x1 * (FIRE_TILE_ROWS + 2) * (FIRE##n##_W_OUT + 2))
+#define NCHWC_POOL_BAND(C, W) (NCHWC_BLOCK * (((C) + NCHWC_BLOCK - 1) / NCHWC_BLOCK) * POOL_BAND_ROWS * (W))
+
+// Pooled rows per band (1 .. PoolH) of a depth-first fire group whose maps
+// take row_floats floats per row all together: a band needs (rows - 1) * S + K
+// rows of the last fire plus about two halo rows of the others, within
+// DEPTH_FIRST_L2_BYTES
+constexpr int depth_first_band_rows(int row_floats, int PoolK, int PoolS, int PoolH) {
+    int fire_rows = DEPTH_FIRST_L2_BYTES / (int)sizeof(float) / row_floats - 2;
+    int band = (fire_rows - PoolK) / PoolS + 1;
+    return band < 1 ? 1 : (band > PoolH ? PoolH : band);
+}
+
+// Window rows of every fire in a group of `fires` fires: the last fire's
+// rows for one band, plus one halo row per fire further down the group and
+// the row the next band starts on
+constexpr int depth_first_window_rows(int band_rows, int fires, int PoolK, int PoolS) {
+    return (band_rows - 1) * PoolS + PoolK + fires;
+}
+
+#define FIRE_GROUP4_ROW_FLOATS (FIRE2_W_OUT * (FIRE2_C_OUT + FIRE3_C_OUT + FIRE4_C_OUT))
+#define FIRE_GROUP8_ROW_FLOATS (FIRE5_W_OUT * (FIRE5_C_OUT + FIRE6_C_OUT + FIRE7_C_OUT + FIRE8_C_OUT))
+#define FIRE_GROUP4_BAND_ROWS depth_first_band_rows(FIRE_GROUP4_ROW_FLOATS, POOL4_K, POOL4_S, POOL4_H_OUT)
+#define FIRE_GROUP8_BAND_ROWS depth_first_band_rows(FIRE_GROUP8_ROW_FLOATS, POOL8_K, POOL8_S, POOL8_H_OUT)
+#define FIRE_GROUP4_WINDOW_ROWS depth_first_window_rows(FIRE_GROUP4_BAND_ROWS, 3, POOL4_K, POOL4_S)
+#define FIRE_GROUP8_WINDOW_ROWS depth_first_window_rows(FIRE_GROUP8_BAND_ROWS, 4, POOL8_K, POOL8_S)
+#define NCHWC_FIRE_WINDOW(n, rows) (FIRE##n##_C_OUT * (rows) * FIRE##n##_W_OUT)
+
+enum Nchw8cTensor {
+    NCHWC_ARENA_INPUT, NCHWC_ARENA_CONV1_BAND, NCHWC_ARENA_POOL1,
+    NCHWC_ARENA_FIRE2_ROWS, NCHWC_ARENA_FIRE3_ROWS, NCHWC_ARENA_FIRE4_ROWS, NCHWC_ARENA_POOL4,
+    NCHWC_ARENA_FIRE5_ROWS, NCHWC_ARENA_FIRE6_ROWS, NCHWC_ARENA_FIRE7_ROWS, NCHWC_ARENA_FIRE8_ROWS,
+    NCHWC_ARENA_POOL8,
+    NCHWC_ARENA_FIRE9, NCHWC_ARENA_CONV10_ROW,
+    NCHWC_ARENA_SQUEEZE2, NCHWC_ARENA_SQUEEZE3, NCHWC_ARENA_SQUEEZE4, NCHWC_ARENA_SQUEEZE5,
+    NCHWC_ARENA_SQUEEZE6, NCHWC_ARENA_SQUEEZE7, NCHWC_ARENA_SQUEEZE8, NCHWC_ARENA_SQUEEZE9,
+    NCHWC_NUM_TENSORS
+};
+
+static constexpr ArenaTensor nchw8c_tensors[NCHWC_NUM_TENSORS] = {
+    {"input",    NCHWC_BLOCK * INPUT_H * INPUT_W, 0, 1},
+    {"conv1 band", NCHWC_POOL_BAND(CONV1_C_OUT, CONV1_W_OUT), 1, 1},
+    {"pool1",    BUF_POOL1_SIZE,  1,  2},
+    {"fire2 rows", NCHWC_FIRE_WINDOW(2, FIRE_GROUP4_WINDOW_ROWS), 2, 2},
+    {"fire3 rows", NCHWC_FIRE_WINDOW(3, FIRE_GROUP4_WINDOW_ROWS), 2, 2},
+    {"fire4 rows", NCHWC_FIRE_WINDOW(4, FIRE_GROUP4_WINDOW_ROWS), 2, 2},
+    {"pool4",    BUF_POOL4_SIZE,  2,  3},
+    {"fire5 rows", NCHWC_FIRE_WINDOW(5, FIRE_GROUP8_WINDOW_ROWS), 3, 3},
+    {"fire6 rows", NCHWC_FIRE_WINDOW(6, FIRE_GROUP8_WINDOW_ROWS), 3, 3},
+    {"fire7 rows", NCHWC_FIRE_WINDOW(7, FIRE_GROUP8_WINDOW_ROWS), 3, 3},
+    {"fire8 rows", NCHWC_FIRE_WINDOW(8, FIRE_GROUP8_WINDOW_ROWS), 3, 3},
+    {"pool8",    BUF_POOL8_SIZE,  3,  4},
+    {"fire9",    BUF_FIRE9_SIZE,  4,  5},
+    {"conv10 row", NCHWC_BLOCK * ((CONV10_C_OUT + NCHWC_BLOCK - 1) / NCHWC_BLOCK) *
+                   CONV10_W_OUT, 5, 5},
+    {"squeeze2", NCHWC_SQUEEZE_BAND(2),  2,  2},
+    {"squeeze3", NCHWC_SQUEEZE_BAND(3),  2,  2},
+    {"squeeze4", NCHWC_SQUEEZE_BAND(4),  2,  2},
+    {"squeeze5", NCHWC_SQUEEZE_BAND(5),  3,  3},
+    {"squeeze6", NCHWC_SQUEEZE_BAND(6),  3,  3},
+    {"squeeze7", NCHWC_SQUEEZE_BAND(7),  3,  3},
+    {"squeeze8", NCHWC_SQUEEZE_BAND(8),  3,  3},
+    {"squeeze9", NCHWC_SQUEEZE_BAND(9),  4,  4},
+};
+
+static constexpr ArenaPlan nchw8c_arena_plan = arena_plan(nchw8c_tensors);
+
+// One arena serves whichever host pipeline activation_layout() selects
+#define SQUEEZENET_ARENA_SIZE (squeezenet_arena_plan.size > nchw8c_arena_plan.size ? \
+                               squeezenet_arena_plan.size : nchw8c_arena_plan.size)
+#else
+#define SQUEEZENET_ARENA_SIZE (squeezenet_arena_plan.size)
+#endif
+
+#endif // SQUEEZENET_ARENA_H
@@ -0,0 +1,162 @@
+#include "squeezenet_batch.h"
+#include "squeezenet.h"
+#include "squeezenet_calibration.h"
+#include "squeezenet_gemm.h"
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side pipeline only; HLS keeps the one-image design
+
+#include <algorithm> // For std::min
+#include <cstdio>    // For snprintf (calibration layer names)
+#include <vector>    // For the per-thread arena
+
+// Every tensor of the single-image plan holds `batch` maps here, so its
+// offset scales by the batch size too and the plan stays conflict-free
+static float* batch_tensor(float arena[], int batch, int t) {
+    return arena + batch * squeezenet_arena_plan.offset[t];
+}
+
+//--------------------------------------------------------------------------
+// Fire Module over a Batch (C x N x H x W maps)
+//--------------------------------------------------------------------------
+// Hand fire n's layer outputs to the calibration collector
+static void observe_fire(int n, const float squeeze[], const float output[], int cols,
+                         int SqueezeC, int Expand1x1C, int Expand3x3C)
+{
+    if (!calibration_active()) {
+        return;
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "fire%d/squeeze", n);
+    calibration_observe(name, squeeze, (size_t)SqueezeC * cols);
+    snprintf(name, sizeof(name), "fire%d/expand1x1", n);
+    calibration_observe(name, output, (size_t)Expand1x1C * cols);
+    snprintf(name, sizeof(name), "fire%d/expand3x3", n);
+    calibration_observe(name, output + (size_t)Expand1x1C * cols, (size_t)Expand3x3C * cols);
+    snprintf(name, sizeof(name), "fire%d", n);
+    calibration_observe(name, output, (size_t)(Expand1x1C + Expand3x3C) * cols);
+}
+
+static void fire_module_batch(
+    int n, const float input[], float output[], int batch, int H, int W, int InC,
+    const float squeeze_weights[], const float squeeze_biases[], int SqueezeC,
+    const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+    const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C,
+    float squeeze_buf[])
+{
+    const int cols = batch * H * W;
+
+    // 1. Squeeze: a plain GEMM over all N*H*W pixels
+    pointwise_convolution(input, squeeze_weights, squeeze_biases, squeeze_buf,
+                          cols, InC, SqueezeC, true);
+
+    // 2. Expand 1x1 and 3. expand 3x3, the latter into the second channel
+    // half (concatenation by layout); concurrent branches over squeeze_buf
+    parallel_branches((double)cols * SqueezeC * (Expand1x1C + 9 * Expand3x3C), {
+        [&] {
+            pointwise_convolution(squeeze_buf, expand1x1_weights, expand1x1_biases, output,
+                                  cols, SqueezeC, Expand1x1C, true);
+        },
+        [&] {
+            convolution_gemm_batch(squeeze_buf, expand3x3_weights, expand3x3_biases,
+                                   output + Expand1x1C * cols, batch, cols, H * W,
+                                   H, W, SqueezeC, H, W, Expand3x3C,
+                                   3, 3, 1, 1, 1, 1, true);
+        }
+    });
+    observe_fire(n, squeeze_buf, output, cols, SqueezeC, Expand1x1C, Expand3x3C);
+}
+
+//--------------------------------------------------------------------------
+// Whole Network
+//--------------------------------------------------------------------------
+void squeezenet_inference_batch(
+    float arena[], int batch,
+    const float input_images[], float output_logits[])
+{
+#define BATCH_TENSOR(t) batch_tensor(arena, batch, ARENA_##t)
+
+    float* buf_conv1 = BATCH_TENSOR(CONV1);
+    float* buf_pool1 = BATCH_TENSOR(POOL1);
+    float* buf_fire2 = BATCH_TENSOR(FIRE2);
+    float* buf_fire3 = BATCH_TENSOR(FIRE3);
+    float* buf_fire4 = BATCH_TENSOR(FIRE4);
+    float* buf_pool4 = BATCH_TENSOR(POOL4);
+    float* buf_fire5 = BATCH_TENSOR(FIRE5);
+    float* buf_fire6 = BATCH_TENSOR(FIRE6);
+    float* buf_fire7 = BATCH_TENSOR(FIRE7);
+    float* buf_fire8 = BATCH_TENSOR(FIRE8);
+    float* buf_pool8 = BATCH_TENSOR(POOL8);
+    float* buf_fire9 = BATCH_TENSOR(FIRE9);
+
+    // Conv1 + ReLU: the input images are separate CHW maps, the output is
+    // channel-major over the batch
+    convolution_gemm_batch(input_images, conv1_weights, conv1_biases, buf_conv1,
+                           batch, INPUT_H * INPUT_W, INPUT_C * INPUT_H * INPUT_W,
+                           INPUT_H, INPUT_W, INPUT_C, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
+                           CONV1_KH, CONV1_KW, CONV1_S, CONV1_S, CONV1_P, CONV1_P, true);
+    calibration_observe("input", input_images, (size_t)batch * INPUT_C * INPUT_H * INPUT_W);
+    calibration_observe("conv1", buf_conv1, (size_t)batch * BUF_CONV1_SIZE);
+
+    // Pools: every (channel, image) plane is a contiguous H x W map
+    max_pooling(buf_conv1, buf_pool1, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT * batch,
+                POOL1_H_OUT, POOL1_W_OUT, POOL1_K, POOL1_K, POOL1_S, POOL1_S);
+    calibration_observe("pool1", buf_pool1, (size_t)batch * BUF_POOL1_SIZE);
+
+#define BATCH_FIRE(n, in, out) \
+    fire_module_batch(n, in, out, batch, FIRE##n##_H_OUT, FIRE##n##_W_OUT, FIRE##n##_C_IN, \
+                      fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, FIRE##n##_S1x1, \
+                      fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, FIRE##n##_E1x1, \
+                      fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, FIRE##n##_E3x3, \
+                      BATCH_TENSOR(SQUEEZE##n))
+
+    BATCH_FIRE(2, buf_pool1, buf_fire2);
+    BATCH_FIRE(3, buf_fire2, buf_fire3);
+    BATCH_FIRE(4, buf_fire3, buf_fire4);
+    max_pooling(buf_fire4, buf_pool4, FIRE4_H_OUT, FIRE4_W_OUT, FIRE4_C_OUT * batch,
+                POOL4_H_OUT, POOL4_W_OUT, POOL4_K, POOL4_K, POOL4_S, POOL4_S);
+    calibration_observe("pool4", buf_pool4, (size_t)batch * BUF_POOL4_SIZE);
+    BATCH_FIRE(5, buf_pool4, buf_fire5);
+    BATCH_FIRE(6, buf_fire5, buf_fire6);
+    BATCH_FIRE(7, buf_fire6, buf_fire7);
+    BATCH_FIRE(8, buf_fire7, buf_fire8);
+    max_pooling(buf_fire8, buf_pool8, FIRE8_H_OUT, FIRE8_W_OUT, FIRE8_C_OUT * batch,
+                POOL8_H_OUT, POOL8_W_OUT, POOL8_K, POOL8_K, POOL8_S, POOL8_S);
+    calibration_observe("pool8", buf_pool8, (size_t)batch * BUF_POOL8_SIZE);
+    BATCH_FIRE(9, buf_pool8, buf_fire9);
+#undef BATCH_FIRE
+
+    // Conv10 + ReLU + GAP: one GEMM over all images, pooled per image
+    static_assert(CONV10_KH == 1 && CONV10_S == 1 && CONV10_P == 0, "fused classifier expects a 1x1 conv10");
+    pointwise_convolution_gap(buf_fire9, conv10_weights, conv10_biases, output_logits,
+                              FIRE9_H_OUT * FIRE9_W_OUT, CONV10_C_IN, CONV10_C_OUT, batch);
+
+    // Calibration also needs conv10's map, which the fused classifier never
+    // stores: compute it once more, unfused
+    if (calibration_active()) {
+        const int cols = batch * FIRE9_H_OUT * FIRE9_W_OUT;
+        std::vector<float> conv10((size_t)CONV10_C_OUT * cols);
+        pointwise_convolution(buf_fire9, conv10_weights, conv10_biases, conv10.data(),
+                              cols, CONV10_C_IN, CONV10_C_OUT, true);
+        calibration_observe("conv10", conv10.data(), conv10.size());
+        calibration_observe("logits", output_logits, (size_t)batch * NUM_CLASSES);
+    }
+#undef BATCH_TENSOR
+}
+
+void SqueezeNetBatch(int N, const float input_images[], float output_logits[]) {
+    static thread_local std::vector<float> arena;
+
+    for (int n0 = 0; n0 < N; n0 += SQUEEZENET_BATCH_MAX) {
+        int batch = std::min(SQUEEZENET_BATCH_MAX, N - n0);
+        size_t size = (size_t)squeezenet_batch_arena_size(batch);
+        if (arena.size() < size) {
+            arena.resize(size);
+        }
+        squeezenet_inference_batch(arena.data(), batch,
+                                   input_images + (size_t)n0 * INPUT_C * INPUT_H * INPUT_W,
+                                   output_logits + (size_t)n0 * NUM_CLASSES);
+    }
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,53 @@
+#ifndef SQUEEZENET_BATCH_H
+#define SQUEEZENET_BATCH_H
+
+#include "squeezenet_params.h"
+#include "squeezenet_arena.h" // For squeezenet_arena_plan
+
+// ==========================================================================
+// === Batched Inference (Host Builds Only) ================================
+// ==========================================================================
+// SqueezeNet() streams every layer's weights from memory once per image.
+// SqueezeNetBatch() runs each layer across a whole batch instead: feature
+// maps are stored channel-major over the batch (C x N x H x W), so channel
+// c of all N images is one contiguous row of N*H*W floats. That is exactly
+// the B matrix of a GEMM with N*H*W columns, so
+//   - squeeze/expand 1x1 layers are one pointwise_convolution() each,
+//   - conv1 and the expand 3x3 layers are one batched im2col GEMM
+//     (convolution_gemm_batch()),
+//   - conv10 + ReLU + GAP is one pointwise_convolution_gap() that pools each
+//     image's columns into its own logits,
+//   - the pools treat the batch as N times as many channel planes,
+// and every packed weight block is reused by all N images. The batch path
+// always uses these GEMM engines, whatever set_conv_backend() says.
+// ==========================================================================
+
+// Images run through the layers together; larger requests are split into
+// batches of this size. Bigger batches reuse each weight block more often but
+// push the (batch times larger) activations out of L2, and the arena grows
+// linearly with it.
+#define SQUEEZENET_BATCH_MAX 4
+
+// Arena floats for one call of squeezenet_inference_batch(): the host CHW
+// plan (squeezenet_arena.h) with every tensor `batch` times as large
+inline int squeezenet_batch_arena_size(int batch) {
+    return batch * squeezenet_arena_plan.size;
+}
+
+// Reentrant batched SqueezeNet on the caller's arena
+void squeezenet_inference_batch(
+    float arena[],                // squeezenet_batch_arena_size(batch) floats
+    int batch,                    // 1 .. SQUEEZENET_BATCH_MAX
+    const float input_images[],   // batch images, each INPUT_C x INPUT_H x INPUT_W
+    float output_logits[]         // batch x NUM_CLASSES logits (before Softmax)
+);
+
+// Top-level batched SqueezeNet: N images in, N logit vectors out (same
+// layouts as above, any N). Runs on a per-thread arena allocated on first use.
+void SqueezeNetBatch(
+    int N,
+    const float input_images[],
+    float output_logits[]
+);
+
+#endif // SQUEEZENET_BATCH_H
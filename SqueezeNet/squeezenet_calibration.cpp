@@ -0,0 +1,235 @@
+#include "squeezenet_calibration.h"
+#include "squeezenet.h"
+
+#ifndef __SYNTHESIS__ // Host-side calibration only
+
+#include <algorithm> // For std::min, std::max, std::sort
+#include <atomic>    // For the session flag
+#include <cmath>     // For std::fabs
+#include <cstdint>   // For uint64_t
+#include <cstdio>    // For the scale file and image files
+#include <cstring>   // For strcmp
+#include <mutex>     // For the collector lock
+#include <string>    // For layer and file names
+#include <vector>    // For the histograms
+#include <dirent.h>  // For opendir/readdir
+#include <sys/stat.h> // For stat (file type and size)
+
+//--------------------------------------------------------------------------
+// Collector
+//--------------------------------------------------------------------------
+struct LayerStats {
+    std::string name;
+    uint64_t count;
+    uint64_t zeros;
+    float min, max;
+    float hist_range;             // Bins split [0, hist_range] evenly
+    std::vector<uint64_t> hist;   // CALIBRATION_BINS counts of |x|
+};
+
+static std::atomic<bool> collecting(false);
+static std::mutex collector_mutex;
+static std::vector<LayerStats> layers;
+
+void calibration_begin() {
+    std::lock_guard<std::mutex> lock(collector_mutex);
+    layers.clear();
+    collecting.store(true, std::memory_order_release);
+}
+
+void calibration_end() {
+    collecting.store(false, std::memory_order_release);
+}
+
+bool calibration_active() {
+    return collecting.load(std::memory_order_acquire);
+}
+
+// Caller holds the lock
+static LayerStats* find_layer(const char* name) {
+    for (LayerStats& s : layers) {
+        if (s.name == name) {
+            return &s;
+        }
+    }
+    return 0;
+}
+
+// Double the histogram range until it covers abs_max, merging bin pairs
+static void grow_histogram(LayerStats& s, float abs_max) {
+    if (s.hist_range <= 0.0f) {
+        s.hist_range = abs_max; // Only zeros so far: they stay in bin 0
+        return;
+    }
+    while (s.hist_range < abs_max) {
+        for (int b = 0; b < CALIBRATION_BINS / 2; ++b) {
+            s.hist[b] = s.hist[2 * b] + s.hist[2 * b + 1];
+        }
+        std::fill(s.hist.begin() + CALIBRATION_BINS / 2, s.hist.end(), 0);
+        s.hist_range *= 2.0f;
+    }
+}
+
+void calibration_observe(const char* layer, const float data[], size_t count) {
+    if (!calibration_active() || count == 0) {
+        return;
+    }
+
+    // Range of this output first, outside the lock
+    float lo = data[0], hi = data[0];
+    uint64_t zeros = 0;
+    for (size_t i = 0; i < count; ++i) {
+        lo = std::min(lo, data[i]);
+        hi = std::max(hi, data[i]);
+        zeros += (data[i] == 0.0f);
+    }
+    const float abs_max = std::max(std::fabs(lo), std::fabs(hi));
+
+    std::lock_guard<std::mutex> lock(collector_mutex);
+    LayerStats* s = find_layer(layer);
+    if (!s) {
+        if ((int)layers.size() >= CALIBRATION_MAX_LAYERS) {
+            return;
+        }
+        layers.push_back(LayerStats());
+        s = &layers.back();
+        s->name = layer;
+        s->count = 0;
+        s->zeros = 0;
+        s->min = lo;
+        s->max = hi;
+        s->hist_range = 0.0f;
+        s->hist.assign(CALIBRATION_BINS, 0);
+    }
+    s->count += count;
+    s->zeros += zeros;
+    s->min = std::min(s->min, lo);
+    s->max = std::max(s->max, hi);
+    if (abs_max > s->hist_range) {
+        grow_histogram(*s, abs_max);
+    }
+
+    const float bins_per_unit = (s->hist_range > 0.0f) ? CALIBRATION_BINS / s->hist_range : 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        int b = (int)(std::fabs(data[i]) * bins_per_unit);
+        s->hist[std::min(b, CALIBRATION_BINS - 1)]++;
+    }
+}
+
+// Upper edge of the bin holding the pct-th percentile of |x|, capped at the
+// largest |x| seen
+static float layer_percentile(const LayerStats& s, double pct) {
+    const float abs_max = std::max(std::fabs(s.min), std::fabs(s.max));
+    const double target = pct / 100.0 * (double)s.count;
+    uint64_t seen = 0;
+    for (int b = 0; b < CALIBRATION_BINS; ++b) {
+        seen += s.hist[b];
+        if ((double)seen >= target) {
+            return std::min(abs_max, (b + 1) * s.hist_range / CALIBRATION_BINS);
+        }
+    }
+    return abs_max;
+}
+
+float calibration_range(const char* layer) {
+    std::lock_guard<std::mutex> lock(collector_mutex);
+    const LayerStats* s = find_layer(layer);
+    return s ? layer_percentile(*s, CALIBRATION_PERCENTILE) : 0.0f;
+}
+
+//--------------------------------------------------------------------------
+// Scale File
+//--------------------------------------------------------------------------
+bool calibration_write(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(collector_mutex);
+    fprintf(f, "# layer count min max zero_fraction p99 p99.9 p99.99 range(p%g)\n",
+            CALIBRATION_PERCENTILE);
+    for (const LayerStats& s : layers) {
+        fprintf(f, "%s %llu %.9g %.9g %.6f %.9g %.9g %.9g %.9g\n",
+                s.name.c_str(), (unsigned long long)s.count, s.min, s.max,
+                (double)s.zeros / (double)s.count,
+                layer_percentile(s, 99.0), layer_percentile(s, 99.9), layer_percentile(s, 99.99),
+                layer_percentile(s, CALIBRATION_PERCENTILE));
+    }
+    return fclose(f) == 0;
+}
+
+bool calibration_load_ranges(const char* path, const char* const names[], int count, float ranges[]) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    std::vector<bool> found(count, false);
+    char line[512];
+    while (fgets(line, sizeof(line), f)) {
+        char name[128];
+        float values[8];
+        if (line[0] == '#' ||
+            sscanf(line, "%127s %g %g %g %g %g %g %g %g", name, &values[0], &values[1], &values[2],
+                   &values[3], &values[4], &values[5], &values[6], &values[7]) != 9) {
+            continue;
+        }
+        for (int i = 0; i < count; ++i) {
+            if (strcmp(name, names[i]) == 0) {
+                ranges[i] = values[7];
+                found[i] = true;
+            }
+        }
+    }
+    fclose(f);
+    return std::find(found.begin(), found.end(), false) == found.end();
+}
+
+//--------------------------------------------------------------------------
+// Directory of Calibration Images
+//--------------------------------------------------------------------------
+int calibration_image_files(const char* dir, std::vector<std::string>& paths) {
+    DIR* d = opendir(dir);
+    if (!d) {
+        return -1;
+    }
+    paths.clear();
+    while (struct dirent* entry = readdir(d)) {
+        std::string path = std::string(dir) + "/" + entry->d_name;
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode) &&
+            st.st_size == (off_t)(sizeof(float) * INPUT_C * INPUT_H * INPUT_W)) {
+            paths.push_back(path);
+        }
+    }
+    closedir(d);
+    std::sort(paths.begin(), paths.end());
+    return (int)paths.size();
+}
+
+int squeezenet_calibrate_directory(const char* dir, const char* scale_path) {
+    std::vector<std::string> files;
+    if (calibration_image_files(dir, files) < 0) {
+        return -1;
+    }
+
+    std::vector<float> image(INPUT_C * INPUT_H * INPUT_W);
+    float logits[NUM_CLASSES];
+    int used = 0;
+    calibration_begin();
+    for (const std::string& path : files) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) {
+            continue;
+        }
+        size_t got = fread(image.data(), sizeof(float), image.size(), f);
+        fclose(f);
+        if (got == image.size()) {
+            SqueezeNet(image.data(), logits);
+            ++used;
+        }
+    }
+    calibration_end();
+    return calibration_write(scale_path) ? used : -1;
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,83 @@
+#ifndef SQUEEZENET_CALIBRATION_H
+#define SQUEEZENET_CALIBRATION_H
+
+#include <cstddef> // For size_t
+#include <string>  // For the image file list
+#include <vector>
+#include "squeezenet_params.h"
+
+// ==========================================================================
+// === Activation-Range Calibration (Host Builds Only) ======================
+// ==========================================================================
+// Quantized and fixed-point inference need each layer's activation range.
+// While calibration is active (calibration_begin() .. calibration_end()),
+// every layer output the network produces is handed to the collector,
+// which accumulates per layer:
+//   - min, max and the fraction of exact zeros,
+//   - a CALIBRATION_BINS-bin histogram of |x| for percentiles. The bins
+//     cover [0, range]; when a larger value arrives the range doubles and
+//     neighbouring bins merge, so no pass over earlier data is needed.
+// calibration_write() stores the result as a per-layer scale file that the
+// int8 path (squeezenet_quant.h) loads at init and
+// squeezenet_fixed_point_check_ranges() checks against the fixed-point
+// format.
+//
+// SqueezeNet()'s fused pipelines never hold a squeeze map or conv10's map
+// whole, so in calibration mode squeezenet_inference() runs the unfused
+// layer-by-layer pipeline of squeezenet_batch.h instead, whose layer outputs
+// are all stored. Layers are named "input", "conv1", "pool1",
+// "fire<n>/squeeze", "fire<n>/expand1x1", "fire<n>/expand3x3", "fire<n>",
+// "pool4", "pool8", "conv10" and "logits".
+// ==========================================================================
+
+#define CALIBRATION_MAX_LAYERS 64      // Distinct layer names per session
+#define CALIBRATION_BINS 2048          // Histogram bins of |x| per layer
+#define CALIBRATION_PERCENTILE 99.99   // Percentile of |x| written as a layer's range
+
+// Scale file squeezenet_int8 falls back to when no ranges were set
+#define SQUEEZENET_SCALE_FILE "squeezenet_scales.txt"
+
+// Start a session (earlier statistics are dropped) / stop observing (the
+// statistics are kept until the next calibration_begin())
+void calibration_begin();
+void calibration_end();
+bool calibration_active();
+
+// Hook: add a layer output of `count` floats to the layer's statistics.
+// Returns at once when no session is active; safe from several threads.
+void calibration_observe(const char* layer, const float data[], size_t count);
+
+// CALIBRATION_PERCENTILE of |x| over everything the layer produced (never
+// above its max |x|); 0 for a layer that was not observed
+float calibration_range(const char* layer);
+
+// Write the scale file, one line per layer in the order first observed:
+//   <layer> <count> <min> <max> <zero fraction> <p99> <p99.9> <p99.99> <range>
+// percentiles are of |x|, range as calibration_range(). False on I/O errors.
+bool calibration_write(const char* path);
+
+// Read the ranges of the given layers back from a scale file. False if the
+// file cannot be read or a layer is missing from it.
+bool calibration_load_ranges(const char* path, const char* const layers[], int count, float ranges[]);
+
+// Calibrate over a directory of raw images: every regular file holding
+// exactly INPUT_C x INPUT_H x INPUT_W float32 values (CHW, preprocessed like
+// Test/input_image.h; generate_input_image.py --raw writes them) runs through
+// SqueezeNet() in a calibration session, in file name order, and the scale
+// file is written to scale_path. Returns the number of images used, or -1 if
+// the directory cannot be read or the file not written.
+int squeezenet_calibrate_directory(const char* dir, const char* scale_path);
+
+// The raw images of a directory (regular files of exactly INPUT_C x INPUT_H
+// x INPUT_W float32 values), in file name order. Returns their count, or -1
+// if the directory cannot be read.
+int calibration_image_files(const char* dir, std::vector<std::string>& paths);
+
+// Hook for code that is also synthesized: compiles to nothing in HLS
+#ifndef __SYNTHESIS__
+#define CALIBRATION_OBSERVE(layer, data, count) calibration_observe(layer, data, count)
+#else
+#define CALIBRATION_OBSERVE(layer, data, count) ((void)0)
+#endif
+
+#endif // SQUEEZENET_CALIBRATION_H
@@ -0,0 +1,333 @@
+#ifndef SQUEEZENET_FIXED_H
+#define SQUEEZENET_FIXED_H
+
+#include "squeezenet.h"
+#include "squeezenet_gemm.h"
+#include "squeezenet_threads.h"
+#include "squeezenet_winograd.h"
+
+// ==========================================================================
+// === Shape-Specialized Layer Templates ====================================
+// ==========================================================================
+// Every layer shape in squeezenet_params.h is known at compile time, so the
+// top-level SqueezeNet() instantiates one kernel per layer instead of passing
+// InH..PadW as runtime ints. Trip counts and index strides become constants:
+// HLS can fully unroll the kernel window and pipeline with a fixed latency,
+// and the C++ compiler can unroll/vectorize the same loops on the host.
+// Shape mistakes (e.g. an output size that does not match the kernel/stride/
+// padding) are caught by static_assert instead of overrunning a buffer.
+// ==========================================================================
+
+// Output size of a convolution/pooling window along one axis
+constexpr int conv_out_dim(int In, int K, int S, int P) {
+    return (In + 2 * P - K) / S + 1;
+}
+
+// One output pixel of convolution_fixed(); w_oc points at the output
+// channel's InC x K x K weights and (ih0, iw0) at the top-left input tap.
+// Border=false is only used for windows fully inside the input.
+template<int InH, int InW, int InC, int K, bool Border>
+inline float conv_pixel_fixed(
+    const float input[], const float w_oc[], float bias,
+    int ih0, int iw0, bool apply_relu)
+{
+#pragma HLS INLINE
+    float sum = bias;
+
+    FIXED_IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
+#pragma HLS PIPELINE II=1
+        // K x K window fully unrolled: K*K MACs per input channel
+        FIXED_KERNEL_H_LOOP: for (int kh = 0; kh < K; ++kh) {
+#pragma HLS UNROLL
+            FIXED_KERNEL_W_LOOP: for (int kw = 0; kw < K; ++kw) {
+#pragma HLS UNROLL
+                int ih = ih0 + kh;
+                int iw = iw0 + kw;
+                if (!Border || (ih >= 0 && ih < InH && iw >= 0 && iw < InW)) {
+                    sum += input[ic * InH * InW + ih * InW + iw] * w_oc[ic * K * K + kh * K + kw];
+                }
+            }
+        }
+    }
+    return apply_relu ? relu_activation(sum) : sum;
+}
+
+//--------------------------------------------------------------------------
+// Direct Convolution Rows (square kernel K, stride S, padding P)
+//--------------------------------------------------------------------------
+// Output rows [oh0, oh1), written to `output` with row 0 = output row oh0
+// and channels out_hw floats apart
+template<int InH, int InW, int InC, int OutC, int K, int S, int P>
+void convolution_fixed_rows(
+    const float input[InC * InH * InW],
+    const float weights[OutC * InC * K * K],
+    const float biases[OutC],
+    float output[], int out_hw,
+    int oh0, int oh1, bool apply_relu)
+{
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    constexpr int KK = K * K;
+
+    // Border split resolved at compile time: with P == 0 every pixel is interior
+    constexpr int OH_LO = window_interior_begin(OutH, S, P);
+    constexpr int OH_HI = window_interior_end(InH, OutH, K, S, P);
+    constexpr int OW_LO = window_interior_begin(OutW, S, P);
+    constexpr int OW_HI = window_interior_end(InW, OutW, K, S, P);
+
+    FIXED_OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
+        const float* w_oc = weights + oc * (InC * KK);
+        FIXED_OUT_H_LOOP: for (int oh = oh0; oh < oh1; ++oh) {
+            bool interior_row = (oh >= OH_LO && oh < OH_HI);
+            int w_lo = interior_row ? OW_LO : OutW;
+            int w_hi = interior_row ? OW_HI : OutW;
+            float* out_row = output + oc * out_hw + (oh - oh0) * OutW;
+
+            FIXED_OUT_W_BORDER_L_LOOP: for (int ow = 0; ow < w_lo; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, true>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_OUT_W_INTERIOR_LOOP: for (int ow = w_lo; ow < w_hi; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, false>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_OUT_W_BORDER_R_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, true>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Convolution (square kernel K, stride S, padding P)
+//--------------------------------------------------------------------------
+template<int InH, int InW, int InC, int OutC, int K, int S, int P>
+void convolution_fixed(
+    const float input[InC * InH * InW],
+    const float weights[OutC * InC * K * K],
+    const float biases[OutC],
+    float output[],               // OutC * OutH * OutW
+    bool apply_relu)
+{
+    static_assert(InH > 0 && InW > 0 && InC > 0 && OutC > 0, "empty convolution");
+    static_assert(K > 0 && S > 0 && P >= 0 && P < K, "invalid kernel/stride/padding");
+    static_assert(InH + 2 * P >= K && InW + 2 * P >= K, "kernel larger than padded input");
+
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    constexpr int OutHW = OutH * OutW;
+
+#ifndef __SYNTHESIS__
+    // Host builds: same backend choice as convolution(), with constant shapes
+    ConvBackend backend = conv_select_backend(InC, OutH, OutW, OutC, K, K, S, S, P, P);
+    if (backend == CONV_BACKEND_POINTWISE) {
+        pointwise_convolution(input, weights, biases, output, OutHW, InC, OutC, apply_relu);
+        return;
+    }
+    if (backend == CONV_BACKEND_GEMM) {
+        convolution_gemm(input, weights, biases, output,
+                         InH, InW, InC, OutH, OutW, OutC,
+                         K, K, S, S, P, P, apply_relu);
+        return;
+    }
+#endif
+
+    convolution_fixed_rows<InH, InW, InC, OutC, K, S, P>(
+        input, weights, biases, output, OutHW, 0, OutH, apply_relu);
+}
+
+//--------------------------------------------------------------------------
+// Convolution + Max Pooling, Fused (PoolK x PoolK window, stride PoolS)
+//--------------------------------------------------------------------------
+// Convolution rows are computed a band at a time into pool_buf and pooled
+// right away, so the full-resolution convolution output is never stored.
+template<int InH, int InW, int InC, int OutC, int K, int S, int P, int PoolK, int PoolS>
+void convolution_pool_fixed(
+    const float input[InC * InH * InW],
+    const float weights[OutC * InC * K * K],
+    const float biases[OutC],
+    float output[],               // OutC * PoolH * PoolW
+    float pool_buf[],             // One band (OutC * POOL_BAND_ROWS * OutW); a whole map on the host
+    bool apply_relu)
+{
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    constexpr int PoolH = conv_out_dim(OutH, PoolK, PoolS, 0);
+    constexpr int PoolW = conv_out_dim(OutW, PoolK, PoolS, 0);
+    static_assert((POOL_TILE_ROWS - 1) * PoolS + PoolK <= POOL_BAND_ROWS, "pool band too short");
+    static_assert(PoolK >= PoolS, "pool windows must overlap or touch");
+
+#ifndef __SYNTHESIS__
+    // Host builds: the GEMM backends run on whole maps, so pool_buf holds the
+    // full convolution output there
+    if (conv_select_backend(InC, OutH, OutW, OutC, K, K, S, S, P, P) != CONV_BACKEND_DIRECT) {
+        convolution_fixed<InH, InW, InC, OutC, K, S, P>(input, weights, biases, pool_buf, apply_relu);
+        max_pooling(pool_buf, output, OutH, OutW, OutC, PoolH, PoolW, PoolK, PoolK, PoolS, PoolS);
+        return;
+    }
+#endif
+
+    constexpr int band_hw = POOL_BAND_ROWS * OutW;
+    int prev_rows = 0;
+    CONV_POOL_BAND_LOOP: for (int p0 = 0; p0 < PoolH; p0 += POOL_TILE_ROWS) {
+        int p1 = (p0 + POOL_TILE_ROWS < PoolH) ? p0 + POOL_TILE_ROWS : PoolH;
+        int first = p0 * PoolS;                       // Conv row in band row 0
+        int last = (p1 - 1) * PoolS + PoolK;
+        int rows = ((last < OutH) ? last : OutH) - first;
+        int kept = (p0 > 0) ? PoolK - PoolS : 0;
+
+        // Reuse the rows the previous band already computed, then fill the rest
+        if (kept > 0) {
+            pool_band_carry(pool_buf, OutC, band_hw, OutW, prev_rows - kept, kept);
+        }
+        convolution_fixed_rows<InH, InW, InC, OutC, K, S, P>(
+            input, weights, biases, pool_buf + kept * OutW, band_hw,
+            first + kept, first + rows, apply_relu);
+        max_pool_band(pool_buf, rows, OutW, OutC, band_hw, output, PoolH, PoolW, p0, p1, PoolK, PoolS);
+        prev_rows = rows;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Fire Module (H x W preserved: squeeze 1x1 -> expand 1x1 + expand 3x3/P1)
+//--------------------------------------------------------------------------
+template<int H, int W, int InC, int SqueezeC, int Expand1x1C, int Expand3x3C>
+void fire_module_fixed(
+    const float input[InC * H * W],
+    float output[],                   // (Expand1x1C + Expand3x3C) * H * W
+    const float squeeze_weights[SqueezeC * InC],
+    const float squeeze_biases[SqueezeC],
+    const float expand1x1_weights[Expand1x1C * SqueezeC],
+    const float expand1x1_biases[Expand1x1C],
+    const float expand3x3_weights[Expand3x3C * SqueezeC * 9],
+    const float expand3x3_biases[Expand3x3C],
+    float squeeze_buf[])              // FIRE_SQUEEZE_BUF_SIZE (whole map or one band)
+{
+    static_assert(SqueezeC * (FIRE_TILE_ROWS + 2) * W <= FIRE_SQUEEZE_BUF_SIZE, "fire squeeze band too small");
+    static_assert(conv_out_dim(H, 3, 1, 1) == H, "expand3x3 must preserve H x W");
+
+#ifndef __SYNTHESIS__
+    // Host builds: the GEMM/Winograd backends run on whole maps, so they keep
+    // the full squeeze map; only the direct backend uses the fused bands below
+    if (conv_select_backend(SqueezeC, H, W, Expand3x3C, 3, 3, 1, 1, 1, 1) != CONV_BACKEND_DIRECT) {
+        static_assert(SqueezeC * H * W <= FIRE_SQUEEZE_BUF_SIZE, "fire squeeze buffer too small");
+
+        // 1. Squeeze Convolution (1x1) + ReLU
+        convolution_fixed<H, W, InC, SqueezeC, 1, 1, 0>(
+            input, squeeze_weights, squeeze_biases, squeeze_buf, true);
+
+        // 2./3. Expand 1x1 and 3x3 + ReLU, each straight into its channel
+        // slice of the output (no concatenation pass). Both only read the
+        // squeeze map, so they run as concurrent branches.
+        float* expand3x3_out = output + Expand1x1C * H * W;
+        parallel_branches((double)H * W * SqueezeC * (Expand1x1C + 9 * Expand3x3C), {
+            [&] {
+                convolution_fixed<H, W, SqueezeC, Expand1x1C, 1, 1, 0>(
+                    squeeze_buf, expand1x1_weights, expand1x1_biases, output, true);
+            },
+            [&] {
+                if (!winograd_conv3x3(squeeze_buf, expand3x3_weights, expand3x3_biases, expand3x3_out,
+                                      H, W, SqueezeC, Expand3x3C, true)) {
+                    convolution_fixed<H, W, SqueezeC, Expand3x3C, 3, 1, 1>(
+                        squeeze_buf, expand3x3_weights, expand3x3_biases, expand3x3_out, true);
+                }
+            }
+        });
+        return;
+    }
+#endif
+
+    // Tile-fused squeeze -> expand: squeeze_buf only ever holds one band
+    fire_module_rows(input, output, H, W, InC,
+                     squeeze_weights, squeeze_biases, SqueezeC,
+                     expand1x1_weights, expand1x1_biases, Expand1x1C,
+                     expand3x3_weights, expand3x3_biases, Expand3x3C,
+                     squeeze_buf);
+}
+
+//--------------------------------------------------------------------------
+// Classifier: 1x1 Convolution + ReLU + Global Average Pooling, Fused
+//--------------------------------------------------------------------------
+// One output channel at a time: its H*W conv results are accumulated in a
+// local row, then ReLU'd and summed straight into the logit, so the
+// OutC x H x W classifier map is never written out.
+template<int H, int W, int InC, int OutC>
+void classifier_gap_fixed(
+    const float input[InC * H * W],
+    const float weights[OutC * InC],
+    const float biases[OutC],
+    float output[OutC])
+{
+    constexpr int HW = H * W;
+
+#ifndef __SYNTHESIS__
+    // Host builds: the whole classifier as one GEMM, pooled block by block
+    if (conv_select_backend(InC, H, W, OutC, 1, 1, 1, 1, 0, 0) != CONV_BACKEND_DIRECT) {
+        pointwise_convolution_gap(input, weights, biases, output, HW, InC, OutC, 1);
+        return;
+    }
+#endif
+
+    CLS_OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
+        float acc[HW];
+        CLS_INIT_LOOP: for (int p = 0; p < HW; ++p) {
+#pragma HLS PIPELINE II=1
+            acc[p] = biases[oc];
+        }
+        CLS_IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
+            float w = weights[oc * InC + ic];
+            CLS_PIXEL_LOOP: for (int p = 0; p < HW; ++p) {
+#pragma HLS PIPELINE II=1
+                acc[p] += w * input[ic * HW + p];
+            }
+        }
+        float sum = 0.0f;
+        CLS_GAP_LOOP: for (int p = 0; p < HW; ++p) {
+            sum += relu_activation(acc[p]);
+        }
+        output[oc] = sum / (float)HW;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Fire Module + Max Pooling, Fused (PoolK x PoolK window, stride PoolS)
+//--------------------------------------------------------------------------
+template<int H, int W, int InC, int SqueezeC, int Expand1x1C, int Expand3x3C, int PoolK, int PoolS>
+void fire_module_pool_fixed(
+    const float input[InC * H * W],
+    float output[],                   // (Expand1x1C + Expand3x3C) * PoolH * PoolW
+    const float squeeze_weights[SqueezeC * InC],
+    const float squeeze_biases[SqueezeC],
+    const float expand1x1_weights[Expand1x1C * SqueezeC],
+    const float expand1x1_biases[Expand1x1C],
+    const float expand3x3_weights[Expand3x3C * SqueezeC * 9],
+    const float expand3x3_biases[Expand3x3C],
+    float squeeze_buf[],              // FIRE_SQUEEZE_BUF_SIZE (whole map or one band)
+    float pool_buf[])                 // One fire band (OutC * POOL_BAND_ROWS * W); a whole map on the host
+{
+    constexpr int PoolH = conv_out_dim(H, PoolK, PoolS, 0);
+    constexpr int PoolW = conv_out_dim(W, PoolK, PoolS, 0);
+    static_assert((POOL_TILE_ROWS - 1) * PoolS + PoolK <= POOL_BAND_ROWS, "pool band too short");
+    static_assert(PoolK >= PoolS, "pool windows must overlap or touch");
+
+#ifndef __SYNTHESIS__
+    // Host builds: same whole-map split as fire_module_fixed()
+    if (conv_select_backend(SqueezeC, H, W, Expand3x3C, 3, 3, 1, 1, 1, 1) != CONV_BACKEND_DIRECT) {
+        fire_module_fixed<H, W, InC, SqueezeC, Expand1x1C, Expand3x3C>(
+            input, pool_buf, squeeze_weights, squeeze_biases,
+            expand1x1_weights, expand1x1_biases, expand3x3_weights, expand3x3_biases, squeeze_buf);
+        max_pooling(pool_buf, output, H, W, Expand1x1C + Expand3x3C, PoolH, PoolW,
+                    PoolK, PoolK, PoolS, PoolS);
+        return;
+    }
+#endif
+
+    fire_module_pool_rows(input, output, H, W, InC,
+                          squeeze_weights, squeeze_biases, SqueezeC,
+                          expand1x1_weights, expand1x1_biases, Expand1x1C,
+                          expand3x3_weights, expand3x3_biases, Expand3x3C,
+                          PoolK, PoolS, PoolH, PoolW, squeeze_buf, pool_buf);
+}
+
+#endif // SQUEEZENET_FIXED_H
@@ -0,0 +1,175 @@
+#include <cmath>
+#include <cstdio>
+#include "squeezenet_fixed_point.h"
+#include "squeezenet_fixed.h" // For conv_out_dim
+#include "squeezenet_typed.h"
+#include "squeezenet_calibration.h" // For the range check
+
+// One layer's weights and biases in the blob
+struct FixedPointLayer {
+    const fixed_data_t* weights;
+    const fixed_data_t* biases;
+};
+
+// The layer at `offset`, which is advanced past it
+static FixedPointLayer fixed_point_layer(const fixed_data_t blob[], int& offset, int InC, int OutC, int K) {
+#pragma HLS INLINE
+    FixedPointLayer layer;
+    layer.weights = blob + offset;
+    layer.biases = blob + offset + OutC * InC * K * K;
+    offset += fixed_point_layer_size(InC, OutC, K);
+    return layer;
+}
+
+//--------------------------------------------------------------------------
+// Reentrant Fixed-Point SqueezeNet Implementation
+//--------------------------------------------------------------------------
+void squeezenet_fixed_point_inference(
+    FixedPointContext& ctx,
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+) {
+    typedef fixed_data_t T;
+    typedef fixed_acc_t Acc;
+
+    // --- Compile-Time Shape Checks ---
+    static_assert(conv_out_dim(INPUT_H, CONV1_KH, CONV1_S, CONV1_P) == CONV1_H_OUT, "conv1 shape");
+    static_assert(BUF_POOL1_SIZE <= FIXED_POINT_MAP_SIZE && BUF_FIRE2_SIZE <= FIXED_POINT_MAP_SIZE &&
+                  BUF_FIRE3_SIZE <= FIXED_POINT_MAP_SIZE && BUF_FIRE4_SIZE <= FIXED_POINT_MAP_SIZE &&
+                  BUF_FIRE6_SIZE <= FIXED_POINT_MAP_SIZE && BUF_FIRE8_SIZE <= FIXED_POINT_MAP_SIZE &&
+                  CONV10_H_OUT * CONV10_W_OUT * CONV10_C_OUT <= FIXED_POINT_MAP_SIZE, "map buffers");
+    static_assert(FIRE4_H_OUT * FIRE4_W_OUT * FIRE4_S1x1 <= MAX_FIRE_SQUEEZE_SIZE &&
+                  FIRE8_H_OUT * FIRE8_W_OUT * FIRE8_S1x1 <= MAX_FIRE_SQUEEZE_SIZE, "squeeze buffer");
+
+    T* map_a = ctx.map_a;
+    T* map_b = ctx.map_b;
+    int offset = 0; // Next layer in the weight blob
+
+    // Conv1 + ReLU, MaxPool1
+    FixedPointLayer conv1 = fixed_point_layer(weights, offset, INPUT_C, CONV1_C_OUT, CONV1_KH);
+    convolution<T, Acc>(input_image, conv1.weights, conv1.biases, map_a,
+                        INPUT_H, INPUT_W, INPUT_C, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
+                        CONV1_KH, CONV1_KW, CONV1_S, CONV1_S, CONV1_P, CONV1_P, true);
+    max_pooling<T>(map_a, map_b, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT, POOL1_H_OUT, POOL1_W_OUT,
+                   POOL1_K, POOL1_K, POOL1_S, POOL1_S);
+
+    // Fire n on an H x W map
+#define FIXED_POINT_FIRE(n, H, W, in, out) { \
+        FixedPointLayer squeeze = fixed_point_layer(weights, offset, FIRE##n##_C_IN, FIRE##n##_S1x1, 1); \
+        FixedPointLayer expand1x1 = fixed_point_layer(weights, offset, FIRE##n##_S1x1, FIRE##n##_E1x1, 1); \
+        FixedPointLayer expand3x3 = fixed_point_layer(weights, offset, FIRE##n##_S1x1, FIRE##n##_E3x3, 3); \
+        fire_module<T, Acc>(in, out, H, W, FIRE##n##_C_IN, H, W, FIRE##n##_C_OUT, \
+                            squeeze.weights, squeeze.biases, FIRE##n##_S1x1, \
+                            expand1x1.weights, expand1x1.biases, FIRE##n##_E1x1, \
+                            expand3x3.weights, expand3x3.biases, FIRE##n##_E3x3, ctx.squeeze); \
+    }
+
+    FIXED_POINT_FIRE(2, POOL1_H_OUT, POOL1_W_OUT, map_b, map_a)
+    FIXED_POINT_FIRE(3, FIRE2_H_OUT, FIRE2_W_OUT, map_a, map_b)
+    FIXED_POINT_FIRE(4, FIRE3_H_OUT, FIRE3_W_OUT, map_b, map_a)
+    max_pooling<T>(map_a, map_b, FIRE4_H_OUT, FIRE4_W_OUT, FIRE4_C_OUT, POOL4_H_OUT, POOL4_W_OUT,
+                   POOL4_K, POOL4_K, POOL4_S, POOL4_S);
+    FIXED_POINT_FIRE(5, POOL4_H_OUT, POOL4_W_OUT, map_b, map_a)
+    FIXED_POINT_FIRE(6, FIRE5_H_OUT, FIRE5_W_OUT, map_a, map_b)
+    FIXED_POINT_FIRE(7, FIRE6_H_OUT, FIRE6_W_OUT, map_b, map_a)
+    FIXED_POINT_FIRE(8, FIRE7_H_OUT, FIRE7_W_OUT, map_a, map_b)
+    max_pooling<T>(map_b, map_a, FIRE8_H_OUT, FIRE8_W_OUT, FIRE8_C_OUT, POOL8_H_OUT, POOL8_W_OUT,
+                   POOL8_K, POOL8_K, POOL8_S, POOL8_S);
+    FIXED_POINT_FIRE(9, POOL8_H_OUT, POOL8_W_OUT, map_a, map_b)
+#undef FIXED_POINT_FIRE
+
+    // Conv10 (Classifier) + ReLU, Global Average Pooling (as SqueezeNet())
+    FixedPointLayer conv10 = fixed_point_layer(weights, offset, CONV10_C_IN, CONV10_C_OUT, CONV10_KH);
+    convolution<T, Acc>(map_b, conv10.weights, conv10.biases, map_a,
+                        FIRE9_H_OUT, FIRE9_W_OUT, CONV10_C_IN, CONV10_H_OUT, CONV10_W_OUT, CONV10_C_OUT,
+                        CONV10_KH, CONV10_KW, CONV10_S, CONV10_S, CONV10_P, CONV10_P, true);
+    global_average_pooling<T, Acc>(map_a, output_logits, CONV10_H_OUT, CONV10_W_OUT, CONV10_C_OUT);
+}
+
+//--------------------------------------------------------------------------
+// Top-level Fixed-Point SqueezeNet Function
+//--------------------------------------------------------------------------
+void SqueezeNetFixedPoint(
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+) {
+    #pragma HLS INTERFACE m_axi     port=input_image   offset=slave bundle=gmem0
+    #pragma HLS INTERFACE m_axi     port=output_logits offset=slave bundle=gmem1
+    #pragma HLS INTERFACE m_axi     port=weights       offset=slave bundle=gmem2
+    #pragma HLS INTERFACE s_axilite port=return        bundle=control
+
+    static FixedPointContext default_context;
+    squeezenet_fixed_point_inference(default_context, input_image, weights, output_logits);
+}
+
+#ifndef __SYNTHESIS__
+//--------------------------------------------------------------------------
+// Weight Blob (Host)
+//--------------------------------------------------------------------------
+// Append one layer's weights, then its biases
+static void fixed_point_pack(fixed_data_t blob[], int& offset, const float weights[], const float biases[],
+                             int InC, int OutC, int K)
+{
+    const int n = OutC * InC * K * K;
+    for (int i = 0; i < n; ++i) blob[offset++] = fixed_data_t(weights[i]);
+    for (int i = 0; i < OutC; ++i) blob[offset++] = fixed_data_t(biases[i]);
+}
+
+void squeezenet_fixed_point_weights(fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS]) {
+    int offset = 0;
+    fixed_point_pack(weights, offset, conv1_weights, conv1_biases, INPUT_C, CONV1_C_OUT, CONV1_KH);
+#define FIXED_POINT_PACK_FIRE(n) \
+    fixed_point_pack(weights, offset, fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, \
+                     FIRE##n##_C_IN, FIRE##n##_S1x1, 1); \
+    fixed_point_pack(weights, offset, fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, \
+                     FIRE##n##_S1x1, FIRE##n##_E1x1, 1); \
+    fixed_point_pack(weights, offset, fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, \
+                     FIRE##n##_S1x1, FIRE##n##_E3x3, 3);
+    FIXED_POINT_PACK_FIRE(2)
+    FIXED_POINT_PACK_FIRE(3)
+    FIXED_POINT_PACK_FIRE(4)
+    FIXED_POINT_PACK_FIRE(5)
+    FIXED_POINT_PACK_FIRE(6)
+    FIXED_POINT_PACK_FIRE(7)
+    FIXED_POINT_PACK_FIRE(8)
+    FIXED_POINT_PACK_FIRE(9)
+#undef FIXED_POINT_PACK_FIRE
+    fixed_point_pack(weights, offset, conv10_weights, conv10_biases, CONV10_C_IN, CONV10_C_OUT, CONV10_KH);
+}
+
+//--------------------------------------------------------------------------
+// Range Check (Host)
+//--------------------------------------------------------------------------
+// Every map the fixed-point network stores, named as in the scale file
+#define FIXED_POINT_FIRE_NAMES(n) "fire" #n "/squeeze", "fire" #n "/expand1x1", "fire" #n "/expand3x3", "fire" #n
+static const char* const fixed_point_map_names[] = {
+    "input", "conv1", "pool1",
+    FIXED_POINT_FIRE_NAMES(2), FIXED_POINT_FIRE_NAMES(3), FIXED_POINT_FIRE_NAMES(4), "pool4",
+    FIXED_POINT_FIRE_NAMES(5), FIXED_POINT_FIRE_NAMES(6), FIXED_POINT_FIRE_NAMES(7), FIXED_POINT_FIRE_NAMES(8), "pool8",
+    FIXED_POINT_FIRE_NAMES(9),
+    "conv10", "logits",
+};
+#undef FIXED_POINT_FIRE_NAMES
+
+#define FIXED_POINT_NUM_MAPS ((int)(sizeof(fixed_point_map_names) / sizeof(fixed_point_map_names[0])))
+
+int squeezenet_fixed_point_check_ranges(const char* scale_path) {
+    float ranges[FIXED_POINT_NUM_MAPS];
+    if (!calibration_load_ranges(scale_path, fixed_point_map_names, FIXED_POINT_NUM_MAPS, ranges)) {
+        return -1;
+    }
+    // Largest fixed_data_t: 2^(I-1) less one step
+    const float limit = std::ldexp(1.0f, FIXED_DATA_I - 1) - std::ldexp(1.0f, FIXED_DATA_I - FIXED_DATA_W);
+    int saturating = 0;
+    for (int l = 0; l < FIXED_POINT_NUM_MAPS; ++l) {
+        if (ranges[l] > limit) {
+            fprintf(stderr, "fixed point: %s range %g saturates ap_fixed<%d,%d> (max %g)\n",
+                    fixed_point_map_names[l], ranges[l], FIXED_DATA_W, FIXED_DATA_I, limit);
+            ++saturating;
+        }
+    }
+    return saturating;
+}
+#endif // __SYNTHESIS__
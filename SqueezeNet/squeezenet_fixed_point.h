@@ -0,0 +1,85 @@
+#ifndef SQUEEZENET_FIXED_POINT_H
+#define SQUEEZENET_FIXED_POINT_H
+
+#include "squeezenet.h"
+#include "squeezenet_types.h"
+
+// ==========================================================================
+// === Fixed-Point SqueezeNet ===============================================
+// ==========================================================================
+// The SqueezeNet() layer sequence on the datatype-templated layers
+// (squeezenet_typed.h) at <fixed_data_t, fixed_acc_t>: ap_fixed<16,6> maps,
+// weights and biases and ap_fixed<36,16> sums (squeezenet_params.h).
+// SqueezeNetFixedPoint() is a second HLS top next to SqueezeNet(); under
+// plain g++ it runs on the ap_fixed stand-in with the same bits.
+//
+// The weights are one fixed_data_t blob read over AXI, in layer order (conv1,
+// fire2 squeeze/expand1x1/expand3x3 .. fire9, conv10), each layer's weights
+// followed by its biases. squeezenet_fixed_point_weights() rounds the float
+// arrays of squeezenet_weights.h into it on the host.
+//
+// Every layer shares the one format: the widths are template arguments of
+// the layers and the blob, fixed when the top is synthesized, and a
+// per-layer format would need one instantiation of each layer kernel per
+// layer. The calibration scale file is therefore not loaded by the top but
+// used on the host: squeezenet_fixed_point_check_ranges() reports the layers
+// whose calibrated activation range the format would saturate, which says
+// whether FIXED_DATA_I (params) must grow for a given set of weights.
+// ==========================================================================
+
+// Blob values of one layer, and of a fire module's three layers
+constexpr int fixed_point_layer_size(int InC, int OutC, int K) {
+    return OutC * InC * K * K + OutC;
+}
+
+constexpr int fixed_point_fire_size(int InC, int SqueezeC, int Expand1x1C, int Expand3x3C) {
+    return fixed_point_layer_size(InC, SqueezeC, 1) +
+           fixed_point_layer_size(SqueezeC, Expand1x1C, 1) +
+           fixed_point_layer_size(SqueezeC, Expand3x3C, 3);
+}
+
+#define FIXED_POINT_FIRE_SIZE(n) fixed_point_fire_size(FIRE##n##_C_IN, FIRE##n##_S1x1, FIRE##n##_E1x1, FIRE##n##_E3x3)
+
+// Values in the weight blob
+#define SQUEEZENET_FIXED_POINT_WEIGHTS (fixed_point_layer_size(INPUT_C, CONV1_C_OUT, CONV1_KH) + \
+    FIXED_POINT_FIRE_SIZE(2) + FIXED_POINT_FIRE_SIZE(3) + FIXED_POINT_FIRE_SIZE(4) + FIXED_POINT_FIRE_SIZE(5) + \
+    FIXED_POINT_FIRE_SIZE(6) + FIXED_POINT_FIRE_SIZE(7) + FIXED_POINT_FIRE_SIZE(8) + FIXED_POINT_FIRE_SIZE(9) + \
+    fixed_point_layer_size(CONV10_C_IN, CONV10_C_OUT, CONV10_KH))
+
+// Ping-pong map buffers: the largest map is conv1's output
+#define FIXED_POINT_MAP_SIZE BUF_CONV1_SIZE
+
+// Per-inference buffers of the fixed-point network
+struct FixedPointContext {
+    fixed_data_t map_a[FIXED_POINT_MAP_SIZE];
+    fixed_data_t map_b[FIXED_POINT_MAP_SIZE];
+    fixed_data_t squeeze[MAX_FIRE_SQUEEZE_SIZE]; // Fire squeeze outputs
+};
+
+// Reentrant fixed-point SqueezeNet on the caller's context
+void squeezenet_fixed_point_inference(
+    FixedPointContext& ctx,
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+);
+
+// HLS top; runs on a static default context, so it is not reentrant
+void SqueezeNetFixedPoint(
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
+    const fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS],   // Weight blob
+    fixed_data_t output_logits[NUM_CLASSES]                       // Output logits
+);
+
+#ifndef __SYNTHESIS__
+// Host: round the float weights (squeezenet_weights.h) into a blob
+void squeezenet_fixed_point_weights(fixed_data_t weights[SQUEEZENET_FIXED_POINT_WEIGHTS]);
+
+// Host: check a scale file (calibration_write() format) against the
+// format. Lists each layer whose calibrated range exceeds fixed_data_t's
+// largest value, where its maps saturate, on stderr and returns their
+// count; -1 if the file cannot be read or lacks one of the layers.
+int squeezenet_fixed_point_check_ranges(const char* scale_path);
+#endif
+
+#endif // SQUEEZENET_FIXED_POINT_H
@@ -0,0 +1,440 @@
+#include "squeezenet_gemm.h"
+#include "squeezenet_simd.h"
+#include "squeezenet_threads.h"
+#include "squeezenet_weight_store.h"
+
+#ifndef __SYNTHESIS__ // Host-side backend only; HLS synthesizes the direct loops in convolution()
+
+#include <algorithm> // For std::min
+#include <memory>    // For std::unique_ptr
+
+static ConvBackend conv_backend = CONV_BACKEND_AUTO;
+
+// Packed operand buffers (sized by the blocking parameters). packed_a is only
+// used for layers the weight store could not hold; tile_c holds one MC x NC
+// block of C for pointwise_convolution_gap(). Each thread gets its own set,
+// allocated on first use, so concurrent inferences never share them.
+struct GemmScratch {
+    float packed_a[SGEMM_MC * SGEMM_KC];
+    float packed_b[SGEMM_KC * SGEMM_NC];
+    float tile_c[SGEMM_MC * SGEMM_NC];
+};
+
+static GemmScratch& gemm_scratch() {
+    static thread_local std::unique_ptr<GemmScratch> scratch(new GemmScratch);
+    return *scratch;
+}
+
+void set_conv_backend(ConvBackend backend) {
+    conv_backend = backend;
+}
+
+ConvBackend conv_select_backend(
+    int InC, int OutH, int OutW, int OutC, int KH, int KW,
+    int StrideH, int StrideW, int PadH, int PadW)
+{
+    bool pointwise = (KH == 1 && KW == 1 && StrideH == 1 && StrideW == 1 &&
+                      PadH == 0 && PadW == 0);
+    if (conv_backend == CONV_BACKEND_DIRECT || conv_backend == CONV_BACKEND_GEMM) {
+        return conv_backend;
+    }
+    if (pointwise) {
+        return CONV_BACKEND_POINTWISE;
+    }
+    // Packing only pays off once there is at least one full register tile of
+    // work and a reduction deep enough to amortize it (e.g. not the 1x1-spatial
+    // classifier in Xception).
+    int K = InC * KH * KW;
+    if (OutC >= SGEMM_MR && OutH * OutW >= SGEMM_MIN_N && K >= 8) {
+        return CONV_BACKEND_GEMM;
+    }
+    return CONV_BACKEND_DIRECT;
+}
+
+//--------------------------------------------------------------------------
+// Packing
+//--------------------------------------------------------------------------
+// Pack rows [row0, row0+mc) x cols [pc, pc+kc) of the weight matrix into
+// MR-row panels: panel p holds A[row0+p*MR+i][pc+k] at [p][k][i].
+static void pack_a(const float weights[], int K, int M,
+                   int row0, int mc, int pc, int kc, float dst[])
+{
+    for (int ip = 0; ip < mc; ip += SGEMM_MR) {
+        for (int k = 0; k < kc; ++k) {
+            for (int i = 0; i < SGEMM_MR; ++i) {
+                int row = row0 + ip + i;
+                dst[i] = (ip + i < mc && row < M) ? weights[row * K + pc + k] : 0.0f;
+            }
+            dst += SGEMM_MR;
+        }
+    }
+}
+
+// Pack rows [pc, pc+kc) x cols [jc, jc+nc) of im2col(input) into NR-column
+// panels: panel p holds B[pc+k][jc+p*NR+j] at [p][k][j]. Column n is pixel
+// n % OutHW of image n / OutHW; input channel ic of image b starts at
+// input + ic * cstride + b * nstride. Padding taps and columns past nc are
+// written as zeros so the micro-kernel never branches.
+static void pack_b_im2col(const float input[], int cstride, int nstride,
+                          int InH, int InW, int OutW, int OutHW, int KH, int KW,
+                          int StrideH, int StrideW, int PadH, int PadW,
+                          int pc, int kc, int jc, int nc, int NR, float dst[])
+{
+    int ih_base[SIMD_MAX_NR];
+    int iw_base[SIMD_MAX_NR];
+    int image_base[SIMD_MAX_NR];
+
+    for (int jp = 0; jp < nc; jp += NR) {
+        int nr = std::min(NR, nc - jp);
+        for (int j = 0; j < nr; ++j) {
+            int n = jc + jp + j;
+            int pixel = n % OutHW;
+            image_base[j] = (n / OutHW) * nstride;
+            ih_base[j] = (pixel / OutW) * StrideH - PadH;
+            iw_base[j] = (pixel % OutW) * StrideW - PadW;
+        }
+
+        // Walk k = ic*KH*KW + kh*KW + kw incrementally
+        int ic = pc / (KH * KW);
+        int kh = (pc / KW) % KH;
+        int kw = pc % KW;
+        for (int k = 0; k < kc; ++k) {
+            const float* plane = input + ic * cstride;
+            for (int j = 0; j < nr; ++j) {
+                int ih = ih_base[j] + kh;
+                int iw = iw_base[j] + kw;
+                dst[j] = (ih >= 0 && ih < InH && iw >= 0 && iw < InW) ?
+                         plane[image_base[j] + ih * InW + iw] : 0.0f;
+            }
+            for (int j = nr; j < NR; ++j) {
+                dst[j] = 0.0f;
+            }
+            dst += NR;
+
+            if (++kw == KW) {
+                kw = 0;
+                if (++kh == KH) {
+                    kh = 0;
+                    ++ic;
+                }
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Micro-kernel: C[mr x nr] (+)= A_panel * B_panel
+//--------------------------------------------------------------------------
+// B rows are ldb apart (NR for a packed panel, H*W when reading a CHW map in
+// place). The first K block starts from the bias, later blocks accumulate
+// onto C, and ReLU is applied once the last K block has been added.
+// Full tiles go straight to the ISA kernel; edge tiles are computed into a
+// scratch tile and only the valid mr x nr corner is merged into C.
+static void sgemm_micro_kernel(const SimdKernels& simd,
+                               int kc, const float A[], const float B[], int ldb,
+                               float C[], int ldc, int mr, int nr,
+                               const float bias[], bool accumulate, bool apply_relu)
+{
+    if (mr == SGEMM_MR && nr == simd.sgemm_nr) {
+        simd.sgemm_tile(kc, A, B, ldb, C, ldc, bias, accumulate, apply_relu);
+        return;
+    }
+
+    float tile[SGEMM_MR * SIMD_MAX_NR];
+    simd.sgemm_tile(kc, A, B, ldb, tile, simd.sgemm_nr, 0, false, false);
+
+    for (int i = 0; i < mr; ++i) {
+        float init = bias ? bias[i] : 0.0f;
+        for (int j = 0; j < nr; ++j) {
+            float v = tile[i * simd.sgemm_nr + j] + (accumulate ? C[i * ldc + j] : init);
+            if (apply_relu && v < 0.0f) {
+                v = 0.0f;
+            }
+            C[i * ldc + j] = v;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Parallel Work Split
+//--------------------------------------------------------------------------
+// An M x N GEMM is cut into (row block x column tile) items for the thread
+// pool, sized from the layer's M*N*K multiply-adds (parallel_task_count()).
+// Columns are split first, in whole NR panels, since every column tile packs
+// its own B; rows are split, in whole MR panels, only when the map has too
+// few columns to feed every thread (the 13x13 fire modules). With one thread
+// there is a single item covering the whole GEMM.
+struct GemmTiling {
+    int row_tile, col_tile;   // Item size (multiples of MR / NR)
+    int row_tiles, col_tiles; // Item grid
+};
+
+static GemmTiling gemm_tiling(int M, int N, int K, int NR, bool split_columns) {
+    GemmTiling t;
+    int tasks = parallel_task_count((double)M * N * K);
+    // An empty M or N still counts one panel, so the grid keeps one (empty)
+    // item: no zero divisors, and tiles with per-row setup still run it
+    int col_panels = std::max(1, (N + NR - 1) / NR);
+    int row_panels = std::max(1, (M + SGEMM_MR - 1) / SGEMM_MR);
+
+    t.col_tiles = split_columns ? std::min(tasks, col_panels) : 1;
+    t.col_tile = (col_panels + t.col_tiles - 1) / t.col_tiles * NR;
+    t.col_tiles = std::max(1, (N + t.col_tile - 1) / t.col_tile);
+
+    t.row_tiles = std::min((tasks + t.col_tiles - 1) / t.col_tiles, row_panels);
+    t.row_tile = (row_panels + t.row_tiles - 1) / t.row_tiles * SGEMM_MR;
+    t.row_tiles = std::max(1, (M + t.row_tile - 1) / t.row_tile);
+    return t;
+}
+
+// Run tile(i0, i1, j0, j1) over every item of the split, on the thread pool
+template<class Tile>
+static void gemm_parallel(int M, int N, int K, int NR, bool split_columns, Tile tile) {
+    const GemmTiling t = gemm_tiling(M, N, K, NR, split_columns);
+    parallel_for(t.row_tiles * t.col_tiles, (double)t.row_tile * t.col_tile * K,
+        [&](int begin, int end) {
+            for (int item = begin; item < end; ++item) {
+                int i0 = (item / t.col_tiles) * t.row_tile;
+                int j0 = (item % t.col_tiles) * t.col_tile;
+                tile(i0, std::min(i0 + t.row_tile, M), j0, std::min(j0 + t.col_tile, N));
+            }
+        });
+}
+
+//--------------------------------------------------------------------------
+// im2col + Blocked SGEMM Convolution
+//--------------------------------------------------------------------------
+void convolution_gemm(
+    const float input[], const float weights[], const float biases[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu)
+{
+    convolution_gemm_batch(input, weights, biases, output, 1, InH * InW, 0,
+                           InH, InW, InC, OutH, OutW, OutC,
+                           KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
+}
+
+// All images share one GEMM: their output pixels are just more columns, so
+// every packed weight block is reused across the whole batch.
+void convolution_gemm_batch(
+    const float input[], const float weights[], const float biases[], float output[],
+    int batch, int in_cstride, int in_nstride,
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu)
+{
+    const int M = OutC;
+    const int N = batch * OutH * OutW;
+    const int K = InC * KH * KW;
+    const int ldc = N;
+    const SimdKernels& simd = simd_kernels();
+    const int NR = simd.sgemm_nr;
+    const float* prepacked = weight_store_gemm_panels(weights, M, K);
+    const int Mpad = WEIGHT_STORE_PANELS(M, 1);
+
+    // Rows [i0, i1) x columns [j0, j1) of C; packing buffers are per thread
+    gemm_parallel(M, N, K, NR, true, [&](int i0, int i1, int j0, int j1) {
+        GemmScratch& scratch = gemm_scratch();
+        float* packed_a = scratch.packed_a;
+        float* packed_b = scratch.packed_b;
+
+        for (int jc = j0; jc < j1; jc += SGEMM_NC) {
+            int nc = std::min(SGEMM_NC, j1 - jc);
+
+            for (int pc = 0; pc < K; pc += SGEMM_KC) {
+                int kc = std::min(SGEMM_KC, K - pc);
+                bool first = (pc == 0);
+                bool last = (pc + kc == K);
+
+                pack_b_im2col(input, in_cstride, in_nstride, InH, InW, OutW, OutH * OutW, KH, KW,
+                              StrideH, StrideW, PadH, PadW,
+                              pc, kc, jc, nc, NR, packed_b);
+
+                for (int ic = i0; ic < i1; ic += SGEMM_MC) {
+                    int mc = std::min(SGEMM_MC, i1 - ic);
+                    const float* A = prepacked ? prepacked + pc * Mpad + ic * kc : packed_a;
+                    if (!prepacked) {
+                        pack_a(weights, K, M, ic, mc, pc, kc, packed_a);
+                    }
+
+                    // Macro-kernel: sweep the packed block one register tile at a time
+                    for (int jr = 0; jr < nc; jr += NR) {
+                        int nr = std::min(NR, nc - jr);
+                        for (int ir = 0; ir < mc; ir += SGEMM_MR) {
+                            int mr = std::min(SGEMM_MR, mc - ir);
+                            int row = ic + ir;
+                            sgemm_micro_kernel(simd, kc, A + ir * kc, packed_b + jr * kc, NR,
+                                               output + row * ldc + jc + jr, ldc, mr, nr,
+                                               (first && biases) ? biases + row : 0,
+                                               !first, last && apply_relu);
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Pointwise (1x1) Convolution Engine
+//--------------------------------------------------------------------------
+void pointwise_convolution(
+    const float input[], const float weights[], const float biases[], float output[],
+    int HW, int InC, int OutC, bool apply_relu)
+{
+    const int M = OutC;
+    const int N = HW;
+    const int K = InC;
+    const SimdKernels& simd = simd_kernels();
+    const int NR = simd.sgemm_nr;
+    const float* prepacked = weight_store_gemm_panels(weights, M, K);
+    const int Mpad = WEIGHT_STORE_PANELS(M, 1);
+
+    gemm_parallel(M, N, K, NR, true, [&](int i0, int i1, int j0, int j1) {
+        GemmScratch& scratch = gemm_scratch();
+        float* packed_a = scratch.packed_a;
+        float* packed_b = scratch.packed_b;
+
+        // Columns are taken NC at a time (as in convolution_gemm()) so the block
+        // of C that the KC slices accumulate into stays in cache however many
+        // pixels (or batched images) the map has.
+        for (int jc = j0; jc < j1; jc += SGEMM_NC) {
+            int nc = std::min(SGEMM_NC, j1 - jc);
+
+            for (int pc = 0; pc < K; pc += SGEMM_KC) {
+                int kc = std::min(SGEMM_KC, K - pc);
+                bool first = (pc == 0);
+                bool last = (pc + kc == K);
+
+                for (int ic = i0; ic < i1; ic += SGEMM_MC) {
+                    int mc = std::min(SGEMM_MC, i1 - ic);
+                    const float* A = prepacked ? prepacked + pc * Mpad + ic * kc : packed_a;
+                    if (!prepacked) {
+                        pack_a(weights, K, M, ic, mc, pc, kc, packed_a);
+                    }
+
+                    // Each kc x NR slice of the input is read in place and reused
+                    // from L1 by every register tile of the packed A block.
+                    for (int jr = jc; jr < jc + nc; jr += NR) {
+                        int nr = std::min(NR, jc + nc - jr);
+                        const float* B = input + pc * N + jr;
+                        int ldb = N;
+                        if (nr < NR) {
+                            // Ragged right edge: copy into a zero-padded panel so
+                            // the micro-kernel never reads past the end of the map
+                            for (int k = 0; k < kc; ++k) {
+                                for (int j = 0; j < NR; ++j) {
+                                    packed_b[k * NR + j] = (j < nr) ? B[k * N + j] : 0.0f;
+                                }
+                            }
+                            B = packed_b;
+                            ldb = NR;
+                        }
+
+                        for (int ir = 0; ir < mc; ir += SGEMM_MR) {
+                            int mr = std::min(SGEMM_MR, mc - ir);
+                            int row = ic + ir;
+                            sgemm_micro_kernel(simd, kc, A + ir * kc, B, ldb,
+                                               output + row * N + jr, N, mr, nr,
+                                               (first && biases) ? biases + row : 0,
+                                               !first, last && apply_relu);
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Pointwise Convolution + ReLU + Global Average Pooling
+//--------------------------------------------------------------------------
+// Same GEMM as pointwise_convolution(), but the output-channel block is the
+// outer loop: each MC x NC block of C is finished (all KC slices, bias and
+// ReLU) in tile_c and summed into its logits before the next block starts.
+// A block of columns can span several images; each image's part is summed
+// into its own logits.
+void pointwise_convolution_gap(
+    const float input[], const float weights[], const float biases[], float output[],
+    int HW, int InC, int OutC, int batch)
+{
+    const int M = OutC;
+    const int N = batch * HW;
+    const int K = InC;
+    const SimdKernels& simd = simd_kernels();
+    const int NR = simd.sgemm_nr;
+    const float* prepacked = weight_store_gemm_panels(weights, M, K);
+    const int Mpad = WEIGHT_STORE_PANELS(M, 1);
+
+    // Only output channels are split: each item owns whole logits
+    gemm_parallel(M, N, K, NR, false, [&](int i0, int i1, int, int) {
+        GemmScratch& scratch = gemm_scratch();
+        float* packed_a = scratch.packed_a;
+        float* packed_b = scratch.packed_b;
+        float* tile_c = scratch.tile_c;
+
+        for (int ic = i0; ic < i1; ic += SGEMM_MC) {
+            int mc = std::min(SGEMM_MC, i1 - ic);
+            for (int b = 0; b < batch; ++b) {
+                for (int i = 0; i < mc; ++i) {
+                    output[b * M + ic + i] = 0.0f;
+                }
+            }
+
+            for (int jc = 0; jc < N; jc += SGEMM_NC) {
+                int nc = std::min(SGEMM_NC, N - jc);
+
+                for (int pc = 0; pc < K; pc += SGEMM_KC) {
+                    int kc = std::min(SGEMM_KC, K - pc);
+                    bool first = (pc == 0);
+                    bool last = (pc + kc == K);
+                    const float* A = prepacked ? prepacked + pc * Mpad + ic * kc : packed_a;
+                    if (!prepacked) {
+                        pack_a(weights, K, M, ic, mc, pc, kc, packed_a);
+                    }
+
+                    for (int jr = 0; jr < nc; jr += NR) {
+                        int nr = std::min(NR, nc - jr);
+                        const float* B = input + pc * N + jc + jr;
+                        int ldb = N;
+                        if (nr < NR) {
+                            // Ragged right edge, as in pointwise_convolution()
+                            for (int k = 0; k < kc; ++k) {
+                                for (int j = 0; j < NR; ++j) {
+                                    packed_b[k * NR + j] = (j < nr) ? B[k * N + j] : 0.0f;
+                                }
+                            }
+                            B = packed_b;
+                            ldb = NR;
+                        }
+
+                        for (int ir = 0; ir < mc; ir += SGEMM_MR) {
+                            int mr = std::min(SGEMM_MR, mc - ir);
+                            int row = ic + ir;
+                            sgemm_micro_kernel(simd, kc, A + ir * kc, B, ldb,
+                                               tile_c + ir * nc + jr, nc, mr, nr,
+                                               (first && biases) ? biases + row : 0,
+                                               !first, last);
+                        }
+                    }
+                }
+
+                // Pool the finished (ReLU'd) block, image by image
+                for (int b = jc / HW; b * HW < jc + nc; ++b) {
+                    int lo = std::max(jc, b * HW);
+                    int hi = std::min(jc + nc, (b + 1) * HW);
+                    for (int i = 0; i < mc; ++i) {
+                        output[b * M + ic + i] += simd.vsum(hi - lo, tile_c + i * nc + lo - jc);
+                    }
+                }
+            }
+
+            for (int b = 0; b < batch; ++b) {
+                for (int i = 0; i < mc; ++i) {
+                    output[b * M + ic + i] /= (float)HW;
+                }
+            }
+        }
+    });
+}
+
+#endif // __SYNTHESIS__
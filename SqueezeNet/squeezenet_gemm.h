@@ -0,0 +1,99 @@
+#ifndef SQUEEZENET_GEMM_H
+#define SQUEEZENET_GEMM_H
+
+// ==========================================================================
+// === im2col + Blocked SGEMM Convolution Backend (Host Builds Only) ========
+// ==========================================================================
+// Lowers a convolution onto C = A * B where
+//   A = weights      (OutC x InC*KH*KW, row-major exactly as stored)
+//   B = im2col(input)(InC*KH*KW x OutH*OutW, packed on the fly)
+//   C = output       (OutC x OutH*OutW, i.e. the usual CHW output map)
+// The GEMM is blocked BLIS-style: B is packed in KC x NC blocks (L3/L2),
+// A in MC x KC blocks (L2), and an MR x NR register tile is computed by the
+// micro-kernel out of L1. The HLS synthesis flow never sees this code.
+//
+// 1x1 / stride-1 / pad-0 layers skip im2col entirely: the CHW input already
+// is the [InC x H*W] B matrix, so pointwise_convolution() feeds it straight
+// into the same register-blocked micro-kernel.
+//
+// The register tile width NR depends on the instruction set and is taken
+// from the active SIMD kernel table (squeezenet_simd.h) at run time.
+// ==========================================================================
+
+// --- Blocking Parameters ---
+#define SGEMM_MR 6    // Micro-kernel rows (output channels per register tile)
+#define SGEMM_MIN_N 16 // Fewest output pixels worth packing for (one scalar/AVX2 tile)
+#define SGEMM_KC 256  // Depth of a packed panel: MR*KC + KC*NR floats stay in L1/L2
+#define SGEMM_MC 96   // Rows of a packed A block: MC*KC floats = 96 KB (L2)
+#define SGEMM_NC 2048 // Columns of a packed B block: KC*NC floats = 2 MB (L3)
+
+// Convolution backend selection
+enum ConvBackend {
+    CONV_BACKEND_AUTO,      // Pick per layer from the layer shape (default)
+    CONV_BACKEND_DIRECT,    // Always use the direct loop nest in convolution()
+    CONV_BACKEND_GEMM,      // Always lower to im2col + SGEMM
+    CONV_BACKEND_POINTWISE  // 1x1 GEMM engine (picked automatically for 1x1, S=1, P=0)
+};
+
+// Override the per-layer backend choice (mainly for testing/benchmarking)
+void set_conv_backend(ConvBackend backend);
+
+// Backend convolution() uses for a layer of the given shape
+ConvBackend conv_select_backend(
+    int InC, int OutH, int OutW, int OutC, int KH, int KW,
+    int StrideH, int StrideW, int PadH, int PadW);
+
+// im2col + blocked SGEMM convolution (same contract as convolution())
+void convolution_gemm(
+    const float input[],         // Input feature map (flattened)
+    const float weights[],       // Kernel weights (flattened: OutC, InC, KH, KW)
+    const float biases[],        // Kernel biases (size: OutC), may be NULL
+    float output[],              // Output feature map (flattened)
+    int InH, int InW, int InC,   // Input dimensions H, W, C
+    int OutH, int OutW, int OutC,// Output dimensions H, W, C
+    int KH, int KW,              // Kernel dimensions H, W
+    int StrideH, int StrideW,    // Stride in H, W
+    int PadH, int PadW,          // Padding in H, W
+    bool apply_relu              // Flag to apply ReLU activation
+);
+
+// Batched im2col + SGEMM: `batch` images in one GEMM with batch*OutH*OutW
+// columns, so each packed weight block is reused by every image. Input
+// channel c of image n starts at input + c * in_cstride + n * in_nstride
+// (in_cstride = InH*InW, in_nstride = InC*InH*InW for separate CHW images);
+// the output is OutC x batch x OutH x OutW.
+void convolution_gemm_batch(
+    const float input[], const float weights[], const float biases[], float output[],
+    int batch, int in_cstride, int in_nstride,
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW,
+    bool apply_relu);
+
+// Pointwise (1x1, stride 1, pad 0) convolution engine:
+// output[OutC x HW] = weights[OutC x InC] * input[InC x HW], bias + ReLU fused
+void pointwise_convolution(
+    const float input[],         // Input feature map (flattened: InC, H*W)
+    const float weights[],       // Kernel weights (flattened: OutC, InC)
+    const float biases[],        // Kernel biases (size: OutC), may be NULL
+    float output[],              // Output feature map (flattened: OutC, H*W)
+    int HW,                      // Spatial size H*W (same for input and output)
+    int InC, int OutC,           // Channel counts
+    bool apply_relu              // Flag to apply ReLU activation
+);
+
+// Pointwise convolution + ReLU + global average pooling (the classifier):
+// output[n*OutC + oc] = mean over the HW pixels p of image n of
+// relu(bias[oc] + weights[oc] . input[:, n*HW + p]).
+// Output channels are computed one MC-row block at a time into a per-thread
+// tile and reduced right away, so the OutC x batch*HW map is never stored.
+void pointwise_convolution_gap(
+    const float input[],         // Input feature maps (flattened: InC, batch*H*W)
+    const float weights[],       // Kernel weights (flattened: OutC, InC)
+    const float biases[],        // Kernel biases (size: OutC), may be NULL
+    float output[],              // Pooled outputs (size: batch*OutC)
+    int HW,                      // Spatial size H*W of one image
+    int InC, int OutC,           // Channel counts
+    int batch                    // Images side by side in the columns (1 for one map)
+);
+
+#endif // SQUEEZENET_GEMM_H
@@ -0,0 +1,572 @@
+#include "squeezenet_nchwc.h"
+#include "squeezenet.h"
+#include "squeezenet_arena.h"
+#include "squeezenet_threads.h"
+#include "squeezenet_weight_store.h"
+
+#ifndef __SYNTHESIS__ // Host-side pipeline only; HLS keeps the CHW design
+
+#include <algorithm> // For std::min, std::max, std::fill
+#include <cfloat>    // For FLT_MAX
+#include <cstring>   // For memcpy
+#include <memory>    // For std::unique_ptr
+
+// Largest OIhw8i8o tensor (Fire8/9 expand3x3, or conv10 at 1000 classes), for
+// layers the store cannot hold
+#define NCHWC_FIRE9_E3x3_WEIGHTS (FIRE9_E3x3 * FIRE9_S1x1 * 9)
+#define NCHWC_CONV10_WEIGHTS ((CONV10_C_OUT + NCHWC_BLOCK - 1) / NCHWC_BLOCK * NCHWC_BLOCK * CONV10_C_IN)
+#define NCHWC_MAX_LAYER_WEIGHTS (NCHWC_FIRE9_E3x3_WEIGHTS > NCHWC_CONV10_WEIGHTS ? \
+                                 NCHWC_FIRE9_E3x3_WEIGHTS : NCHWC_CONV10_WEIGHTS)
+
+static ActivationLayout current_layout = ACTIVATION_LAYOUT_NCHW8C;
+
+// Per-thread fallback packing buffer (allocated on a thread's first use)
+struct Nchw8cScratch {
+    float weights[NCHWC_MAX_LAYER_WEIGHTS];
+};
+
+static float* nchw8c_weight_scratch() {
+    static thread_local std::unique_ptr<Nchw8cScratch> scratch(new Nchw8cScratch);
+    return scratch->weights;
+}
+
+void set_activation_layout(ActivationLayout layout) {
+    current_layout = layout;
+}
+
+ActivationLayout activation_layout() {
+    return current_layout;
+}
+
+Nchw8cMap nchw8c_map(float buf[], int H, int W, int C, int halo) {
+    Nchw8cMap map;
+    map.H = H;
+    map.W = W;
+    map.C = C;
+    map.rstride = (W + 2 * halo) * NCHWC_BLOCK;
+    map.cstride = (H + 2 * halo) * map.rstride;
+    map.data = buf + halo * map.rstride + halo * NCHWC_BLOCK;
+    return map;
+}
+
+void nchw8c_zero_halo(const Nchw8cMap& map, int halo) {
+    const int row_floats = (map.W + 2 * halo) * NCHWC_BLOCK;
+    for (int cb = 0; cb < nchw8c_blocks(map.C); ++cb) {
+        float* plane = map.data + cb * map.cstride;
+        for (int r = 1; r <= halo; ++r) {
+            float* top = plane - r * map.rstride - halo * NCHWC_BLOCK;
+            float* bottom = plane + (map.H - 1 + r) * map.rstride - halo * NCHWC_BLOCK;
+            std::fill(top, top + row_floats, 0.0f);
+            std::fill(bottom, bottom + row_floats, 0.0f);
+        }
+        for (int h = 0; h < map.H; ++h) {
+            float* row = plane + h * map.rstride;
+            std::fill(row - halo * NCHWC_BLOCK, row, 0.0f);
+            std::fill(row + map.W * NCHWC_BLOCK, row + (map.W + halo) * NCHWC_BLOCK, 0.0f);
+        }
+    }
+}
+
+void nchw8c_from_chw(const float input[], const Nchw8cMap& output) {
+    const int HW = output.H * output.W;
+    for (int cb = 0; cb < nchw8c_blocks(output.C); ++cb) {
+        for (int h = 0; h < output.H; ++h) {
+            float* dst = output.data + cb * output.cstride + h * output.rstride;
+            for (int w = 0; w < output.W; ++w) {
+                for (int l = 0; l < NCHWC_BLOCK; ++l) {
+                    int c = cb * NCHWC_BLOCK + l;
+                    dst[w * NCHWC_BLOCK + l] = (c < output.C) ? input[c * HW + h * output.W + w] : 0.0f;
+                }
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Direct Convolution
+//--------------------------------------------------------------------------
+void convolution_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    const Nchw8cMap& output, int K, int S, int P, bool apply_relu)
+{
+    const SimdKernels& simd = simd_kernels();
+    const int ICB = nchw8c_blocks(input.C);
+    const int OCB = nchw8c_blocks(output.C);
+    // Padding lanes hold zero weights, so they only need skipping for speed
+    const int lanes = std::min(input.C, NCHWC_BLOCK);
+    const int block_weights = ICB * K * K * NCHWC_BLOCK * NCHWC_BLOCK;
+
+    const float* w = weight_store_oihw8i8o(weights, output.C, input.C, K, K);
+    if (!w) {
+        // Store disabled or full: pack into the scratch buffer for this call
+        float* weight_scratch = nchw8c_weight_scratch();
+        float* dst = weight_scratch;
+        for (int ocb = 0; ocb < OCB; ++ocb) {
+            for (int icb = 0; icb < ICB; ++icb) {
+                for (int k = 0; k < K * K; ++k) {
+                    for (int i = 0; i < NCHWC_BLOCK; ++i) {
+                        for (int o = 0; o < NCHWC_BLOCK; ++o) {
+                            int oc = ocb * NCHWC_BLOCK + o;
+                            int ic = icb * NCHWC_BLOCK + i;
+                            *dst++ = (oc < output.C && ic < input.C) ?
+                                weights[(oc * input.C + ic) * K * K + k] : 0.0f;
+                        }
+                    }
+                }
+            }
+        }
+        w = weight_scratch;
+    }
+
+    // Work items are (output channel block x band of output rows). Rows are
+    // only split when there are fewer channel blocks than tasks.
+    const double row_cost = (double)output.W * NCHWC_BLOCK * ICB * lanes * K * K;
+    const int tasks = parallel_task_count(row_cost * output.H * OCB);
+    const int row_tiles = std::min((tasks + OCB - 1) / OCB, output.H);
+    const int row_tile = (output.H + row_tiles - 1) / row_tiles;
+
+    parallel_for(OCB * row_tiles, row_cost * row_tile, [&](int begin, int end) {
+        for (int item = begin; item < end; ++item) {
+            int ocb = item / row_tiles;
+            int oh0 = (item % row_tiles) * row_tile;
+            int oh1 = std::min(oh0 + row_tile, output.H);
+            float bias8[NCHWC_BLOCK];
+            for (int o = 0; o < NCHWC_BLOCK; ++o) {
+                int oc = ocb * NCHWC_BLOCK + o;
+                bias8[o] = (oc < output.C && biases) ? biases[oc] : 0.0f;
+            }
+            const float* w_block = w + ocb * block_weights;
+
+            for (int oh = oh0; oh < oh1; ++oh) {
+                const float* in_row = input.data + (oh * S - P) * input.rstride;
+                float* out_row = output.data + ocb * output.cstride + oh * output.rstride;
+                for (int ow = 0; ow < output.W; ow += NCHWC_TILE) {
+                    int n = std::min(NCHWC_TILE, output.W - ow);
+                    simd.conv_nchw8c(in_row + (ow * S - P) * NCHWC_BLOCK,
+                                     input.cstride, input.rstride, S,
+                                     w_block, ICB, lanes, K, K, n,
+                                     bias8, out_row + ow * NCHWC_BLOCK, apply_relu);
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Max Pooling
+//--------------------------------------------------------------------------
+// 3x3/stride-2: separable, like max_pooling_simd(). Each input row's
+// horizontal maxima (8 lanes per pixel) are computed once, and the row shared
+// by two neighbouring windows is carried over to the next output row.
+static void max_pooling_3x3s2_nchw8c(const Nchw8cMap& input, const Nchw8cMap& output) {
+    const SimdKernels& simd = simd_kernels();
+    const int out_floats = output.W * NCHWC_BLOCK;
+
+    // Channel blocks are independent work items
+    parallel_for(nchw8c_blocks(input.C), (double)output.H * out_floats * 9, [&](int cb0, int cb1) {
+        float h_carry[SIMD_MAX_ROW_WIDTH * NCHWC_BLOCK];
+        float h_row[SIMD_MAX_ROW_WIDTH * NCHWC_BLOCK];
+
+        for (int cb = cb0; cb < cb1; ++cb) {
+            const float* plane = input.data + cb * input.cstride;
+            for (int oh = 0; oh < output.H; ++oh) {
+                float* out = output.data + cb * output.cstride + oh * output.rstride;
+                int ih0 = oh * 2;
+                int rows = std::min(3, input.H - ih0);
+                if (oh == 0) {
+                    max_pool_row_3s2(plane, input.W, NCHWC_BLOCK, h_carry, output.W);
+                }
+                if (rows == 1) {
+                    memcpy(out, h_carry, out_floats * sizeof(float));
+                    continue;
+                }
+                max_pool_row_3s2(plane + (ih0 + 1) * input.rstride, input.W, NCHWC_BLOCK, h_row, output.W);
+                simd.vmax(out_floats, h_carry, h_row, out);
+                if (rows == 3) {
+                    max_pool_row_3s2(plane + (ih0 + 2) * input.rstride, input.W, NCHWC_BLOCK, h_carry, output.W);
+                    simd.vmax(out_floats, out, h_carry, out);
+                }
+            }
+        }
+    });
+}
+
+// Other windows: vertical max over the window rows (vectorized over whole
+// rows), then a horizontal max over KW pixels, 8 lanes at a time.
+void max_pooling_nchw8c(const Nchw8cMap& input, const Nchw8cMap& output, int K, int S) {
+    if (K == 3 && S == 2) {
+        max_pooling_3x3s2_nchw8c(input, output);
+        return;
+    }
+
+    const SimdKernels& simd = simd_kernels();
+    const int row_floats = input.W * NCHWC_BLOCK;
+
+    parallel_for(nchw8c_blocks(input.C), (double)output.H * (K * row_floats + output.W * K * NCHWC_BLOCK),
+                 [&](int cb0, int cb1) {
+        float row_max[SIMD_MAX_ROW_WIDTH * NCHWC_BLOCK];
+
+        for (int cb = cb0; cb < cb1; ++cb) {
+            const float* plane = input.data + cb * input.cstride;
+            for (int oh = 0; oh < output.H; ++oh) {
+                float* out = output.data + cb * output.cstride + oh * output.rstride;
+                int ih0 = oh * S;
+                int rows = std::min(K, input.H - ih0);
+                memcpy(row_max, plane + ih0 * input.rstride, row_floats * sizeof(float));
+                for (int r = 1; r < rows; ++r) {
+                    simd.vmax(row_floats, row_max, plane + (ih0 + r) * input.rstride, row_max);
+                }
+
+                for (int ow = 0; ow < output.W; ++ow) {
+                    int iw0 = ow * S;
+                    int taps = std::min(K, input.W - iw0);
+                    float m[NCHWC_BLOCK];
+                    for (int l = 0; l < NCHWC_BLOCK; ++l) m[l] = -FLT_MAX;
+                    for (int kw = 0; kw < taps; ++kw) {
+                        const float* px = row_max + (iw0 + kw) * NCHWC_BLOCK;
+                        for (int l = 0; l < NCHWC_BLOCK; ++l) m[l] = std::max(m[l], px[l]);
+                    }
+                    memcpy(out + ow * NCHWC_BLOCK, m, sizeof(m));
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Classifier: 1x1 Convolution + ReLU + Global Average Pooling, Fused
+//--------------------------------------------------------------------------
+void classifier_gap_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    float output[], const Nchw8cMap& row_buf)
+{
+    const float scale = 1.0f / (float)(input.H * input.W);
+    for (int c = 0; c < row_buf.C; ++c) {
+        output[c] = 0.0f;
+    }
+    for (int h = 0; h < input.H; ++h) {
+        convolution_nchw8c(nchw8c_rows(input, h, 1), weights, biases, row_buf, 1, 1, 0, true);
+        for (int cb = 0; cb < nchw8c_blocks(row_buf.C); ++cb) {
+            const float* row = row_buf.data + cb * row_buf.cstride;
+            int lanes = std::min(NCHWC_BLOCK, row_buf.C - cb * NCHWC_BLOCK);
+            for (int w = 0; w < row_buf.W; ++w) {
+                for (int l = 0; l < lanes; ++l) output[cb * NCHWC_BLOCK + l] += row[w * NCHWC_BLOCK + l];
+            }
+        }
+    }
+    for (int c = 0; c < row_buf.C; ++c) {
+        output[c] *= scale;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Global Average Pooling
+//--------------------------------------------------------------------------
+void global_average_pooling_nchw8c(const Nchw8cMap& input, float output[]) {
+    const float scale = 1.0f / (float)(input.H * input.W);
+    for (int cb = 0; cb < nchw8c_blocks(input.C); ++cb) {
+        float acc[NCHWC_BLOCK] = {};
+        for (int h = 0; h < input.H; ++h) {
+            const float* row = input.data + cb * input.cstride + h * input.rstride;
+            for (int w = 0; w < input.W; ++w) {
+                for (int l = 0; l < NCHWC_BLOCK; ++l) acc[l] += row[w * NCHWC_BLOCK + l];
+            }
+        }
+        for (int l = 0; l < NCHWC_BLOCK && cb * NCHWC_BLOCK + l < input.C; ++l) {
+            output[cb * NCHWC_BLOCK + l] = acc[l] * scale;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Fire Module
+//--------------------------------------------------------------------------
+// Zero rows [first, first + count) of every channel block (pixel columns only)
+static void nchw8c_zero_rows(const Nchw8cMap& map, int first, int count) {
+    for (int cb = 0; cb < nchw8c_blocks(map.C); ++cb) {
+        for (int h = first; h < first + count; ++h) {
+            float* row = map.data + cb * map.cstride + h * map.rstride;
+            std::fill(row, row + map.W * NCHWC_BLOCK, 0.0f);
+        }
+    }
+}
+
+// Fire output rows [r0, r1) into `output`, whose row 0 is image row r0
+static void fire_rows_nchw8c(
+    const Nchw8cMap& input, const Nchw8cMap& output, int r0, int r1,
+    const float squeeze_weights[], const float squeeze_biases[],
+    const float expand1x1_weights[], const float expand1x1_biases[],
+    const float expand3x3_weights[], const float expand3x3_biases[],
+    const Nchw8cMap& squeeze_band)
+{
+    // Expand 1x1 and 3x3 write their channel blocks of the output directly,
+    // so the concatenation is free
+    int expand1x1_c = output.C / 2;
+    Nchw8cMap expand1x1_out = output;
+    expand1x1_out.C = expand1x1_c;
+    Nchw8cMap expand3x3_out = output;
+    expand3x3_out.data += nchw8c_blocks(expand1x1_c) * output.cstride;
+    expand3x3_out.C = output.C - expand1x1_c;
+
+    // The left/right halo columns stay zero for every band
+    nchw8c_zero_halo(squeeze_band, 1);
+
+    for (int b0 = r0; b0 < r1; b0 += squeeze_band.H) {
+        int rows = std::min(squeeze_band.H, r1 - b0);
+
+        // 1. Squeeze (1x1) + ReLU for the band and its halo rows; band row
+        // -1 / rows hold the neighbouring squeeze rows, or zeros at the edge
+        int s0 = std::max(b0 - 1, 0);
+        int s1 = std::min(b0 + rows + 1, input.H);
+        convolution_nchw8c(nchw8c_rows(input, s0, s1 - s0), squeeze_weights, squeeze_biases,
+                           nchw8c_rows(squeeze_band, s0 - b0, s1 - s0), 1, 1, 0, true);
+        if (b0 == 0) {
+            nchw8c_zero_rows(squeeze_band, -1, 1);
+        }
+        if (b0 + rows == input.H) {
+            nchw8c_zero_rows(squeeze_band, rows, 1);
+        }
+
+        // 2./3. Both expand layers consume the band while it is in cache, as
+        // concurrent branches (they only read the band)
+        Nchw8cMap band = nchw8c_rows(squeeze_band, 0, rows);
+        parallel_branches((double)rows * input.W * band.C * (expand1x1_out.C + 9 * expand3x3_out.C), {
+            [&] {
+                convolution_nchw8c(band, expand1x1_weights, expand1x1_biases,
+                                   nchw8c_rows(expand1x1_out, b0 - r0, rows), 1, 1, 0, true);
+            },
+            [&] {
+                convolution_nchw8c(band, expand3x3_weights, expand3x3_biases,
+                                   nchw8c_rows(expand3x3_out, b0 - r0, rows), 3, 1, 1, true);
+            }
+        });
+    }
+}
+
+void fire_module_nchw8c(
+    const Nchw8cMap& input, const Nchw8cMap& output,
+    const float squeeze_weights[], const float squeeze_biases[],
+    const float expand1x1_weights[], const float expand1x1_biases[],
+    const float expand3x3_weights[], const float expand3x3_biases[],
+    const Nchw8cMap& squeeze_band)
+{
+    fire_rows_nchw8c(input, output, 0, input.H,
+                     squeeze_weights, squeeze_biases,
+                     expand1x1_weights, expand1x1_biases,
+                     expand3x3_weights, expand3x3_biases, squeeze_band);
+}
+
+//--------------------------------------------------------------------------
+// Fused Producer + Max Pooling
+//--------------------------------------------------------------------------
+// Producer rows [first, first + count) are computed by produce() into the
+// band view it is given; pooled rows are emitted band by band and the rows
+// shared with the next band are moved to its top instead of being recomputed.
+template<class Producer>
+static void pool_bands_nchw8c(int InH, const Nchw8cMap& pool_band, const Nchw8cMap& output,
+                              int K, int S, Producer produce)
+{
+    const int tile = (pool_band.H - K) / S + 1; // Pooled rows per band
+    const int carry = K - S;
+    int prev_rows = 0;
+
+    for (int p0 = 0; p0 < output.H; p0 += tile) {
+        int p1 = std::min(p0 + tile, output.H);
+        int first = p0 * S;                     // Producer row in band row 0
+        int rows = std::min((p1 - 1) * S + K, InH) - first;
+        int kept = (p0 > 0) ? carry : 0;
+
+        if (kept > 0) {
+            for (int cb = 0; cb < nchw8c_blocks(pool_band.C); ++cb) {
+                float* plane = pool_band.data + cb * pool_band.cstride;
+                memmove(plane, plane + (prev_rows - kept) * pool_band.rstride,
+                        kept * pool_band.rstride * sizeof(float));
+            }
+        }
+        produce(first + kept, rows - kept, nchw8c_rows(pool_band, kept, rows - kept));
+        max_pooling_nchw8c(nchw8c_rows(pool_band, 0, rows), nchw8c_rows(output, p0, p1 - p0), K, S);
+        prev_rows = rows;
+    }
+}
+
+void convolution_pool_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    const Nchw8cMap& output, int K, int S, int PoolK, int PoolS, const Nchw8cMap& pool_band)
+{
+    const int conv_h = (input.H - K) / S + 1;
+    pool_bands_nchw8c(conv_h, pool_band, output, PoolK, PoolS,
+        [&](int first, int count, const Nchw8cMap& rows) {
+            convolution_nchw8c(nchw8c_rows(input, first * S, (count - 1) * S + K),
+                               weights, biases, rows, K, S, 0, true);
+        });
+}
+
+void fire_module_pool_nchw8c(
+    const Nchw8cMap& input, const Nchw8cMap& output,
+    const float squeeze_weights[], const float squeeze_biases[],
+    const float expand1x1_weights[], const float expand1x1_biases[],
+    const float expand3x3_weights[], const float expand3x3_biases[],
+    const Nchw8cMap& squeeze_band, int PoolK, int PoolS, const Nchw8cMap& pool_band)
+{
+    pool_bands_nchw8c(input.H, pool_band, output, PoolK, PoolS,
+        [&](int first, int count, const Nchw8cMap& rows) {
+            fire_rows_nchw8c(input, rows, first, first + count,
+                             squeeze_weights, squeeze_biases,
+                             expand1x1_weights, expand1x1_biases,
+                             expand3x3_weights, expand3x3_biases, squeeze_band);
+        });
+}
+
+//--------------------------------------------------------------------------
+// Depth-First Fire Group
+//--------------------------------------------------------------------------
+// Rows [first, end) of a fire's output, held from the top of its window
+struct RowWindow {
+    Nchw8cMap buf;
+    int first;
+    int end;
+
+    // The window addressed by image row (only rows [first, end) are read)
+    Nchw8cMap view(int H) const {
+        Nchw8cMap map = buf;
+        map.data -= first * buf.rstride;
+        map.H = H;
+        return map;
+    }
+
+    // Forget the rows above `row` and move the rest to the top
+    void drop_before(int row) {
+        if (row <= first) {
+            return;
+        }
+        for (int cb = 0; cb < nchw8c_blocks(buf.C); ++cb) {
+            float* plane = buf.data + cb * buf.cstride;
+            memmove(plane, plane + (row - first) * buf.rstride, (end - row) * buf.rstride * sizeof(float));
+        }
+        first = row;
+    }
+};
+
+void fire_group_nchw8c(
+    const Nchw8cMap& input, const Nchw8cFire fires[], int count,
+    const Nchw8cMap& output, int band_rows, int PoolK, int PoolS)
+{
+    const int H = input.H;
+    RowWindow window[FIRE_GROUP_MAX];
+    for (int k = 0; k < count; ++k) {
+        window[k].buf = fires[k].rows;
+        window[k].first = 0;
+        window[k].end = 0;
+    }
+
+    for (int p0 = 0; p0 < output.H; p0 += band_rows) {
+        int p1 = std::min(p0 + band_rows, output.H);
+
+        // Rows each fire must have produced: the last one's pool windows,
+        // then one halo row more per fire upstream
+        int target[FIRE_GROUP_MAX];
+        target[count - 1] = std::min((p1 - 1) * PoolS + PoolK, H);
+        for (int k = count - 2; k >= 0; --k) {
+            target[k] = std::min(target[k + 1] + 1, H);
+        }
+
+        for (int k = 0; k < count; ++k) {
+            const Nchw8cFire& fire = fires[k];
+            RowWindow& w = window[k];
+            // Keep what the consumer still reads: the halo row above the next
+            // fire's first new row, or the first pool window of the band
+            w.drop_before((k == count - 1) ? p0 * PoolS : std::max(window[k + 1].end - 1, 0));
+            if (target[k] > w.end) {
+                fire_rows_nchw8c((k == 0) ? input : window[k - 1].view(H),
+                                 nchw8c_rows(w.buf, w.end - w.first, target[k] - w.end),
+                                 w.end, target[k],
+                                 fire.squeeze_weights, fire.squeeze_biases,
+                                 fire.expand1x1_weights, fire.expand1x1_biases,
+                                 fire.expand3x3_weights, fire.expand3x3_biases, fire.squeeze_band);
+                w.end = target[k];
+            }
+        }
+
+        const RowWindow& last = window[count - 1];
+        max_pooling_nchw8c(nchw8c_rows(last.buf, p0 * PoolS - last.first, last.end - p0 * PoolS),
+                           nchw8c_rows(output, p0, p1 - p0), PoolK, PoolS);
+    }
+}
+
+//--------------------------------------------------------------------------
+// Whole Network
+//--------------------------------------------------------------------------
+#define NCHWC_FIRE_CHECK(n) \
+    static_assert(FIRE##n##_E1x1 == FIRE##n##_E3x3 && FIRE##n##_E1x1 % NCHWC_BLOCK == 0 && \
+                  FIRE##n##_S1x1 % NCHWC_BLOCK == 0, \
+                  "fire" #n ": squeeze and expand halves must be whole channel blocks")
+
+void squeezenet_nchw8c(
+    float arena[],
+    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+    float output_logits[NUM_CLASSES])
+{
+    NCHWC_FIRE_CHECK(2); NCHWC_FIRE_CHECK(3); NCHWC_FIRE_CHECK(4); NCHWC_FIRE_CHECK(5);
+    NCHWC_FIRE_CHECK(6); NCHWC_FIRE_CHECK(7); NCHWC_FIRE_CHECK(8); NCHWC_FIRE_CHECK(9);
+    static_assert(CONV1_P == 0 && CONV10_P == 0, "conv1/conv10 inputs carry no halo");
+    static_assert(CONV1_W_OUT <= SIMD_MAX_ROW_WIDTH && FIRE4_W_OUT <= SIMD_MAX_ROW_WIDTH &&
+                  FIRE8_W_OUT <= SIMD_MAX_ROW_WIDTH, "pooled rows must fit the row buffer");
+    static_assert(FIRE2_H_OUT == FIRE4_H_OUT && FIRE5_H_OUT == FIRE8_H_OUT && FIRE_GROUP_MAX >= 4,
+                  "a depth-first fire group keeps one map size");
+
+#define NCHWC_TENSOR(t) (arena + nchw8c_arena_plan.offset[NCHWC_ARENA_##t])
+
+    Nchw8cMap input = nchw8c_map(NCHWC_TENSOR(INPUT), INPUT_H, INPUT_W, INPUT_C, 0);
+    Nchw8cMap conv1_band = nchw8c_map(NCHWC_TENSOR(CONV1_BAND), POOL_BAND_ROWS, CONV1_W_OUT, CONV1_C_OUT, 0);
+    Nchw8cMap pool1 = nchw8c_map(NCHWC_TENSOR(POOL1), POOL1_H_OUT, POOL1_W_OUT, POOL1_C_OUT, 0);
+    Nchw8cMap pool4 = nchw8c_map(NCHWC_TENSOR(POOL4), POOL4_H_OUT, POOL4_W_OUT, POOL4_C_OUT, 0);
+    Nchw8cMap pool8 = nchw8c_map(NCHWC_TENSOR(POOL8), POOL8_H_OUT, POOL8_W_OUT, POOL8_C_OUT, 0);
+    Nchw8cMap fire9 = nchw8c_map(NCHWC_TENSOR(FIRE9), FIRE9_H_OUT, FIRE9_W_OUT, FIRE9_C_OUT, 0);
+    Nchw8cMap conv10_row = nchw8c_map(NCHWC_TENSOR(CONV10_ROW), 1, CONV10_W_OUT, CONV10_C_OUT, 0);
+
+    // Conv1 + ReLU + MaxPool1, fused (the only CHW -> NCHW8c reorder is in front)
+    nchw8c_from_chw(input_image, input);
+    convolution_pool_nchw8c(input, conv1_weights, conv1_biases, pool1, CONV1_KH, CONV1_S,
+                            POOL1_K, POOL1_S, conv1_band);
+
+#define NCHWC_SQUEEZE(n) \
+    nchw8c_map(NCHWC_TENSOR(SQUEEZE##n), FIRE_TILE_ROWS, FIRE##n##_W_OUT, FIRE##n##_S1x1, 1)
+#define NCHWC_GROUP_FIRE(n, window_rows) \
+    {fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, \
+     fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, \
+     fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, \
+     NCHWC_SQUEEZE(n), \
+     nchw8c_map(NCHWC_TENSOR(FIRE##n##_ROWS), window_rows, FIRE##n##_W_OUT, FIRE##n##_C_OUT, 0)}
+
+    // Fire2-4 + MaxPool4 and fire5-8 + MaxPool8, each depth-first
+    const Nchw8cFire group4[] = {
+        NCHWC_GROUP_FIRE(2, FIRE_GROUP4_WINDOW_ROWS),
+        NCHWC_GROUP_FIRE(3, FIRE_GROUP4_WINDOW_ROWS),
+        NCHWC_GROUP_FIRE(4, FIRE_GROUP4_WINDOW_ROWS),
+    };
+    fire_group_nchw8c(pool1, group4, 3, pool4, FIRE_GROUP4_BAND_ROWS, POOL4_K, POOL4_S);
+
+    const Nchw8cFire group8[] = {
+        NCHWC_GROUP_FIRE(5, FIRE_GROUP8_WINDOW_ROWS),
+        NCHWC_GROUP_FIRE(6, FIRE_GROUP8_WINDOW_ROWS),
+        NCHWC_GROUP_FIRE(7, FIRE_GROUP8_WINDOW_ROWS),
+        NCHWC_GROUP_FIRE(8, FIRE_GROUP8_WINDOW_ROWS),
+    };
+    fire_group_nchw8c(pool4, group8, 4, pool8, FIRE_GROUP8_BAND_ROWS, POOL8_K, POOL8_S);
+
+    // Fire9 (13x13, small enough to run layer by layer)
+    fire_module_nchw8c(pool8, fire9,
+                       fire9_squeeze1x1_weights, fire9_squeeze1x1_biases,
+                       fire9_expand1x1_weights, fire9_expand1x1_biases,
+                       fire9_expand3x3_weights, fire9_expand3x3_biases,
+                       NCHWC_SQUEEZE(9));
+#undef NCHWC_SQUEEZE
+#undef NCHWC_GROUP_FIRE
+
+    // Conv10 + ReLU pooled row by row straight into the plain logit vector
+    static_assert(CONV10_KH == 1 && CONV10_S == 1, "fused classifier expects a 1x1 conv10");
+    classifier_gap_nchw8c(fire9, conv10_weights, conv10_biases, output_logits, conv10_row);
+#undef NCHWC_TENSOR
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,158 @@
+#ifndef SQUEEZENET_NCHWC_H
+#define SQUEEZENET_NCHWC_H
+
+#include "squeezenet_params.h"
+#include "squeezenet_simd.h" // For NCHWC_BLOCK
+
+// ==========================================================================
+// === Channel-Blocked NCHW8c Activation Layout (Host Builds Only) ==========
+// ==========================================================================
+// In the flat CHW layout the channels of one pixel are H*W floats apart, so
+// vectorizing over output channels needs gathers. NCHW8c stores channels in
+// blocks of 8 that are innermost:
+//   (c, h, w) -> (c / 8) * cstride + h * rstride + w * 8 + c % 8
+// One output pixel's 8 channels are one ymm vector, and OIhw8i8o weights
+// give one 8-wide weight vector per input channel, so the direct convolution
+// is pure broadcast + FMA with no transposes between layers.
+//
+// squeezenet_nchw8c() runs the whole network in this layout: the input image
+// is reordered once in front of conv1, fire modules, pools and GAP work on
+// blocked maps natively, and GAP writes the logits out as a plain vector.
+// Channel counts that are not a multiple of 8 (the RGB input, a 10-class
+// conv10) are zero-padded to whole blocks. Fire modules are tile-fused: the
+// squeeze output is produced FIRE_TILE_ROWS rows at a time into a small band
+// with a one-pixel halo (real neighbour rows, zeros at the image edge), so
+// the 3x3/pad-1 expand runs without bounds checks on data still in cache,
+// and both expand layers write straight into their half of the fire output.
+// The max pool after conv1 is fused with it the same way: conv1 rows are
+// made one POOL_BAND_ROWS band at a time and pooled at once. Fire2-4 + pool4
+// and fire5-8 + pool8 run depth-first, one band of rows through the whole
+// group at a time (fire_group_nchw8c()), so their intermediate maps are
+// never stored whole. The conv10 classifier is pooled one output row at a
+// time.
+// ==========================================================================
+
+// Pipeline layout used by SqueezeNet() on the host
+enum ActivationLayout {
+    ACTIVATION_LAYOUT_CHW,     // Flat CHW maps (same as the HLS design)
+    ACTIVATION_LAYOUT_NCHW8C   // Channel-blocked maps (this file, default)
+};
+
+void set_activation_layout(ActivationLayout layout);
+ActivationLayout activation_layout();
+
+// View of a C x H x W map stored as NCHW8c
+struct Nchw8cMap {
+    float* data;   // Element (c, h, w) at data[(c/8)*cstride + h*rstride + w*8 + c%8]
+    int H, W, C;   // Logical size (C is stored rounded up to whole blocks)
+    int cstride;   // Floats per channel block
+    int rstride;   // Floats per row
+};
+
+// Channel blocks needed for C channels
+inline int nchw8c_blocks(int C) {
+    return (C + NCHWC_BLOCK - 1) / NCHWC_BLOCK;
+}
+
+// Floats needed for a map with a `halo`-pixel border on every side
+inline int nchw8c_size(int H, int W, int C, int halo) {
+    return nchw8c_blocks(C) * (H + 2 * halo) * (W + 2 * halo) * NCHWC_BLOCK;
+}
+
+// Map over buf[nchw8c_size(H, W, C, halo)]; data points at pixel (0, 0)
+Nchw8cMap nchw8c_map(float buf[], int H, int W, int C, int halo);
+
+// View of rows [first, first + count) of a map (first may be negative to
+// reach into the halo)
+inline Nchw8cMap nchw8c_rows(const Nchw8cMap& map, int first, int count) {
+    Nchw8cMap rows = map;
+    rows.data += first * map.rstride;
+    rows.H = count;
+    return rows;
+}
+
+// Zero the `halo`-pixel border around a map
+void nchw8c_zero_halo(const Nchw8cMap& map, int halo);
+
+// CHW -> NCHW8c reorder (padding lanes are written as zeros)
+void nchw8c_from_chw(const float input[], const Nchw8cMap& output);
+
+// Direct convolution (square kernel K, stride S, padding P). The input map
+// must carry a zero halo of at least P pixels; the output size is taken
+// from `output`.
+void convolution_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    const Nchw8cMap& output, int K, int S, int P, bool apply_relu);
+
+// Max pooling (no padding; windows are clipped at the bottom/right edge
+// like max_pooling())
+void max_pooling_nchw8c(const Nchw8cMap& input, const Nchw8cMap& output, int K, int S);
+
+// Global average pooling; writes input.C plain floats
+void global_average_pooling_nchw8c(const Nchw8cMap& input, float output[]);
+
+// Fused producer + max pooling: the producer's rows are computed
+// pool_band.H at a time into pool_band (producer C x W, no halo) and pooled
+// into `output` right away, so the full-resolution map is never stored.
+// convolution_pool_nchw8c() takes a convolution without padding.
+void convolution_pool_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    const Nchw8cMap& output, int K, int S, int PoolK, int PoolS, const Nchw8cMap& pool_band);
+
+void fire_module_pool_nchw8c(
+    const Nchw8cMap& input, const Nchw8cMap& output,
+    const float squeeze_weights[], const float squeeze_biases[],
+    const float expand1x1_weights[], const float expand1x1_biases[],
+    const float expand3x3_weights[], const float expand3x3_biases[],
+    const Nchw8cMap& squeeze_band, int PoolK, int PoolS, const Nchw8cMap& pool_band);
+
+// Fused 1x1 classifier + ReLU + global average pooling: conv rows are
+// produced one at a time into row_buf (1 x input.W x OutC) and pooled into
+// output[OutC] right away, so the classifier map is never stored.
+void classifier_gap_nchw8c(
+    const Nchw8cMap& input, const float weights[], const float biases[],
+    float output[], const Nchw8cMap& row_buf);
+
+// Tile-fused fire module. squeeze_band is the squeeze scratch for one band:
+// squeeze channels x band rows x input.W with a one-pixel halo; the fire is
+// computed squeeze_band.H output rows at a time.
+void fire_module_nchw8c(
+    const Nchw8cMap& input, const Nchw8cMap& output,
+    const float squeeze_weights[], const float squeeze_biases[],
+    const float expand1x1_weights[], const float expand1x1_biases[],
+    const float expand3x3_weights[], const float expand3x3_biases[],
+    const Nchw8cMap& squeeze_band);
+
+// One fire module of a depth-first group
+struct Nchw8cFire {
+    const float* squeeze_weights;
+    const float* squeeze_biases;
+    const float* expand1x1_weights;
+    const float* expand1x1_biases;
+    const float* expand3x3_weights;
+    const float* expand3x3_biases;
+    Nchw8cMap squeeze_band;  // As for fire_module_nchw8c()
+    Nchw8cMap rows;          // Window of this fire's output rows (no halo)
+};
+
+#define FIRE_GROUP_MAX 4 // Fires per depth-first group
+
+// Depth-first fire group: `count` consecutive fire modules on maps the size
+// of `input`, then a PoolK/PoolS max pool into `output`. The group is run
+// band_rows pooled rows at a time instead of layer by layer: every fire
+// produces only the rows the next layer needs for the band (one halo row
+// more per fire further down) into its window, and drops the rows no later
+// band reads, so the intermediate maps never leave the cache. Windows need
+// depth_first_window_rows() rows (squeezenet_arena.h).
+void fire_group_nchw8c(
+    const Nchw8cMap& input, const Nchw8cFire fires[], int count,
+    const Nchw8cMap& output, int band_rows, int PoolK, int PoolS);
+
+// Whole network in NCHW8c (same inputs/outputs as SqueezeNet()); every
+// activation lives in arena[nchw8c_arena_plan.size] (squeezenet_arena.h)
+void squeezenet_nchw8c(
+    float arena[],
+    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+    float output_logits[NUM_CLASSES]);
+
+#endif // SQUEEZENET_NCHWC_H
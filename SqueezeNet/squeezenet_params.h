@@ -141,9 +141,47 @@
 #define BUF_FIRE8_SIZE (FIRE8_H_OUT * FIRE8_W_OUT * FIRE8_C_OUT)
 #define BUF_POOL8_SIZE (POOL8_H_OUT * POOL8_W_OUT * POOL8_C_OUT)
 #define BUF_FIRE9_SIZE (FIRE9_H_OUT * FIRE9_W_OUT * FIRE9_C_OUT)
-#define BUF_CONV10_SIZE (CONV10_H_OUT * CONV10_W_OUT * CONV10_C_OUT)
 // Buffers needed inside Fire module
 #define MAX_FIRE_SQUEEZE_SIZE (55 * 55 * 64) // Max squeeze channels = 64 (Fire8/9) at max H/W = 55x55
-#define MAX_FIRE_EXPAND_SIZE (55 * 55 * 256) // Max expand channels = 256 (Fire8/9) at max H/W = 55x55
+
+// Tile-fused fire module (fire_module_rows): squeeze is computed for a band of
+// FIRE_TILE_ROWS output rows plus a one-row halo above and below, and both
+// expand layers consume the band before the next one is computed
+#define FIRE_TILE_ROWS 8
+#define MAX_FIRE_BAND_SIZE ((FIRE_TILE_ROWS + 2) * 55 * 64) // Max squeeze channels x band at W = 55
+// Squeeze buffer passed to the fire modules: one band in the HLS design, a
+// whole map on the host (the GEMM/Winograd backends work on full maps)
+#ifdef __SYNTHESIS__
+#define FIRE_SQUEEZE_BUF_SIZE MAX_FIRE_BAND_SIZE
+#else
+#define FIRE_SQUEEZE_BUF_SIZE MAX_FIRE_SQUEEZE_SIZE
+#endif
+
+// Fused producer + max pooling (conv1/pool1, fire4/pool4, fire8/pool8): the
+// producer's rows are computed into a band of POOL_BAND_ROWS rows, enough for
+// POOL_TILE_ROWS rows of a 3x3/stride-2 pool, and pooled right away. The row
+// shared with the next band is carried over instead of being recomputed.
+#define POOL_TILE_ROWS 4
+#define POOL_BAND_ROWS ((POOL_TILE_ROWS - 1) * 2 + 3) // 9
+
+// Row buffer of the separable 3x3/stride-2 pool (one row of horizontal maxima)
+#define POOL_MAX_W_OUT POOL1_W_OUT // 55, the widest pool output
+
+// Fixed-point network (squeezenet_fixed_point.h): ap_fixed<W, I> widths.
+// Maps, weights and biases are ap_fixed<16,6> (range +-32, step 2^-10);
+// sums keep a product's 20 fraction bits exactly, with 16 integer bits of
+// headroom (fits the 48-bit DSP48 accumulator)
+#define FIXED_DATA_W 16
+#define FIXED_DATA_I 6
+#define FIXED_ACC_W 36
+#define FIXED_ACC_I 16
+
+// Depth-first fire groups (host NCHW8c pipeline): fire2-4 and fire5-8 are run
+// band by band through the whole group, keeping only a few rows of every
+// intermediate map. Bands are sized so that one band's rows of all the
+// group's maps fit in this much L2 (the group's weights stream through too).
+// Much smaller budgets give bands of a row or two, where recomputing the
+// squeeze halo rows of every band starts to cost more than it saves.
+#define DEPTH_FIRST_L2_BYTES (2 * 1024 * 1024)
 
 #endif // SQUEEZENET_PARAMS_H
\ No newline at end of file
@@ -0,0 +1,289 @@
+#include "squeezenet_pipeline.h"
+#include "squeezenet.h"
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side streaming only; HLS keeps the one-image design
+
+#include <algorithm> // For std::min, std::max
+#include <atomic>    // For the ring indices and the stop flag
+#include <cstring>   // For std::memcpy
+#include <memory>    // For std::unique_ptr
+#include <thread>    // For std::thread, std::this_thread::yield
+#include <vector>    // For the slot storage
+#ifdef __linux__
+#include <pthread.h> // For pthread_setaffinity_np
+#include <sched.h>   // For cpu_set_t
+#endif
+
+//--------------------------------------------------------------------------
+// Network Steps
+//--------------------------------------------------------------------------
+typedef void (*PipelineStep)(float arena[], const float input[], float output[]);
+
+#define PIPELINE_NUM_STEPS 10
+
+static const PipelineStep step_run[PIPELINE_NUM_STEPS] = {
+    squeezenet_step_conv1, squeezenet_step_fire2, squeezenet_step_fire3,
+    squeezenet_step_fire4, squeezenet_step_fire5, squeezenet_step_fire6,
+    squeezenet_step_fire7, squeezenet_step_fire8, squeezenet_step_fire9,
+    squeezenet_step_classifier,
+};
+
+// Where a step's output lives when the next step is in the same stage (the
+// arena plan keeps these apart from every scratch a later step uses)
+static const int step_tensor[PIPELINE_NUM_STEPS] = {
+    ARENA_POOL1, ARENA_FIRE2, ARENA_FIRE3, ARENA_POOL4, ARENA_FIRE5,
+    ARENA_FIRE6, ARENA_FIRE7, ARENA_POOL8, ARENA_FIRE9, -1,
+};
+
+// Floats a step writes (the slot size when a stage ends with it)
+static const int step_output_size[PIPELINE_NUM_STEPS] = {
+    CONV1_C_OUT * POOL1_H_OUT * POOL1_W_OUT,
+    FIRE2_C_OUT * FIRE2_H_OUT * FIRE2_W_OUT,
+    FIRE3_C_OUT * FIRE3_H_OUT * FIRE3_W_OUT,
+    FIRE4_C_OUT * POOL4_H_OUT * POOL4_W_OUT,
+    FIRE5_C_OUT * FIRE5_H_OUT * FIRE5_W_OUT,
+    FIRE6_C_OUT * FIRE6_H_OUT * FIRE6_W_OUT,
+    FIRE7_C_OUT * FIRE7_H_OUT * FIRE7_W_OUT,
+    FIRE8_C_OUT * POOL8_H_OUT * POOL8_W_OUT,
+    FIRE9_C_OUT * FIRE9_H_OUT * FIRE9_W_OUT,
+    NUM_CLASSES,
+};
+
+// Multiply-adds per step, used to balance the stages
+#define FIRE_COST(n) \
+    ((double)FIRE##n##_H_OUT * FIRE##n##_W_OUT * FIRE##n##_S1x1 * \
+     (FIRE##n##_C_IN + FIRE##n##_E1x1 + 9 * FIRE##n##_E3x3))
+
+static const double step_cost[PIPELINE_NUM_STEPS] = {
+    (double)CONV1_H_OUT * CONV1_W_OUT * CONV1_C_OUT * INPUT_C * CONV1_KH * CONV1_KW,
+    FIRE_COST(2), FIRE_COST(3), FIRE_COST(4), FIRE_COST(5),
+    FIRE_COST(6), FIRE_COST(7), FIRE_COST(8), FIRE_COST(9),
+    (double)FIRE9_H_OUT * FIRE9_W_OUT * CONV10_C_IN * CONV10_C_OUT,
+};
+#undef FIRE_COST
+
+static_assert(PIPELINE_MAX_STAGES == PIPELINE_NUM_STEPS, "one step per stage at most");
+
+// Cut the steps into `stages` contiguous runs minimizing the most expensive
+// run (the pipeline's throughput limit): first_step[s] is stage s's first
+// step, first_step[stages] == PIPELINE_NUM_STEPS
+static void partition_steps(int stages, int first_step[]) {
+    const int n = PIPELINE_NUM_STEPS;
+    double prefix[PIPELINE_NUM_STEPS + 1] = {0};
+    for (int i = 0; i < n; ++i) {
+        prefix[i + 1] = prefix[i] + step_cost[i];
+    }
+    // best[k][i]: smallest max stage cost of steps [0, i) in k stages
+    double best[PIPELINE_MAX_STAGES + 1][PIPELINE_NUM_STEPS + 1];
+    int cut[PIPELINE_MAX_STAGES + 1][PIPELINE_NUM_STEPS + 1];
+    for (int i = 1; i <= n; ++i) {
+        best[1][i] = prefix[i];
+        cut[1][i] = 0;
+    }
+    for (int k = 2; k <= stages; ++k) {
+        for (int i = k; i <= n; ++i) {
+            best[k][i] = -1;
+            for (int j = k - 1; j < i; ++j) {
+                double worst = std::max(best[k - 1][j], prefix[i] - prefix[j]);
+                if (best[k][i] < 0 || worst < best[k][i]) {
+                    best[k][i] = worst;
+                    cut[k][i] = j;
+                }
+            }
+        }
+    }
+    first_step[stages] = n;
+    for (int k = stages; k >= 1; --k) {
+        first_step[k - 1] = cut[k][first_step[k]];
+    }
+}
+
+//--------------------------------------------------------------------------
+// Lock-Free SPSC Ring of Slot Pointers
+//--------------------------------------------------------------------------
+// One producer thread pushes, one consumer thread pops. A ring never holds
+// more slots than its link owns, so push always has room.
+#define PIPELINE_RING_CAPACITY (PIPELINE_MAX_STAGES * PIPELINE_SLOTS)
+
+struct SpscRing {
+    float* slot[PIPELINE_RING_CAPACITY];
+    std::atomic<size_t> head{0}; // Next to pop (consumer)
+    char pad[64];                // Keeps the two indices on separate cache lines
+    std::atomic<size_t> tail{0}; // Next to push (producer)
+
+    void push(float* p) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        slot[t % PIPELINE_RING_CAPACITY] = p;
+        tail.store(t + 1, std::memory_order_release);
+    }
+
+    float* pop() {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return 0;
+        }
+        float* p = slot[h % PIPELINE_RING_CAPACITY];
+        head.store(h + 1, std::memory_order_release);
+        return p;
+    }
+};
+
+// The buffers between two neighbours (or between the caller and the first
+// or last stage) and the two rings they circulate on
+struct PipelineLink {
+    std::vector<float> storage;
+    SpscRing filled; // Producer -> consumer: maps ready for the next stage
+    SpscRing free;   // Consumer -> producer: buffers ready to be refilled
+
+    void init(int slots, int slot_size) {
+        storage.assign((size_t)slots * slot_size, 0.0f);
+        for (int i = 0; i < slots; ++i) {
+            free.push(storage.data() + (size_t)i * slot_size);
+        }
+    }
+};
+
+struct SqueezeNetPipeline {
+    int stages;
+    int capacity;                                     // Slots of the first and last link
+    int first_step[PIPELINE_MAX_STAGES + 1];
+    PipelineLink links[PIPELINE_MAX_STAGES + 1];      // links[s] feeds stage s
+    std::unique_ptr<InferenceContext> contexts[PIPELINE_MAX_STAGES];
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopping{false};
+};
+
+// Pop from `ring`, spinning (with yield) while it is empty. NULL once the
+// pipeline is stopping.
+static float* wait_pop(SpscRing& ring, const std::atomic<bool>& stopping) {
+    for (;;) {
+        float* p = ring.pop();
+        if (p) {
+            return p;
+        }
+        if (stopping.load(std::memory_order_acquire)) {
+            return 0;
+        }
+        std::this_thread::yield();
+    }
+}
+
+static void pin_to_core(int core) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set); // Best effort
+#else
+    (void)core;
+#endif
+}
+
+//--------------------------------------------------------------------------
+// Stage Thread
+//--------------------------------------------------------------------------
+static void stage_loop(SqueezeNetPipeline* p, int s, int core) {
+    if (core >= 0) {
+        pin_to_core(core);
+    }
+    set_thread_serial(true);
+
+    // Allocated here so its pages are first touched on the stage's own core
+    p->contexts[s].reset(new InferenceContext);
+    float* arena = p->contexts[s]->arena;
+    PipelineLink& in = p->links[s];
+    PipelineLink& out = p->links[s + 1];
+    const int first = p->first_step[s];
+    const int last = p->first_step[s + 1] - 1;
+
+    for (;;) {
+        float* src = wait_pop(in.filled, p->stopping);
+        if (!src) {
+            return;
+        }
+        float* dst = wait_pop(out.free, p->stopping);
+        if (!dst) {
+            return;
+        }
+        const float* map = src;
+        for (int k = first; k <= last; ++k) {
+            float* next = (k == last) ? dst : squeezenet_tensor(arena, step_tensor[k]);
+            step_run[k](arena, map, next);
+            map = next;
+        }
+        in.free.push(src);
+        out.filled.push(dst);
+    }
+}
+
+//--------------------------------------------------------------------------
+// Public API
+//--------------------------------------------------------------------------
+SqueezeNetPipeline* squeezenet_pipeline_create(int stages, int first_core) {
+    SqueezeNetPipeline* p = new SqueezeNetPipeline;
+    p->stages = std::max(1, std::min(stages, PIPELINE_MAX_STAGES));
+    p->capacity = p->stages * PIPELINE_SLOTS;
+    partition_steps(p->stages, p->first_step);
+
+    // Input slots hold images, output slots logits, inner slots the map the
+    // upstream stage ends with
+    p->links[0].init(p->capacity, INPUT_C * INPUT_H * INPUT_W);
+    for (int s = 1; s < p->stages; ++s) {
+        p->links[s].init(PIPELINE_SLOTS, step_output_size[p->first_step[s] - 1]);
+    }
+    p->links[p->stages].init(p->capacity, NUM_CLASSES);
+
+    const int cores = (int)std::thread::hardware_concurrency();
+    const bool pin = first_core >= 0 && cores >= p->stages;
+    for (int s = 0; s < p->stages; ++s) {
+        int core = pin ? (first_core + s) % cores : -1;
+        p->threads.emplace_back(stage_loop, p, s, core);
+    }
+    return p;
+}
+
+void squeezenet_pipeline_destroy(SqueezeNetPipeline* pipeline) {
+    pipeline->stopping.store(true, std::memory_order_release);
+    for (std::thread& t : pipeline->threads) {
+        t.join();
+    }
+    delete pipeline;
+}
+
+int squeezenet_pipeline_capacity(const SqueezeNetPipeline* pipeline) {
+    return pipeline->capacity;
+}
+
+void squeezenet_pipeline_submit(SqueezeNetPipeline* pipeline, const float input_image[]) {
+    PipelineLink& in = pipeline->links[0];
+    float* slot = wait_pop(in.free, pipeline->stopping);
+    std::memcpy(slot, input_image, sizeof(float) * INPUT_C * INPUT_H * INPUT_W);
+    in.filled.push(slot);
+}
+
+void squeezenet_pipeline_result(SqueezeNetPipeline* pipeline, float output_logits[NUM_CLASSES]) {
+    PipelineLink& out = pipeline->links[pipeline->stages];
+    float* slot = wait_pop(out.filled, pipeline->stopping);
+    std::memcpy(output_logits, slot, sizeof(float) * NUM_CLASSES);
+    out.free.push(slot);
+}
+
+void SqueezeNetPipelined(int N, int stages, const float input_images[], float output_logits[]) {
+    SqueezeNetPipeline* p = squeezenet_pipeline_create(stages, 0);
+    const int capacity = squeezenet_pipeline_capacity(p);
+
+    // Keep the pipeline full: submit ahead up to its capacity, then take one
+    // result per new frame
+    int submitted = 0;
+    for (int done = 0; done < N; ++done) {
+        while (submitted < N && submitted - done < capacity) {
+            squeezenet_pipeline_submit(p, input_images + (size_t)submitted * INPUT_C * INPUT_H * INPUT_W);
+            ++submitted;
+        }
+        squeezenet_pipeline_result(p, output_logits + (size_t)done * NUM_CLASSES);
+    }
+    squeezenet_pipeline_destroy(p);
+}
+
+#endif // __SYNTHESIS__
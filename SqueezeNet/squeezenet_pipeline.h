@@ -0,0 +1,58 @@
+#ifndef SQUEEZENET_PIPELINE_H
+#define SQUEEZENET_PIPELINE_H
+
+#include "squeezenet_params.h"
+
+// ==========================================================================
+// === Inter-Frame Layer Pipeline (Host Builds Only) ========================
+// ==========================================================================
+// For camera streams throughput matters more than single-frame latency. The
+// pipeline cuts the CHW network steps (squeezenet.h: conv1+pool1, fire2 ..
+// fire9, classifier) into K contiguous stages of about equal work, each run
+// by its own thread pinned to its own core, so up to K frames are in flight
+// at once and each stage's weights and scratch stay in that core's cache.
+//
+// Stages hand feature maps to each other in slot buffers passed through
+// lock-free single-producer/single-consumer rings: a `filled` ring carries a
+// finished map downstream and a `free` ring returns the emptied buffer
+// upstream, so nothing is copied or allocated per frame. Every stage owns a
+// whole arena, and its threads keep their layers to themselves (no
+// intra-layer thread pool), so the stages never compete for a core. The
+// stages always run the CHW steps, whatever set_activation_layout() says.
+// ==========================================================================
+
+#define PIPELINE_MAX_STAGES 10  // One network step per stage at most
+#define PIPELINE_SLOTS 2        // Buffers between two stages (double buffering)
+
+struct SqueezeNetPipeline; // Opaque
+
+// Start a pipeline of `stages` stages (clamped to 1 .. PIPELINE_MAX_STAGES).
+// Stage s is pinned to core first_core + s (modulo the core count) when the
+// machine has at least `stages` cores; first_core < 0 disables pinning.
+SqueezeNetPipeline* squeezenet_pipeline_create(int stages, int first_core);
+
+// Stop the stage threads and free the pipeline. Frames still in flight are
+// dropped.
+void squeezenet_pipeline_destroy(SqueezeNetPipeline* pipeline);
+
+// Frames that may be in flight (submitted, result not yet taken). Staying
+// within it guarantees that submit never waits on a result nobody takes.
+int squeezenet_pipeline_capacity(const SqueezeNetPipeline* pipeline);
+
+// Hand in the next frame (INPUT_C x INPUT_H x INPUT_W; copied, so the
+// caller may reuse the buffer). Waits while every input slot is in flight.
+void squeezenet_pipeline_submit(SqueezeNetPipeline* pipeline, const float input_image[]);
+
+// Take the logits of the oldest submitted frame (results come out in
+// submission order), waiting until that frame has left the last stage.
+void squeezenet_pipeline_result(SqueezeNetPipeline* pipeline, float output_logits[NUM_CLASSES]);
+
+// Convenience: N frames in, N logit vectors out, streamed through a
+// pipeline of `stages` stages that is started and stopped around the call.
+void SqueezeNetPipelined(
+    int N, int stages,
+    const float input_images[],
+    float output_logits[]
+);
+
+#endif // SQUEEZENET_PIPELINE_H
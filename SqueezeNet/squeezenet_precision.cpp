@@ -0,0 +1,343 @@
+#include "squeezenet_precision.h"
+#include "squeezenet.h"
+#include "squeezenet_calibration.h"
+#include "squeezenet_quant.h"
+
+#ifndef __SYNTHESIS__ // Host-side precision policies only
+
+#include <algorithm> // For std::max_element, std::sort
+#include <chrono>    // For the latency measurement
+#include <cmath>     // For fabs
+#include <cstdio>    // For the policy, label and report files
+#include <cstring>   // For strcmp, strchr
+#include <map>       // For the labels by file name
+#include <string>    // For file names
+#include <vector>    // For the validation images
+
+static const char* const layer_names[POLICY_NUM_LAYERS] = {
+    "conv1", "fire2", "fire3", "fire4", "fire5", "fire6", "fire7", "fire8", "fire9", "conv10",
+};
+
+static const char* const precision_names[LAYER_NUM_PRECISIONS] = {"fp32", "int8"};
+
+static PrecisionPolicy current_policy = {}; // All fp32 (LAYER_FP32 is 0)
+
+const char* policy_layer_name(int layer) {
+    return (layer >= 0 && layer < POLICY_NUM_LAYERS) ? layer_names[layer] : "?";
+}
+
+const char* layer_precision_name(int precision) {
+    return (precision >= 0 && precision < LAYER_NUM_PRECISIONS) ? precision_names[precision] : "?";
+}
+
+PrecisionPolicy uniform_precision_policy(LayerPrecision precision) {
+    PrecisionPolicy policy;
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        policy.layer[l] = precision;
+    }
+    return policy;
+}
+
+// Index of `name` in names[count], or -1
+static int find_name(const char* const names[], int count, const char* name) {
+    for (int i = 0; i < count; ++i) {
+        if (strcmp(names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+// Whether every layer has the same precision (stored in `precision`)
+static bool policy_uniform(const PrecisionPolicy& policy, LayerPrecision& precision) {
+    precision = policy.layer[0];
+    for (int l = 1; l < POLICY_NUM_LAYERS; ++l) {
+        if (policy.layer[l] != precision) return false;
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------------
+// Policy Files
+//--------------------------------------------------------------------------
+bool precision_policy_load(const char* path, PrecisionPolicy& policy) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    int precision[POLICY_NUM_LAYERS];
+    int fallback = LAYER_FP32;
+    std::fill(precision, precision + POLICY_NUM_LAYERS, -1);
+    bool ok = true;
+    char line[256];
+    while (ok && fgets(line, sizeof(line), f)) {
+        if (char* comment = strchr(line, '#')) *comment = '\0';
+        char layer[128], value[128], extra[2];
+        int fields = sscanf(line, "%127s %127s %1s", layer, value, extra);
+        if (fields <= 0) {
+            continue; // Blank line
+        }
+        int p = find_name(precision_names, LAYER_NUM_PRECISIONS, value);
+        if (fields != 2 || p < 0) {
+            ok = false;
+        } else if (strcmp(layer, "default") == 0) {
+            fallback = p;
+        } else {
+            int l = find_name(layer_names, POLICY_NUM_LAYERS, layer);
+            ok = (l >= 0);
+            if (ok) precision[l] = p;
+        }
+    }
+    fclose(f);
+    if (!ok) {
+        return false;
+    }
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        policy.layer[l] = (LayerPrecision)(precision[l] >= 0 ? precision[l] : fallback);
+    }
+    return true;
+}
+
+bool precision_policy_write(const char* path, const PrecisionPolicy& policy) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "# SqueezeNet precision policy: <layer> <%s|%s>\n", precision_names[0], precision_names[1]);
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        fprintf(f, "%-7s %s\n", layer_names[l], precision_names[policy.layer[l]]);
+    }
+    return fclose(f) == 0;
+}
+
+void precision_policy_label(const PrecisionPolicy& policy, char label[], int size) {
+    int count[LAYER_NUM_PRECISIONS] = {};
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        ++count[policy.layer[l]];
+    }
+    const int base = (int)(std::max_element(count, count + LAYER_NUM_PRECISIONS) - count);
+    int n = snprintf(label, size, "%s", precision_names[base]);
+    const char* separator = " except ";
+    for (int l = 0; l < POLICY_NUM_LAYERS && n < size; ++l) {
+        if (policy.layer[l] != base) {
+            n += snprintf(label + n, size - n, "%s%s=%s", separator, layer_names[l],
+                          precision_names[policy.layer[l]]);
+            separator = ",";
+        }
+    }
+}
+
+bool set_precision_policy(const PrecisionPolicy& policy) {
+    const PrecisionPolicy previous = current_policy;
+    LayerPrecision uniform;
+    InferencePrecision precision = !policy_uniform(policy, uniform) ? PRECISION_MIXED :
+                                   (uniform == LAYER_INT8) ? PRECISION_INT8 : PRECISION_FP32;
+    current_policy = policy;
+    if (!set_inference_precision(precision)) {
+        current_policy = previous;
+        return false;
+    }
+    return true;
+}
+
+const PrecisionPolicy& precision_policy() {
+    return current_policy;
+}
+
+//--------------------------------------------------------------------------
+// Latency / Accuracy Sweep
+//--------------------------------------------------------------------------
+int precision_policy_candidates(PrecisionPolicy policies[PRECISION_MAX_CANDIDATES]) {
+    int count = 0;
+    policies[count++] = uniform_precision_policy(LAYER_FP32);
+    policies[count++] = uniform_precision_policy(LAYER_INT8);
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        policies[count] = uniform_precision_policy(LAYER_INT8);
+        policies[count++].layer[l] = LAYER_FP32;
+    }
+    policies[count] = uniform_precision_policy(LAYER_INT8);
+    policies[count].layer[POLICY_CONV1] = LAYER_FP32;
+    policies[count++].layer[POLICY_CONV10] = LAYER_FP32;
+    return count;
+}
+
+static int top1_class(const float logits[NUM_CLASSES]) {
+    return (int)(std::max_element(logits, logits + NUM_CLASSES) - logits);
+}
+
+// Time one pass over the images under the selected precision (after a
+// warm-up call) and store each image's class and logits
+static double timed_pass(int N, const float images[], int classes[], float logits[]) {
+    const size_t image_size = (size_t)INPUT_C * INPUT_H * INPUT_W;
+    SqueezeNet(images, logits);
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; ++n) {
+        float* image_logits = logits + (size_t)n * NUM_CLASSES;
+        SqueezeNet(images + n * image_size, image_logits);
+        classes[n] = top1_class(image_logits);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / N;
+}
+
+// Largest |a - b| over n logits
+static double max_logit_error(size_t n, const float a[], const float b[]) {
+    double error = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        error = std::max(error, (double)std::fabs(a[i] - b[i]));
+    }
+    return error;
+}
+
+// Fraction of classes[] equal to the reference
+static double top1_rate(int N, const int classes[], const int reference[]) {
+    int hits = 0;
+    for (int n = 0; n < N; ++n) {
+        hits += (classes[n] == reference[n]);
+    }
+    return (double)hits / N;
+}
+
+int squeezenet_precision_sweep(int N, const float images[], const int labels[],
+                               const PrecisionPolicy policies[], int count, double budget,
+                               PrecisionSweepResult results[])
+{
+    if (N <= 0) {
+        return -1;
+    }
+    const InferencePrecision saved_precision = inference_precision();
+    const PrecisionPolicy saved_policy = current_policy;
+
+    // Int8 steps need activation ranges; calibrate on the set if there are none
+    float ranges[QUANT_NUM_TENSORS];
+    bool uses_int8 = false;
+    for (int i = 0; i < count; ++i) {
+        for (int l = 0; l < POLICY_NUM_LAYERS; ++l) uses_int8 |= (policies[i].layer[l] == LAYER_INT8);
+    }
+    if (uses_int8 && !squeezenet_int8_ranges(ranges) && !squeezenet_int8_load_ranges(SQUEEZENET_SCALE_FILE)) {
+        squeezenet_int8_calibrate(N, images);
+    }
+
+    // fp32 reference
+    std::vector<int> reference(N), classes(N);
+    std::vector<float> reference_logits((size_t)N * NUM_CLASSES), logits((size_t)N * NUM_CLASSES);
+    set_precision_policy(uniform_precision_policy(LAYER_FP32));
+    const double fp32_ms = timed_pass(N, images, reference.data(), reference_logits.data());
+    const double fp32_top1 = labels ? top1_rate(N, reference.data(), labels) : 1.0;
+
+    int best = -1;
+    for (int i = 0; i < count; ++i) {
+        PrecisionSweepResult& r = results[i];
+        LayerPrecision uniform;
+        r.policy = policies[i];
+        if (policy_uniform(policies[i], uniform) && uniform == LAYER_FP32) {
+            r.ms_per_image = fp32_ms;
+            r.top1 = fp32_top1;
+            r.max_logit_error = 0.0;
+        } else {
+            set_precision_policy(policies[i]);
+            r.ms_per_image = timed_pass(N, images, classes.data(), logits.data());
+            r.top1 = top1_rate(N, classes.data(), labels ? labels : reference.data());
+            r.max_logit_error = max_logit_error(logits.size(), logits.data(), reference_logits.data());
+        }
+        r.top1_delta = r.top1 - fp32_top1;
+        if (r.top1_delta >= -budget && (best < 0 || r.ms_per_image < results[best].ms_per_image)) {
+            best = i;
+        }
+    }
+
+    current_policy = saved_policy;
+    set_inference_precision(saved_precision);
+    return best;
+}
+
+// "<file name> <class>" lines of dir/labels.txt by file name; false if the
+// file does not exist
+static bool read_labels(const char* dir, std::map<std::string, int>& labels) {
+    FILE* f = fopen((std::string(dir) + "/labels.txt").c_str(), "r");
+    if (!f) {
+        return false;
+    }
+    char line[512], name[256];
+    int label;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] != '#' && sscanf(line, "%255s %d", name, &label) == 2) {
+            labels[name] = label;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+int squeezenet_precision_sweep_directory(const char* dir, double budget,
+                                         const char* report_path, const char* policy_path)
+{
+    std::vector<std::string> files;
+    if (calibration_image_files(dir, files) <= 0) {
+        return -1;
+    }
+    std::map<std::string, int> label_map;
+    const bool has_labels = read_labels(dir, label_map);
+
+    // Load the set (labelled images only, when there are labels)
+    const size_t image_size = (size_t)INPUT_C * INPUT_H * INPUT_W;
+    std::vector<float> images;
+    std::vector<int> labels;
+    for (const std::string& path : files) {
+        std::string name = path.substr(path.rfind('/') + 1);
+        if (has_labels && !label_map.count(name)) {
+            continue;
+        }
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) {
+            continue;
+        }
+        images.resize(images.size() + image_size);
+        size_t got = fread(images.data() + images.size() - image_size, sizeof(float), image_size, f);
+        fclose(f);
+        if (got != image_size) {
+            images.resize(images.size() - image_size);
+        } else if (has_labels) {
+            labels.push_back(label_map[name]);
+        }
+    }
+    const int N = (int)(images.size() / image_size);
+    if (N == 0) {
+        return -1;
+    }
+
+    PrecisionPolicy policies[PRECISION_MAX_CANDIDATES];
+    PrecisionSweepResult results[PRECISION_MAX_CANDIDATES];
+    const int count = precision_policy_candidates(policies);
+    const int best = squeezenet_precision_sweep(N, images.data(), has_labels ? labels.data() : NULL,
+                                                policies, count, budget, results);
+
+    // Report, fastest first; '*' marks the policies within the budget
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return results[a].ms_per_image < results[b].ms_per_image;
+    });
+    FILE* f = fopen(report_path, "w");
+    if (!f) {
+        return -1;
+    }
+    fprintf(f, "# SqueezeNet precision sweep: %d images, top-1 %s, budget %g\n", N,
+            has_labels ? "against labels.txt" : "agreement with fp32", budget);
+    fprintf(f, "#   ms/image    top-1    delta  max logit error  policy\n");
+    char label[512];
+    for (int i : order) {
+        const PrecisionSweepResult& r = results[i];
+        precision_policy_label(r.policy, label, sizeof(label));
+        fprintf(f, "%c %10.3f %8.4f %+8.4f  %15.6g  %s\n", (r.top1_delta >= -budget) ? '*' : ' ',
+                r.ms_per_image, r.top1, r.top1_delta, r.max_logit_error, label);
+    }
+    if (best >= 0) {
+        precision_policy_label(results[best].policy, label, sizeof(label));
+        fprintf(f, "# fastest within budget: %s\n", label);
+    }
+    if (fclose(f) != 0 || (best >= 0 && !precision_policy_write(policy_path, results[best].policy))) {
+        return -1;
+    }
+    return N;
+}
+
+#endif // __SYNTHESIS__
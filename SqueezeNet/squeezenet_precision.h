@@ -0,0 +1,119 @@
+#ifndef SQUEEZENET_PRECISION_H
+#define SQUEEZENET_PRECISION_H
+
+#include "squeezenet_params.h"
+
+// ==========================================================================
+// === Per-Layer Mixed Precision (Host Builds Only) =========================
+// ==========================================================================
+// A precision policy gives every network step of SqueezeNet() its own
+// arithmetic: fp32 (the CHW float steps of squeezenet.cpp) or int8 (the
+// kernels of squeezenet_quant.h). Pools run on their producer's map, so
+// conv1, fire4 and fire8 take pool1/4/8 along, and conv10 takes the GAP.
+// squeezenet_mixed() inserts a conversion wherever two neighbouring steps
+// disagree: a float map is quantized at the calibrated scale of its tensor
+// (the scale the int8 step was quantized for), and an int8 map is scaled
+// back to a float map. Like INT8, a policy with int8 steps needs activation
+// ranges.
+//
+// Policies are read from a text file, one "<layer> <precision>" pair per
+// line; "default <precision>" covers the layers that are not named, and
+// layers left out without a default run fp32. '#' starts a comment.
+//   # Keep the first and last layer in float
+//   default int8
+//   conv1   fp32
+//   conv10  fp32
+//
+// The sweep runs a validation set under a list of policies and measures
+// each one's mean latency, its top-1 change and its largest logit change
+// against fp32, so the fastest policy within an accuracy budget can be
+// picked.
+// ==========================================================================
+
+// Arithmetic of one step
+enum LayerPrecision {
+    LAYER_FP32,
+    LAYER_INT8,
+    LAYER_NUM_PRECISIONS
+};
+
+// Steps with their own precision, as the calibration scale file names them
+enum PolicyLayer {
+    POLICY_CONV1,    // conv1 + pool1
+    POLICY_FIRE2, POLICY_FIRE3,
+    POLICY_FIRE4,    // fire4 + pool4
+    POLICY_FIRE5, POLICY_FIRE6, POLICY_FIRE7,
+    POLICY_FIRE8,    // fire8 + pool8
+    POLICY_FIRE9,
+    POLICY_CONV10,   // conv10 + GAP
+    POLICY_NUM_LAYERS
+};
+
+struct PrecisionPolicy {
+    LayerPrecision layer[POLICY_NUM_LAYERS];
+};
+
+// Names used in policy files ("conv1", "fire2", ..., "conv10"; "fp32", "int8")
+const char* policy_layer_name(int layer);
+const char* layer_precision_name(int precision);
+
+// Every layer at one precision
+PrecisionPolicy uniform_precision_policy(LayerPrecision precision);
+
+// Read a policy file. False, with `policy` unchanged, if the file cannot be
+// read or names an unknown layer or precision.
+bool precision_policy_load(const char* path, PrecisionPolicy& policy);
+
+// Write every layer's precision in the same format. False on I/O errors.
+bool precision_policy_write(const char* path, const PrecisionPolicy& policy);
+
+// One-line description: the most common precision, then the exceptions
+// ("int8 except conv1=fp32,conv10=fp32")
+void precision_policy_label(const PrecisionPolicy& policy, char label[], int size);
+
+// Run SqueezeNet() under this policy. Uniform policies select PRECISION_FP32
+// or PRECISION_INT8, anything else PRECISION_MIXED (squeezenet_quant.h).
+// False, with nothing changed, if the policy has int8 steps but no
+// activation ranges are set or can be loaded from SQUEEZENET_SCALE_FILE.
+bool set_precision_policy(const PrecisionPolicy& policy);
+const PrecisionPolicy& precision_policy();
+
+//--------------------------------------------------------------------------
+// Latency / Accuracy Sweep
+//--------------------------------------------------------------------------
+#define PRECISION_MAX_CANDIDATES 32 // Policies precision_policy_candidates() returns at most
+
+// The standard candidates: uniform fp32 and int8, int8 with each single
+// layer kept in fp32 (which layers are sensitive), and int8 with both conv1
+// and conv10 in fp32. Returns the count.
+int precision_policy_candidates(PrecisionPolicy policies[PRECISION_MAX_CANDIDATES]);
+
+struct PrecisionSweepResult {
+    PrecisionPolicy policy;
+    double ms_per_image;    // Mean SqueezeNet() latency over the set
+    double top1;            // Top-1 accuracy against the labels (agreement with fp32 without labels)
+    double top1_delta;      // top1 minus fp32's
+    double max_logit_error; // Largest |logit - fp32 logit| over the set (meaningful even when classes tie)
+};
+
+// Run N images (INPUT_C x INPUT_H x INPUT_W each) under fp32 and then under
+// each policy: one untimed warm-up call (weight packing), then the timed
+// pass. Without labels (NULL), top-1 is the fraction of images whose class
+// matches fp32's. If a policy needs int8 ranges and none are set or in
+// SQUEEZENET_SCALE_FILE, they are calibrated on the images first. The
+// selected precision and policy are restored afterwards. Returns the index
+// of the fastest policy with top1_delta >= -budget, or -1 if none is.
+int squeezenet_precision_sweep(int N, const float images[], const int labels[],
+                               const PrecisionPolicy policies[], int count, double budget,
+                               PrecisionSweepResult results[]);
+
+// The sweep tool: the candidates over a validation directory of raw images
+// (as squeezenet_calibrate_directory(); with a "labels.txt" of
+// "<file name> <class>" lines, top-1 is measured against it). Writes the
+// report, fastest first, to report_path, and the fastest policy within the
+// budget to policy_path (a policy file). Returns the number of images used,
+// or -1 if there are none or a file cannot be written.
+int squeezenet_precision_sweep_directory(const char* dir, double budget,
+                                         const char* report_path, const char* policy_path);
+
+#endif // SQUEEZENET_PRECISION_H
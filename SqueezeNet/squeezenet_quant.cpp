@@ -0,0 +1,578 @@
+#include "squeezenet_quant.h"
+#include "squeezenet.h"
+#include "squeezenet_calibration.h"
+#include "squeezenet_simd.h"
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side int8 path only; HLS keeps the float design
+
+#include <algorithm> // For std::min, std::max, std::fill
+#include <cmath>     // For std::fabs, std::nearbyint
+#include <cstring>   // For memcpy
+#include <memory>    // For std::unique_ptr
+#include <vector>    // For the packed layers
+
+static InferencePrecision current_precision = PRECISION_FP32;
+
+//--------------------------------------------------------------------------
+// Quantized Layers
+//--------------------------------------------------------------------------
+// One convolution's packed int8 weights ([OCB][KH][KW][ICG][16 o][4 i],
+// padding channels zero) with the int32 bias and requantization multiplier
+// of every (padded) output channel
+struct QuantLayer {
+    std::vector<int8_t> weights;
+    std::vector<int32_t> bias;
+    std::vector<float> scale;
+    int OutC, K, ICG, OCB;
+};
+
+struct QuantFire {
+    QuantLayer squeeze, expand1x1, expand3x3;
+};
+
+struct QuantNet {
+    bool ready;
+    float range[QUANT_NUM_TENSORS];
+    float act_scale[QUANT_NUM_TENSORS];
+    QuantLayer conv1;
+    QuantFire fire[8]; // fire2 .. fire9
+    QuantLayer conv10;
+};
+
+static QuantNet net;
+
+static const char* const tensor_names[QUANT_NUM_TENSORS] = {
+    "input", "conv1",
+    "fire2/squeeze", "fire2", "fire3/squeeze", "fire3", "fire4/squeeze", "fire4",
+    "fire5/squeeze", "fire5", "fire6/squeeze", "fire6", "fire7/squeeze", "fire7",
+    "fire8/squeeze", "fire8", "fire9/squeeze", "fire9",
+    "conv10",
+};
+
+// Scale/index helpers for fire n (2 .. 9)
+#define QUANT_SQUEEZE(n) (QUANT_SQUEEZE2 + 2 * ((n) - 2))
+#define QUANT_FIRE(n) (QUANT_SQUEEZE(n) + 1)
+
+const char* quant_tensor_name(int tensor) {
+    return (tensor >= 0 && tensor < QUANT_NUM_TENSORS) ? tensor_names[tensor] : "?";
+}
+
+// Quantize (OutC, InC, K, K) float weights per output channel. The input is
+// in_scale per step with zero point in_zero; the int32 sum is rescaled to
+// out_scale.
+static void quantize_layer(QuantLayer& layer, const float weights[], const float biases[],
+                           int OutC, int InC, int K,
+                           float in_scale, int in_zero, float out_scale)
+{
+    const int KK = K * K;
+    layer.OutC = OutC;
+    layer.K = K;
+    layer.ICG = (InC + QUANT_IC_GROUP - 1) / QUANT_IC_GROUP;
+    layer.OCB = (OutC + QUANT_OC_BLOCK - 1) / QUANT_OC_BLOCK;
+    const int block = KK * layer.ICG * QUANT_OC_BLOCK * QUANT_IC_GROUP;
+    layer.weights.assign((size_t)layer.OCB * block, 0);
+    layer.bias.assign(layer.OCB * QUANT_OC_BLOCK, 0);
+    layer.scale.assign(layer.OCB * QUANT_OC_BLOCK, 0.0f);
+
+    for (int oc = 0; oc < OutC; ++oc) {
+        const float* w_oc = weights + (size_t)oc * InC * KK;
+        float w_max = 0.0f;
+        for (int i = 0; i < InC * KK; ++i) {
+            w_max = std::max(w_max, std::fabs(w_oc[i]));
+        }
+        const float w_scale = (w_max > 0.0f) ? w_max / 127.0f : 1.0f;
+
+        int8_t* dst = layer.weights.data() + (size_t)(oc / QUANT_OC_BLOCK) * block;
+        const int o = oc % QUANT_OC_BLOCK;
+        int32_t w_sum = 0;
+        for (int ic = 0; ic < InC; ++ic) {
+            for (int k = 0; k < KK; ++k) {
+                float q = std::nearbyint(w_oc[ic * KK + k] / w_scale);
+                int qi = (int)std::min(std::max(q, -127.0f), 127.0f);
+                int g = ic / QUANT_IC_GROUP;
+                dst[((k * layer.ICG + g) * QUANT_OC_BLOCK + o) * QUANT_IC_GROUP + ic % QUANT_IC_GROUP] = (int8_t)qi;
+                w_sum += qi;
+            }
+        }
+
+        // The bias is added in accumulator units; the input zero point adds
+        // in_zero * sum(w) to every sum, which the bias takes back out
+        const float acc_scale = in_scale * w_scale;
+        double b = std::nearbyint((double)biases[oc] / acc_scale);
+        b = std::min(std::max(b, -1073741824.0), 1073741824.0);
+        layer.bias[oc] = (int32_t)b - in_zero * w_sum;
+        layer.scale[oc] = acc_scale / out_scale;
+    }
+}
+
+static void quantize_fire(QuantFire& fire, float in_scale, float squeeze_scale, float out_scale,
+                          const float squeeze_weights[], const float squeeze_biases[], int InC, int SqueezeC,
+                          const float expand1x1_weights[], const float expand1x1_biases[], int Expand1x1C,
+                          const float expand3x3_weights[], const float expand3x3_biases[], int Expand3x3C)
+{
+    quantize_layer(fire.squeeze, squeeze_weights, squeeze_biases, SqueezeC, InC, 1,
+                   in_scale, 0, squeeze_scale);
+    quantize_layer(fire.expand1x1, expand1x1_weights, expand1x1_biases, Expand1x1C, SqueezeC, 1,
+                   squeeze_scale, 0, out_scale);
+    quantize_layer(fire.expand3x3, expand3x3_weights, expand3x3_biases, Expand3x3C, SqueezeC, 3,
+                   squeeze_scale, 0, out_scale);
+}
+
+void squeezenet_int8_set_ranges(const float ranges[QUANT_NUM_TENSORS]) {
+    for (int t = 0; t < QUANT_NUM_TENSORS; ++t) {
+        net.range[t] = ranges[t];
+        // Signed input: [-128, 127] steps around zero point 128; the rest are
+        // post-ReLU: [0, 255]
+        float steps = (t == QUANT_INPUT) ? 127.0f : 255.0f;
+        net.act_scale[t] = (ranges[t] > 0.0f) ? ranges[t] / steps : 1.0f;
+    }
+    const float* s = net.act_scale;
+
+    quantize_layer(net.conv1, conv1_weights, conv1_biases, CONV1_C_OUT, INPUT_C, CONV1_KH,
+                   s[QUANT_INPUT], 128, s[QUANT_CONV1]);
+
+#define QUANTIZE_FIRE(n) \
+    quantize_fire(net.fire[(n) - 2], s[QUANT_SQUEEZE(n) - 1], s[QUANT_SQUEEZE(n)], s[QUANT_FIRE(n)], \
+                  fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, FIRE##n##_C_IN, FIRE##n##_S1x1, \
+                  fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, FIRE##n##_E1x1, \
+                  fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, FIRE##n##_E3x3)
+    QUANTIZE_FIRE(2); QUANTIZE_FIRE(3); QUANTIZE_FIRE(4); QUANTIZE_FIRE(5);
+    QUANTIZE_FIRE(6); QUANTIZE_FIRE(7); QUANTIZE_FIRE(8); QUANTIZE_FIRE(9);
+#undef QUANTIZE_FIRE
+
+    quantize_layer(net.conv10, conv10_weights, conv10_biases, CONV10_C_OUT, CONV10_C_IN, CONV10_KH,
+                   s[QUANT_FIRE(9)], 0, s[QUANT_CONV10]);
+    net.ready = true;
+}
+
+bool squeezenet_int8_ranges(float ranges[QUANT_NUM_TENSORS]) {
+    if (!net.ready) {
+        return false;
+    }
+    memcpy(ranges, net.range, sizeof(net.range));
+    return true;
+}
+
+// Whether the policy has int8 steps
+static bool policy_uses_int8(const PrecisionPolicy& policy) {
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        if (policy.layer[l] == LAYER_INT8) return true;
+    }
+    return false;
+}
+
+bool set_inference_precision(InferencePrecision precision) {
+    bool needs_ranges = precision == PRECISION_INT8 ||
+                        (precision == PRECISION_MIXED && policy_uses_int8(precision_policy()));
+    if (needs_ranges && !net.ready && !squeezenet_int8_load_ranges(SQUEEZENET_SCALE_FILE)) {
+        return false;
+    }
+    current_precision = precision;
+    return true;
+}
+
+InferencePrecision inference_precision() {
+    return current_precision;
+}
+
+//--------------------------------------------------------------------------
+// Calibration
+//--------------------------------------------------------------------------
+bool squeezenet_int8_load_ranges(const char* path) {
+    float ranges[QUANT_NUM_TENSORS];
+    if (!calibration_load_ranges(path, tensor_names, QUANT_NUM_TENSORS, ranges)) {
+        return false;
+    }
+    squeezenet_int8_set_ranges(ranges);
+    return true;
+}
+
+void squeezenet_int8_calibrate(int N, const float input_images[]) {
+    std::unique_ptr<InferenceContext> ctx(new InferenceContext);
+    float logits[NUM_CLASSES];
+    calibration_begin();
+    for (int n = 0; n < N; ++n) {
+        squeezenet_inference(*ctx, input_images + (size_t)n * INPUT_C * INPUT_H * INPUT_W, logits);
+    }
+    calibration_end();
+
+    float ranges[QUANT_NUM_TENSORS];
+    for (int t = 0; t < QUANT_NUM_TENSORS; ++t) {
+        ranges[t] = calibration_range(tensor_names[t]);
+    }
+    squeezenet_int8_set_ranges(ranges);
+}
+
+//--------------------------------------------------------------------------
+// Int8 Maps (channels innermost)
+//--------------------------------------------------------------------------
+struct QuantMap {
+    uint8_t* data; // Pixel (h, w) starts at data[h * rstride + w * pstride]
+    int H, W, C;
+    int pstride;   // Bytes per pixel (C rounded up to whole groups/blocks)
+    int rstride;   // Bytes per row
+};
+
+constexpr int quant_round_up(int c, int m) {
+    return (c + m - 1) / m * m;
+}
+
+// Bytes per pixel of a convolution output (the kernels store whole blocks)
+constexpr int quant_out_pstride(int C) {
+    return quant_round_up(C, QUANT_OC_BLOCK);
+}
+
+constexpr int quant_map_bytes(int H, int W, int pstride, int halo) {
+    return (H + 2 * halo) * (W + 2 * halo) * pstride;
+}
+
+constexpr int quant_max(int a, int b) {
+    return a > b ? a : b;
+}
+
+static QuantMap quant_map(uint8_t buf[], int H, int W, int C, int pstride, int halo) {
+    QuantMap map;
+    map.H = H;
+    map.W = W;
+    map.C = C;
+    map.pstride = pstride;
+    map.rstride = (W + 2 * halo) * pstride;
+    map.data = buf + halo * map.rstride + halo * pstride;
+    return map;
+}
+
+// Fill the `halo`-pixel border around a map with `value` (the zero point)
+static void quant_fill_halo(const QuantMap& map, int halo, uint8_t value) {
+    if (halo == 0) {
+        return;
+    }
+    const int row_bytes = (map.W + 2 * halo) * map.pstride;
+    const int side_bytes = halo * map.pstride;
+    for (int r = 1; r <= halo; ++r) {
+        memset(map.data - r * map.rstride - side_bytes, value, row_bytes);
+        memset(map.data + (map.H - 1 + r) * map.rstride - side_bytes, value, row_bytes);
+    }
+    for (int h = 0; h < map.H; ++h) {
+        uint8_t* row = map.data + h * map.rstride;
+        memset(row - side_bytes, value, side_bytes);
+        memset(row + map.W * map.pstride, value, side_bytes);
+    }
+}
+
+// Byte buffers of one int8 inference, carved from the float arena: two
+// ping-pong maps (every layer reads one and writes the other) and the fire
+// squeeze map with its 3x3 halo
+#define QUANT_FIRE_BYTES(n) quant_map_bytes(FIRE##n##_H_OUT, FIRE##n##_W_OUT, quant_out_pstride(FIRE##n##_C_OUT), 0)
+#define QUANT_SQUEEZE_BYTES(n) quant_map_bytes(FIRE##n##_H_OUT, FIRE##n##_W_OUT, quant_out_pstride(FIRE##n##_S1x1), 1)
+
+#define QUANT_MAP_BYTES quant_max( \
+    quant_max(quant_map_bytes(INPUT_H, INPUT_W, quant_round_up(INPUT_C, QUANT_IC_GROUP), CONV1_P), \
+              quant_map_bytes(CONV1_H_OUT, CONV1_W_OUT, quant_out_pstride(CONV1_C_OUT), 0)), \
+    quant_max(quant_max(QUANT_FIRE_BYTES(2), QUANT_FIRE_BYTES(4)), \
+              quant_max(QUANT_FIRE_BYTES(8), QUANT_FIRE_BYTES(9))))
+#define QUANT_SQUEEZE_MAP_BYTES quant_max( \
+    quant_max(QUANT_SQUEEZE_BYTES(2), QUANT_SQUEEZE_BYTES(4)), \
+    quant_max(QUANT_SQUEEZE_BYTES(8), QUANT_SQUEEZE_BYTES(9)))
+#define QUANT_ARENA_BYTES (2 * quant_round_up(QUANT_MAP_BYTES, 64) + QUANT_SQUEEZE_MAP_BYTES)
+
+static_assert(QUANT_ARENA_BYTES <= (long)SQUEEZENET_ARENA_SIZE * (long)sizeof(float),
+              "int8 maps must fit in the SqueezeNet arena");
+static_assert(CONV10_KH == 1 && CONV10_S == 1 && CONV10_P == 0, "int8 classifier expects a 1x1 conv10");
+static_assert(FIRE2_E1x1 % QUANT_OC_BLOCK == 0 && FIRE4_E1x1 % QUANT_OC_BLOCK == 0 &&
+              FIRE6_E1x1 % QUANT_OC_BLOCK == 0 && FIRE8_E1x1 % QUANT_OC_BLOCK == 0,
+              "expand 3x3 must start on a whole channel block of the fire output");
+
+//--------------------------------------------------------------------------
+// Int8 Layers
+//--------------------------------------------------------------------------
+// Image (float CHW) -> uint8 pixels with zero point 128
+static void quantize_input(const float input[], const QuantMap& map, float scale) {
+    const int HW = map.H * map.W;
+    const float inv = 1.0f / scale;
+    for (int h = 0; h < map.H; ++h) {
+        for (int w = 0; w < map.W; ++w) {
+            uint8_t* px = map.data + h * map.rstride + w * map.pstride;
+            for (int c = 0; c < map.pstride; ++c) {
+                float q = (c < map.C) ? std::nearbyint(input[c * HW + h * map.W + w] * inv) + 128.0f : 0.0f;
+                px[c] = (uint8_t)std::min(std::max(q, 0.0f), 255.0f);
+            }
+        }
+    }
+    quant_fill_halo(map, CONV1_P, 128);
+}
+
+// Convolution + requantize + ReLU into `output` (its data may point into a
+// channel slice of a wider map). The input must carry a halo of P pixels.
+static void convolution_int8(const QuantMap& input, const QuantLayer& layer,
+                             const QuantMap& output, int S, int P)
+{
+    const SimdKernels& simd = simd_kernels();
+    const int K = layer.K;
+    const int block = K * K * layer.ICG * QUANT_OC_BLOCK * QUANT_IC_GROUP;
+
+    // Work items are (output channel block x band of output rows), as in
+    // convolution_nchw8c()
+    const double row_cost = (double)output.W * QUANT_OC_BLOCK * layer.ICG * QUANT_IC_GROUP * K * K;
+    const int tasks = parallel_task_count(row_cost * output.H * layer.OCB);
+    const int row_tiles = std::min((tasks + layer.OCB - 1) / layer.OCB, output.H);
+    const int row_tile = (output.H + row_tiles - 1) / row_tiles;
+
+    parallel_for(layer.OCB * row_tiles, row_cost * row_tile, [&](int begin, int end) {
+        for (int item = begin; item < end; ++item) {
+            int ocb = item / row_tiles;
+            int oh0 = (item % row_tiles) * row_tile;
+            int oh1 = std::min(oh0 + row_tile, output.H);
+            const int8_t* w = layer.weights.data() + (size_t)ocb * block;
+            const int32_t* bias = layer.bias.data() + ocb * QUANT_OC_BLOCK;
+            const float* scale = layer.scale.data() + ocb * QUANT_OC_BLOCK;
+
+            for (int oh = oh0; oh < oh1; ++oh) {
+                const uint8_t* in_row = input.data + (oh * S - P) * input.rstride;
+                uint8_t* out_row = output.data + oh * output.rstride + ocb * QUANT_OC_BLOCK;
+                for (int ow = 0; ow < output.W; ow += NCHWC_TILE) {
+                    int n = std::min(NCHWC_TILE, output.W - ow);
+                    simd.conv_u8s8(in_row + (ow * S - P) * input.pstride, input.pstride, input.rstride, S,
+                                   w, layer.ICG, K, K, n, bias, scale,
+                                   out_row + ow * output.pstride, output.pstride);
+                }
+            }
+        }
+    });
+}
+
+// Max pooling on the bytes (no padding, windows clipped at the bottom/right
+// edge like max_pooling()); the scale carries over unchanged
+static void max_pooling_int8(const QuantMap& input, const QuantMap& output, int K, int S) {
+    const int C = output.pstride;
+    parallel_for(output.H, (double)output.W * C * K * K, [&](int oh0, int oh1) {
+        for (int oh = oh0; oh < oh1; ++oh) {
+            int rows = std::min(K, input.H - oh * S);
+            for (int ow = 0; ow < output.W; ++ow) {
+                int cols = std::min(K, input.W - ow * S);
+                uint8_t* out = output.data + oh * output.rstride + ow * output.pstride;
+                const uint8_t* in = input.data + oh * S * input.rstride + ow * S * input.pstride;
+                memcpy(out, in, C);
+                for (int kh = 0; kh < rows; ++kh) {
+                    for (int kw = 0; kw < cols; ++kw) {
+                        const uint8_t* px = in + kh * input.rstride + kw * input.pstride;
+                        for (int c = 0; c < C; ++c) out[c] = std::max(out[c], px[c]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+// Fire module: squeeze into the haloed squeeze map, then both expand layers
+// into their channel half of `output`
+static void fire_module_int8(const QuantMap& input, const QuantMap& output,
+                             const QuantFire& fire, uint8_t squeeze_buf[])
+{
+    QuantMap squeeze = quant_map(squeeze_buf, input.H, input.W, fire.squeeze.OutC,
+                                 quant_out_pstride(fire.squeeze.OutC), 1);
+    quant_fill_halo(squeeze, 1, 0);
+    convolution_int8(input, fire.squeeze, squeeze, 1, 0);
+
+    QuantMap expand3x3_out = output;
+    expand3x3_out.data += fire.expand1x1.OutC;
+    parallel_branches((double)output.H * output.W * squeeze.pstride *
+                      (fire.expand1x1.OutC + 9 * fire.expand3x3.OutC), {
+        [&] { convolution_int8(squeeze, fire.expand1x1, output, 1, 0); },
+        [&] { convolution_int8(squeeze, fire.expand3x3, expand3x3_out, 1, 1); }
+    });
+}
+
+// Float CHW map (post-ReLU) -> uint8 pixels with zero point 0
+static void quantize_map(const float input[], const QuantMap& map, float scale) {
+    const int HW = map.H * map.W;
+    const float inv = 1.0f / scale;
+    parallel_for(map.H, (double)map.W * map.pstride, [&](int h0, int h1) {
+        for (int h = h0; h < h1; ++h) {
+            for (int w = 0; w < map.W; ++w) {
+                uint8_t* px = map.data + h * map.rstride + w * map.pstride;
+                for (int c = 0; c < map.pstride; ++c) {
+                    float q = (c < map.C) ? std::nearbyint(input[c * HW + h * map.W + w] * inv) : 0.0f;
+                    px[c] = (uint8_t)std::min(std::max(q, 0.0f), 255.0f);
+                }
+            }
+        }
+    });
+}
+
+// uint8 pixels -> float CHW map
+static void dequantize_map(const QuantMap& map, float output[], float scale) {
+    const int HW = map.H * map.W;
+    parallel_for(map.C, (double)HW, [&](int c0, int c1) {
+        for (int c = c0; c < c1; ++c) {
+            for (int h = 0; h < map.H; ++h) {
+                const uint8_t* row = map.data + h * map.rstride + c;
+                for (int w = 0; w < map.W; ++w) {
+                    output[c * HW + h * map.W + w] = (float)row[w * map.pstride] * scale;
+                }
+            }
+        }
+    });
+}
+
+// Global average pooling of conv10's bytes back to float logits
+static void global_average_pooling_int8(const QuantMap& input, float output[], float scale) {
+    int32_t sum[NUM_CLASSES] = {};
+    for (int h = 0; h < input.H; ++h) {
+        for (int w = 0; w < input.W; ++w) {
+            const uint8_t* px = input.data + h * input.rstride + w * input.pstride;
+            for (int c = 0; c < input.C; ++c) sum[c] += px[c];
+        }
+    }
+    const float to_float = scale / (float)(input.H * input.W);
+    for (int c = 0; c < input.C; ++c) {
+        output[c] = (float)sum[c] * to_float;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Whole Network
+//--------------------------------------------------------------------------
+// The map between two steps: a float CHW map at its planned arena offset,
+// or an int8 map in one of the two ping-pong byte buffers
+struct MixedMap {
+    bool int8;
+    QuantMap q;  // The int8 map
+    int buf;     // Byte buffer holding it
+};
+
+// Make `map` int8 for a step that reads it: a float map (H x W x C at
+// `input`) is quantized at its tensor's scale into byte buffer 0
+static void mixed_to_int8(MixedMap& map, const float input[], int H, int W, int C, int tensor,
+                          uint8_t* const bufs[2])
+{
+    if (map.int8) {
+        return;
+    }
+    map.q = quant_map(bufs[0], H, W, C, quant_out_pstride(C), 0);
+    map.buf = 0;
+    map.int8 = true;
+    quantize_map(input, map.q, net.act_scale[tensor]);
+}
+
+// Make `map` float for a step that reads it at `output` (its planned tensor)
+static void mixed_to_float(MixedMap& map, float output[], int tensor) {
+    if (!map.int8) {
+        return;
+    }
+    dequantize_map(map.q, output, net.act_scale[tensor]);
+    map.int8 = false;
+}
+
+// The steps of squeezenet_inference() at the policy's precisions. The byte
+// buffers (bytes) hold two ping-pong maps, which every int8 layer reads one
+// of and writes the other, and the fire squeeze map with its 3x3 halo.
+static void run_mixed(float arena[], uint8_t bytes[], const PrecisionPolicy& policy,
+                      const float input_image[], float output_logits[NUM_CLASSES])
+{
+    uint8_t* const bufs[2] = {bytes, bytes + quant_round_up(QUANT_MAP_BYTES, 64)};
+    uint8_t* buf_squeeze = bufs[1] + quant_round_up(QUANT_MAP_BYTES, 64);
+    const LayerPrecision* precision = policy.layer;
+    MixedMap map;
+
+#define QUANT_FIRE_MAP(n, buf) \
+    quant_map(buf, FIRE##n##_H_OUT, FIRE##n##_W_OUT, FIRE##n##_C_OUT, quant_out_pstride(FIRE##n##_C_OUT), 0)
+#define QUANT_POOL_MAP(n, buf, C) quant_map(buf, POOL##n##_H_OUT, POOL##n##_W_OUT, C, quant_out_pstride(C), 0)
+
+    // Conv1 + ReLU, pool1
+    if (precision[POLICY_CONV1] == LAYER_INT8) {
+        QuantMap image = quant_map(bufs[0], INPUT_H, INPUT_W, INPUT_C,
+                                   quant_round_up(INPUT_C, QUANT_IC_GROUP), CONV1_P);
+        quantize_input(input_image, image, net.act_scale[QUANT_INPUT]);
+        QuantMap conv1 = quant_map(bufs[1], CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
+                                   quant_out_pstride(CONV1_C_OUT), 0);
+        convolution_int8(image, net.conv1, conv1, CONV1_S, CONV1_P);
+        map.q = QUANT_POOL_MAP(1, bufs[0], CONV1_C_OUT);
+        map.buf = 0;
+        map.int8 = true;
+        max_pooling_int8(conv1, map.q, POOL1_K, POOL1_S);
+    } else {
+        squeezenet_step_conv1(arena, input_image, squeezenet_tensor(arena, ARENA_POOL1));
+        map.int8 = false;
+    }
+
+    // Fire n on an InH x InW map (its input is tensor In of the arena plan)
+#define MIXED_FIRE(n, InH, InW, In, Out) \
+    if (precision[POLICY_FIRE##n] == LAYER_INT8) { \
+        mixed_to_int8(map, squeezenet_tensor(arena, In), InH, InW, FIRE##n##_C_IN, QUANT_SQUEEZE(n) - 1, bufs); \
+        QuantMap fire = QUANT_FIRE_MAP(n, bufs[1 - map.buf]); \
+        fire_module_int8(map.q, fire, net.fire[(n) - 2], buf_squeeze); \
+        map.q = fire; \
+        map.buf = 1 - map.buf; \
+    } else { \
+        mixed_to_float(map, squeezenet_tensor(arena, In), QUANT_SQUEEZE(n) - 1); \
+        squeezenet_step_fire##n(arena, squeezenet_tensor(arena, In), squeezenet_tensor(arena, Out)); \
+    }
+
+    // Fire n + MaxPool (the int8 pool writes back into the input's buffer)
+#define MIXED_FIRE_POOL(n, InH, InW, In, Out, PoolN) \
+    if (precision[POLICY_FIRE##n] == LAYER_INT8) { \
+        mixed_to_int8(map, squeezenet_tensor(arena, In), InH, InW, FIRE##n##_C_IN, QUANT_SQUEEZE(n) - 1, bufs); \
+        QuantMap fire = QUANT_FIRE_MAP(n, bufs[1 - map.buf]); \
+        fire_module_int8(map.q, fire, net.fire[(n) - 2], buf_squeeze); \
+        map.q = QUANT_POOL_MAP(PoolN, bufs[map.buf], FIRE##n##_C_OUT); \
+        max_pooling_int8(fire, map.q, POOL##PoolN##_K, POOL##PoolN##_S); \
+    } else { \
+        mixed_to_float(map, squeezenet_tensor(arena, In), QUANT_SQUEEZE(n) - 1); \
+        squeezenet_step_fire##n(arena, squeezenet_tensor(arena, In), squeezenet_tensor(arena, Out)); \
+    }
+
+    MIXED_FIRE(2, POOL1_H_OUT, POOL1_W_OUT, ARENA_POOL1, ARENA_FIRE2)
+    MIXED_FIRE(3, FIRE2_H_OUT, FIRE2_W_OUT, ARENA_FIRE2, ARENA_FIRE3)
+    MIXED_FIRE_POOL(4, FIRE3_H_OUT, FIRE3_W_OUT, ARENA_FIRE3, ARENA_POOL4, 4)
+    MIXED_FIRE(5, POOL4_H_OUT, POOL4_W_OUT, ARENA_POOL4, ARENA_FIRE5)
+    MIXED_FIRE(6, FIRE5_H_OUT, FIRE5_W_OUT, ARENA_FIRE5, ARENA_FIRE6)
+    MIXED_FIRE(7, FIRE6_H_OUT, FIRE6_W_OUT, ARENA_FIRE6, ARENA_FIRE7)
+    MIXED_FIRE_POOL(8, FIRE7_H_OUT, FIRE7_W_OUT, ARENA_FIRE7, ARENA_POOL8, 8)
+    MIXED_FIRE(9, POOL8_H_OUT, POOL8_W_OUT, ARENA_POOL8, ARENA_FIRE9)
+
+    // Conv10 + ReLU, GAP
+    if (precision[POLICY_CONV10] == LAYER_INT8) {
+        mixed_to_int8(map, squeezenet_tensor(arena, ARENA_FIRE9), FIRE9_H_OUT, FIRE9_W_OUT, CONV10_C_IN,
+                      QUANT_FIRE(9), bufs);
+        QuantMap conv10 = quant_map(bufs[1 - map.buf], CONV10_H_OUT, CONV10_W_OUT, CONV10_C_OUT,
+                                    quant_out_pstride(CONV10_C_OUT), 0);
+        convolution_int8(map.q, net.conv10, conv10, 1, 0);
+        global_average_pooling_int8(conv10, output_logits, net.act_scale[QUANT_CONV10]);
+    } else {
+        mixed_to_float(map, squeezenet_tensor(arena, ARENA_FIRE9), QUANT_FIRE(9));
+        squeezenet_step_classifier(arena, squeezenet_tensor(arena, ARENA_FIRE9), output_logits);
+    }
+
+#undef QUANT_FIRE_MAP
+#undef QUANT_POOL_MAP
+#undef MIXED_FIRE
+#undef MIXED_FIRE_POOL
+}
+
+void squeezenet_int8(float arena[], const float input_image[], float output_logits[NUM_CLASSES]) {
+    if (!net.ready) {
+        // No activation ranges yet (set_inference_precision() prevents this)
+        std::fill(output_logits, output_logits + NUM_CLASSES, 0.0f);
+        return;
+    }
+    // No float steps, so the byte buffers can take the arena itself
+    run_mixed(arena, reinterpret_cast<uint8_t*>(arena), uniform_precision_policy(LAYER_INT8),
+              input_image, output_logits);
+}
+
+void squeezenet_mixed(float arena[], const PrecisionPolicy& policy,
+                      const float input_image[], float output_logits[NUM_CLASSES])
+{
+    if (policy_uses_int8(policy) && !net.ready) {
+        std::fill(output_logits, output_logits + NUM_CLASSES, 0.0f);
+        return;
+    }
+    // The float maps use the whole arena plan, so the int8 maps get their
+    // own per-thread buffers
+    static thread_local std::vector<uint8_t> bytes;
+    bytes.resize(QUANT_ARENA_BYTES);
+    run_mixed(arena, bytes.data(), policy, input_image, output_logits);
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,96 @@
+#ifndef SQUEEZENET_QUANT_H
+#define SQUEEZENET_QUANT_H
+
+#include "squeezenet_params.h"
+#include "squeezenet_precision.h" // For PrecisionPolicy
+
+// ==========================================================================
+// === INT8 Post-Training-Quantized Inference (Host Builds Only) ============
+// ==========================================================================
+// squeezenet_int8() runs the SqueezeNet() layer sequence (conv1, pool1,
+// fire2-4, pool4, fire5-8, pool8, fire9, conv10, GAP) on 8-bit data:
+//   - Weights: symmetric int8 in [-127, 127] with one scale per output
+//     channel (max |w| / 127), quantized from squeezenet_weights.h once and
+//     packed for the conv_u8s8 kernels (squeezenet_simd.h).
+//   - Activations: one scale per tensor (the largest value seen during
+//     calibration / 255). Every tensor after conv1 follows a ReLU, so it is
+//     stored as uint8 with zero point 0 and zero padding stays plain zero
+//     bytes. The input image is signed and uses zero point 128; its
+//     correction, -128 * sum(w), is folded into conv1's int32 bias.
+//   - Arithmetic: u8 x s8 products summed in int32 (VNNI vpdpbusd, or AVX2
+//     vpmaddubsw + vpmaddwd), then bias, rescale to the output tensor's
+//     scale, ReLU and rounding to uint8 are fused into the kernel's store.
+// Maps keep the channels of a pixel innermost (NHWC), so one input dword
+// feeds four multiply-adds into 16 output channels, fire concatenation is a
+// byte offset within the pixel, and max pooling works on the bytes as they
+// are (the scale does not change). GAP sums conv10's bytes in int32 and
+// scales them back to float logits.
+//
+// Activation scales come from calibration (squeezenet_calibration.h): a
+// tensor's range is the CALIBRATION_PERCENTILE of its |x|, so rare outliers
+// saturate instead of costing every other value resolution. The ranges are
+// loaded from a scale file written by a calibration session, or measured on
+// the spot by squeezenet_int8_calibrate().
+// ==========================================================================
+
+// Arithmetic squeezenet_inference() (and so SqueezeNet()) uses on the host;
+// SqueezeNetBatch() and the frame pipeline always run fp32
+enum InferencePrecision {
+    PRECISION_FP32,  // Float weights and activations (default)
+    PRECISION_INT8,  // squeezenet_int8() (this file)
+    PRECISION_MIXED  // squeezenet_mixed() under precision_policy() (squeezenet_precision.h)
+};
+
+// Select the precision. INT8, and MIXED with int8 steps in the policy, need
+// activation ranges: if none were set yet they are loaded from
+// SQUEEZENET_SCALE_FILE, and if that fails this returns false and keeps the
+// current precision.
+bool set_inference_precision(InferencePrecision precision);
+InferencePrecision inference_precision();
+
+// Activation tensors with their own scale
+enum QuantTensor {
+    QUANT_INPUT,     // Image (signed: range is max |x|)
+    QUANT_CONV1,     // conv1 + ReLU (pool1 shares it)
+    QUANT_SQUEEZE2, QUANT_FIRE2,
+    QUANT_SQUEEZE3, QUANT_FIRE3,
+    QUANT_SQUEEZE4, QUANT_FIRE4,  // pool4 shares fire4's scale
+    QUANT_SQUEEZE5, QUANT_FIRE5,
+    QUANT_SQUEEZE6, QUANT_FIRE6,
+    QUANT_SQUEEZE7, QUANT_FIRE7,
+    QUANT_SQUEEZE8, QUANT_FIRE8,  // pool8 shares fire8's scale
+    QUANT_SQUEEZE9, QUANT_FIRE9,
+    QUANT_CONV10,    // conv10 + ReLU (before GAP)
+    QUANT_NUM_TENSORS
+};
+
+// Tensor name, as the calibration collector and scale file know the layer
+// ("input", "conv1", "fire2/squeeze", "fire2", ..., "conv10")
+const char* quant_tensor_name(int tensor);
+
+// Set the activation ranges (largest value of each tensor, max |x| for the
+// input) and requantize the network for them. Call before inferences run.
+void squeezenet_int8_set_ranges(const float ranges[QUANT_NUM_TENSORS]);
+
+// Current ranges; false if none were set yet
+bool squeezenet_int8_ranges(float ranges[QUANT_NUM_TENSORS]);
+
+// Set the ranges from a scale file (calibration_write() format). False, with
+// nothing changed, if the file is unreadable or lacks one of the tensors.
+bool squeezenet_int8_load_ranges(const char* path);
+
+// Run a calibration session over N images (INPUT_C x INPUT_H x INPUT_W each)
+// and set the ranges from it (any earlier session's statistics are dropped)
+void squeezenet_int8_calibrate(int N, const float input_images[]);
+
+// The int8 network; its byte buffers are carved from a SqueezeNet arena
+// (squeezenet_inference() passes the context's)
+void squeezenet_int8(float arena[], const float input_image[], float output_logits[NUM_CLASSES]);
+
+// The network with each step at the policy's precision. Float maps live in
+// the arena at their planned offsets (as squeezenet_inference()'s CHW path),
+// int8 maps in per-thread byte buffers.
+void squeezenet_mixed(float arena[], const PrecisionPolicy& policy,
+                      const float input_image[], float output_logits[NUM_CLASSES]);
+
+#endif // SQUEEZENET_QUANT_H
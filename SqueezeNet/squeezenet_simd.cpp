@@ -0,0 +1,822 @@
+#include "squeezenet_simd.h"
+#include "squeezenet_gemm.h" // For SGEMM_MR
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side kernels only
+
+#include <algorithm> // For std::min, std::max
+#include <atomic>    // For std::atomic
+#include <cfloat>    // For FLT_MAX
+#include <cmath>     // For std::nearbyint
+#include <cstring>   // For memcpy
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#endif
+
+//--------------------------------------------------------------------------
+// Scalar Kernels (portable fallback)
+//--------------------------------------------------------------------------
+#define SCALAR_NR 16
+
+static void sgemm_tile_scalar(int kc, const float A[], const float B[], int ldb,
+                              float C[], int ldc, const float bias[],
+                              bool accumulate, bool apply_relu)
+{
+    float acc[SGEMM_MR][SCALAR_NR] = {};
+
+    for (int k = 0; k < kc; ++k) {
+        // Fully unrolled rows keep the whole tile in vector registers
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            float a = A[i];
+            for (int j = 0; j < SCALAR_NR; ++j) {
+                acc[i][j] += a * B[j];
+            }
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float init = bias ? bias[i] : 0.0f;
+        for (int j = 0; j < SCALAR_NR; ++j) {
+            float v = acc[i][j] + (accumulate ? C[i * ldc + j] : init);
+            C[i * ldc + j] = (apply_relu && v < 0.0f) ? 0.0f : v;
+        }
+    }
+}
+
+static void axpy_scalar(int n, float a, const float x[], float y[]) {
+    for (int i = 0; i < n; ++i) y[i] += a * x[i];
+}
+
+static void vmax_scalar(int n, const float a[], const float b[], float r[]) {
+    for (int i = 0; i < n; ++i) r[i] = (a[i] > b[i]) ? a[i] : b[i];
+}
+
+static void vadd_scalar(int n, const float a[], const float b[], float r[]) {
+    for (int i = 0; i < n; ++i) r[i] = a[i] + b[i];
+}
+
+static float vsum_scalar(int n, const float x[]) {
+    float sum = 0.0f;
+    for (int i = 0; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+static void hmax3s2_scalar(int n, int lanes, const float a[], float r[]) {
+    for (int i = 0; i < n; ++i) {
+        const float* p = a + 2 * i * lanes;
+        for (int l = 0; l < lanes; ++l) {
+            r[i * lanes + l] = std::max(std::max(p[l], p[lanes + l]), p[2 * lanes + l]);
+        }
+    }
+}
+
+static void conv_nchw8c_scalar(const float in[], int in_cstride, int in_rstride, int S,
+                               const float w[], int ICB, int lanes, int KH, int KW,
+                               int n, const float bias[], float out[], bool apply_relu)
+{
+    float acc[NCHWC_TILE][NCHWC_BLOCK];
+    for (int p = 0; p < n; ++p) {
+        for (int o = 0; o < NCHWC_BLOCK; ++o) acc[p][o] = bias[o];
+    }
+
+    for (int icb = 0; icb < ICB; ++icb) {
+        for (int kh = 0; kh < KH; ++kh) {
+            for (int kw = 0; kw < KW; ++kw) {
+                const float* ip = in + icb * in_cstride + kh * in_rstride + kw * NCHWC_BLOCK;
+                const float* wp = w + ((icb * KH + kh) * KW + kw) * NCHWC_BLOCK * NCHWC_BLOCK;
+                for (int i = 0; i < lanes; ++i) {
+                    for (int p = 0; p < n; ++p) {
+                        float a = ip[p * S * NCHWC_BLOCK + i];
+                        for (int o = 0; o < NCHWC_BLOCK; ++o) {
+                            acc[p][o] += a * wp[i * NCHWC_BLOCK + o];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int p = 0; p < n; ++p) {
+        for (int o = 0; o < NCHWC_BLOCK; ++o) {
+            float v = acc[p][o];
+            out[p * NCHWC_BLOCK + o] = (apply_relu && v < 0.0f) ? 0.0f : v;
+        }
+    }
+}
+
+// Requantize one int32 sum: scale, ReLU + saturate to [0, 255], round to
+// nearest even (the default rounding mode, like cvtps2dq in the SIMD kernels)
+static inline uint8_t requantize_u8(int32_t acc, float scale) {
+    float v = (float)acc * scale;
+    v = std::min(std::max(v, 0.0f), 255.0f);
+    return (uint8_t)std::nearbyint(v);
+}
+
+static void conv_u8s8_scalar(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                             const int8_t w[], int ICG, int KH, int KW, int n,
+                             const int32_t bias[], const float scale[],
+                             uint8_t out[], int out_pstride)
+{
+    int32_t acc[NCHWC_TILE][QUANT_OC_BLOCK];
+    for (int p = 0; p < n; ++p) {
+        for (int o = 0; o < QUANT_OC_BLOCK; ++o) acc[p][o] = bias[o];
+    }
+
+    for (int kh = 0; kh < KH; ++kh) {
+        for (int kw = 0; kw < KW; ++kw) {
+            const uint8_t* ip = in + kh * in_rstride + kw * in_pstride;
+            const int8_t* wp = w + (kh * KW + kw) * ICG * QUANT_OC_BLOCK * QUANT_IC_GROUP;
+            for (int g = 0; g < ICG; ++g) {
+                for (int p = 0; p < n; ++p) {
+                    const uint8_t* a = ip + p * S * in_pstride + g * QUANT_IC_GROUP;
+                    for (int o = 0; o < QUANT_OC_BLOCK; ++o) {
+                        const int8_t* wo = wp + (g * QUANT_OC_BLOCK + o) * QUANT_IC_GROUP;
+                        for (int i = 0; i < QUANT_IC_GROUP; ++i) acc[p][o] += a[i] * wo[i];
+                    }
+                }
+            }
+        }
+    }
+
+    for (int p = 0; p < n; ++p) {
+        for (int o = 0; o < QUANT_OC_BLOCK; ++o) {
+            out[p * out_pstride + o] = requantize_u8(acc[p][o], scale[o]);
+        }
+    }
+}
+
+static const SimdKernels scalar_kernels = {
+    SIMD_SCALAR, "scalar", SCALAR_NR, sgemm_tile_scalar,
+    axpy_scalar, vmax_scalar, vadd_scalar, vsum_scalar, hmax3s2_scalar,
+    conv_nchw8c_scalar, conv_u8s8_scalar
+};
+
+#ifdef SIMD_X86
+//--------------------------------------------------------------------------
+// AVX2 + FMA Kernels (8 floats per vector)
+//--------------------------------------------------------------------------
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#define AVX2_NR 16
+
+// 6x16 tile: 12 ymm accumulators + 2 B vectors + 1 broadcast
+AVX2_TARGET
+static void sgemm_tile_avx2(int kc, const float A[], const float B[], int ldb,
+                            float C[], int ldc, const float bias[],
+                            bool accumulate, bool apply_relu)
+{
+    __m256 c[SGEMM_MR][2];
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        c[i][0] = _mm256_setzero_ps();
+        c[i][1] = _mm256_setzero_ps();
+    }
+
+    for (int k = 0; k < kc; ++k) {
+        __m256 b0 = _mm256_loadu_ps(B);
+        __m256 b1 = _mm256_loadu_ps(B + 8);
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            __m256 a = _mm256_broadcast_ss(A + i);
+            c[i][0] = _mm256_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm256_fmadd_ps(a, b1, c[i][1]);
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float* row = C + i * ldc;
+        __m256 init0, init1;
+        if (accumulate) {
+            init0 = _mm256_loadu_ps(row);
+            init1 = _mm256_loadu_ps(row + 8);
+        } else {
+            init0 = init1 = _mm256_set1_ps(bias ? bias[i] : 0.0f);
+        }
+        __m256 v0 = _mm256_add_ps(c[i][0], init0);
+        __m256 v1 = _mm256_add_ps(c[i][1], init1);
+        if (apply_relu) {
+            v0 = _mm256_max_ps(v0, zero);
+            v1 = _mm256_max_ps(v1, zero);
+        }
+        _mm256_storeu_ps(row, v0);
+        _mm256_storeu_ps(row + 8, v1);
+    }
+}
+
+AVX2_TARGET
+static void axpy_avx2(int n, float a, const float x[], float y[]) {
+    __m256 va = _mm256_set1_ps(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; ++i) y[i] += a * x[i];
+}
+
+AVX2_TARGET
+static void vmax_avx2(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i, _mm256_max_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < n; ++i) r[i] = (a[i] > b[i]) ? a[i] : b[i];
+}
+
+AVX2_TARGET
+static void vadd_avx2(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < n; ++i) r[i] = a[i] + b[i];
+}
+
+AVX2_TARGET
+static float vsum_avx2(int n, const float x[]) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(x + i));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(x + i + 8));
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(x + i));
+    }
+    __m256 acc = _mm256_add_ps(acc0, acc1);
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    float sum = _mm_cvtss_f32(s);
+    for (; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+// Channel-blocked pixels are whole vectors. Plain rows are deinterleaved:
+// the even and odd columns of 16 inputs (and the even columns one pixel to
+// the right, the third tap) come out of in-lane shuffles in the same order,
+// so a single cross-lane permute fixes up the max.
+AVX2_TARGET
+static void hmax3s2_avx2(int n, int lanes, const float a[], float r[]) {
+    if (lanes % 8 == 0) {
+        for (int i = 0; i < n; ++i) {
+            const float* p = a + 2 * i * lanes;
+            for (int l = 0; l < lanes; l += 8) {
+                __m256 m = _mm256_max_ps(_mm256_loadu_ps(p + l), _mm256_loadu_ps(p + lanes + l));
+                _mm256_storeu_ps(r + i * lanes + l, _mm256_max_ps(m, _mm256_loadu_ps(p + 2 * lanes + l)));
+            }
+        }
+        return;
+    }
+    if (lanes != 1) {
+        hmax3s2_scalar(n, lanes, a, r);
+        return;
+    }
+
+    int i = 0;
+    for (; i + 8 < n; i += 8) { // Reads a[2i .. 2i+17]
+        const float* p = a + 2 * i;
+        __m256 lo = _mm256_loadu_ps(p), hi = _mm256_loadu_ps(p + 8);
+        __m256 lo2 = _mm256_loadu_ps(p + 2), hi2 = _mm256_loadu_ps(p + 10);
+        __m256 even = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 odd = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 next = _mm256_shuffle_ps(lo2, hi2, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 m = _mm256_max_ps(_mm256_max_ps(even, odd), next);
+        m = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(m), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(r + i, m);
+    }
+    hmax3s2_scalar(n - i, 1, a + 2 * i, r + i);
+}
+
+// T output pixels x 8 channels: T ymm accumulators, one weight vector per
+// input lane, broadcast input values
+template<int T>
+AVX2_TARGET
+static void conv_nchw8c_avx2_tile(const float in[], int in_cstride, int in_rstride, int S,
+                                  const float w[], int ICB, int lanes, int KH, int KW,
+                                  const float bias[], float out[], bool apply_relu)
+{
+    const int ps = S * NCHWC_BLOCK;
+    __m256 acc[T];
+    __m256 b = _mm256_loadu_ps(bias);
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) acc[p] = b;
+
+    for (int icb = 0; icb < ICB; ++icb) {
+        for (int kh = 0; kh < KH; ++kh) {
+            for (int kw = 0; kw < KW; ++kw) {
+                const float* ip = in + icb * in_cstride + kh * in_rstride + kw * NCHWC_BLOCK;
+                const float* wp = w + ((icb * KH + kh) * KW + kw) * NCHWC_BLOCK * NCHWC_BLOCK;
+                for (int i = 0; i < lanes; ++i) {
+                    __m256 wv = _mm256_loadu_ps(wp + i * NCHWC_BLOCK);
+#pragma GCC unroll 16
+                    for (int p = 0; p < T; ++p) {
+                        acc[p] = _mm256_fmadd_ps(_mm256_broadcast_ss(ip + p * ps + i), wv, acc[p]);
+                    }
+                }
+            }
+        }
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) {
+        _mm256_storeu_ps(out + p * NCHWC_BLOCK, apply_relu ? _mm256_max_ps(acc[p], zero) : acc[p]);
+    }
+}
+
+AVX2_TARGET
+static void conv_nchw8c_avx2(const float in[], int in_cstride, int in_rstride, int S,
+                             const float w[], int ICB, int lanes, int KH, int KW,
+                             int n, const float bias[], float out[], bool apply_relu)
+{
+#define NCHW8C_TILE_CASE(T) \
+    case T: conv_nchw8c_avx2_tile<T>(in, in_cstride, in_rstride, S, w, ICB, lanes, KH, KW, \
+                                     bias, out, apply_relu); break;
+    switch (n) {
+        NCHW8C_TILE_CASE(1)  NCHW8C_TILE_CASE(2)  NCHW8C_TILE_CASE(3)
+        NCHW8C_TILE_CASE(4)  NCHW8C_TILE_CASE(5)  NCHW8C_TILE_CASE(6)
+        NCHW8C_TILE_CASE(7)  NCHW8C_TILE_CASE(8)  NCHW8C_TILE_CASE(9)
+        NCHW8C_TILE_CASE(10) NCHW8C_TILE_CASE(11) NCHW8C_TILE_CASE(12)
+        default: break;
+    }
+#undef NCHW8C_TILE_CASE
+}
+
+// T output pixels x 16 channels (two ymm of int32 each). vpmaddubsw adds
+// two u8 x s8 products into an int16 that saturates beyond 32767, which
+// 255 * 127 * 2 can reach, so the broadcast input dword is split into its
+// even and odd bytes first: each int16 then holds one exact product, and
+// vpmaddwd against ones widens and pairs them into the int32 sums.
+template<int T>
+AVX2_TARGET
+static void conv_u8s8_avx2_tile(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                                const int8_t w[], int ICG, int KH, int KW,
+                                const int32_t bias[], const float scale[],
+                                uint8_t out[], int out_pstride)
+{
+    const int ps = S * in_pstride;
+    const __m256i even = _mm256_set1_epi32(0x00FF00FF);
+    const __m256i odd = _mm256_set1_epi32((int)0xFF00FF00);
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i acc[T][2];
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) {
+        acc[p][0] = _mm256_loadu_si256((const __m256i*)bias);
+        acc[p][1] = _mm256_loadu_si256((const __m256i*)(bias + 8));
+    }
+
+    for (int kh = 0; kh < KH; ++kh) {
+        for (int kw = 0; kw < KW; ++kw) {
+            const uint8_t* ip = in + kh * in_rstride + kw * in_pstride;
+            const int8_t* wp = w + (kh * KW + kw) * ICG * QUANT_OC_BLOCK * QUANT_IC_GROUP;
+            for (int g = 0; g < ICG; ++g) {
+                __m256i w0 = _mm256_loadu_si256((const __m256i*)(wp + g * QUANT_OC_BLOCK * QUANT_IC_GROUP));
+                __m256i w1 = _mm256_loadu_si256((const __m256i*)(wp + g * QUANT_OC_BLOCK * QUANT_IC_GROUP + 32));
+#pragma GCC unroll 16
+                for (int p = 0; p < T; ++p) {
+                    int32_t dword;
+                    memcpy(&dword, ip + p * ps + g * QUANT_IC_GROUP, sizeof(dword));
+                    __m256i a = _mm256_set1_epi32(dword);
+                    __m256i ae = _mm256_and_si256(a, even);
+                    __m256i ao = _mm256_and_si256(a, odd);
+                    acc[p][0] = _mm256_add_epi32(acc[p][0], _mm256_add_epi32(
+                        _mm256_madd_epi16(_mm256_maddubs_epi16(ae, w0), ones),
+                        _mm256_madd_epi16(_mm256_maddubs_epi16(ao, w0), ones)));
+                    acc[p][1] = _mm256_add_epi32(acc[p][1], _mm256_add_epi32(
+                        _mm256_madd_epi16(_mm256_maddubs_epi16(ae, w1), ones),
+                        _mm256_madd_epi16(_mm256_maddubs_epi16(ao, w1), ones)));
+                }
+            }
+        }
+    }
+
+    const __m256 s0 = _mm256_loadu_ps(scale);
+    const __m256 s1 = _mm256_loadu_ps(scale + 8);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 top = _mm256_set1_ps(255.0f);
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) {
+        __m256 v0 = _mm256_mul_ps(_mm256_cvtepi32_ps(acc[p][0]), s0);
+        __m256 v1 = _mm256_mul_ps(_mm256_cvtepi32_ps(acc[p][1]), s1);
+        __m256i q0 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(v0, zero), top));
+        __m256i q1 = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(v1, zero), top));
+        // packs works within 128-bit lanes: restore channel order before
+        // narrowing to bytes
+        __m256i q16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(q0, q1), 0xD8);
+        __m128i q8 = _mm_packus_epi16(_mm256_castsi256_si128(q16), _mm256_extracti128_si256(q16, 1));
+        _mm_storeu_si128((__m128i*)(out + p * out_pstride), q8);
+    }
+}
+
+// Register pressure allows 4 pixels (8 accumulators) per tile
+#define QUANT_AVX2_TILE 4
+
+AVX2_TARGET
+static void conv_u8s8_avx2(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                           const int8_t w[], int ICG, int KH, int KW, int n,
+                           const int32_t bias[], const float scale[],
+                           uint8_t out[], int out_pstride)
+{
+    for (int p0 = 0; p0 < n; p0 += QUANT_AVX2_TILE) {
+        const uint8_t* ip = in + p0 * S * in_pstride;
+        uint8_t* op = out + p0 * out_pstride;
+        switch (std::min(QUANT_AVX2_TILE, n - p0)) {
+            case 1: conv_u8s8_avx2_tile<1>(ip, in_pstride, in_rstride, S, w, ICG, KH, KW, bias, scale, op, out_pstride); break;
+            case 2: conv_u8s8_avx2_tile<2>(ip, in_pstride, in_rstride, S, w, ICG, KH, KW, bias, scale, op, out_pstride); break;
+            case 3: conv_u8s8_avx2_tile<3>(ip, in_pstride, in_rstride, S, w, ICG, KH, KW, bias, scale, op, out_pstride); break;
+            default: conv_u8s8_avx2_tile<4>(ip, in_pstride, in_rstride, S, w, ICG, KH, KW, bias, scale, op, out_pstride); break;
+        }
+    }
+}
+
+static const SimdKernels avx2_kernels = {
+    SIMD_AVX2, "avx2", AVX2_NR, sgemm_tile_avx2,
+    axpy_avx2, vmax_avx2, vadd_avx2, vsum_avx2, hmax3s2_avx2,
+    conv_nchw8c_avx2, conv_u8s8_avx2
+};
+
+//--------------------------------------------------------------------------
+// AVX-512F Kernels (16 floats per vector)
+//--------------------------------------------------------------------------
+#define AVX512_TARGET __attribute__((target("avx512f")))
+
+// GCC 12's AVX-512 intrinsics seed some results with a self-initialized
+// "undefined" vector, which trips -Wuninitialized when they are inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#define AVX512_NR 32
+
+// 6x32 tile: 12 zmm accumulators, enough independent FMAs to cover latency
+AVX512_TARGET
+static void sgemm_tile_avx512(int kc, const float A[], const float B[], int ldb,
+                              float C[], int ldc, const float bias[],
+                              bool accumulate, bool apply_relu)
+{
+    __m512 c[SGEMM_MR][2];
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        c[i][0] = _mm512_setzero_ps();
+        c[i][1] = _mm512_setzero_ps();
+    }
+
+    for (int k = 0; k < kc; ++k) {
+        __m512 b0 = _mm512_loadu_ps(B);
+        __m512 b1 = _mm512_loadu_ps(B + 16);
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            __m512 a = _mm512_set1_ps(A[i]);
+            c[i][0] = _mm512_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm512_fmadd_ps(a, b1, c[i][1]);
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    const __m512 zero = _mm512_setzero_ps();
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float* row = C + i * ldc;
+        __m512 init0, init1;
+        if (accumulate) {
+            init0 = _mm512_loadu_ps(row);
+            init1 = _mm512_loadu_ps(row + 16);
+        } else {
+            init0 = init1 = _mm512_set1_ps(bias ? bias[i] : 0.0f);
+        }
+        __m512 v0 = _mm512_add_ps(c[i][0], init0);
+        __m512 v1 = _mm512_add_ps(c[i][1], init1);
+        if (apply_relu) {
+            v0 = _mm512_max_ps(v0, zero);
+            v1 = _mm512_max_ps(v1, zero);
+        }
+        _mm512_storeu_ps(row, v0);
+        _mm512_storeu_ps(row + 16, v1);
+    }
+}
+
+// Tails use masked loads/stores instead of a scalar loop
+AVX512_TARGET
+static void axpy_avx512(int n, float a, const float x[], float y[]) {
+    __m512 va = _mm512_set1_ps(a);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        __m512 vy = _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(m, x + i), _mm512_maskz_loadu_ps(m, y + i));
+        _mm512_mask_storeu_ps(y + i, m, vy);
+    }
+}
+
+AVX512_TARGET
+static void vmax_avx512(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(r + i, _mm512_max_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(r + i, m, _mm512_max_ps(_mm512_maskz_loadu_ps(m, a + i),
+                                                      _mm512_maskz_loadu_ps(m, b + i)));
+    }
+}
+
+AVX512_TARGET
+static void vadd_avx512(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(r + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(r + i, m, _mm512_add_ps(_mm512_maskz_loadu_ps(m, a + i),
+                                                      _mm512_maskz_loadu_ps(m, b + i)));
+    }
+}
+
+AVX512_TARGET
+static float vsum_avx512(int n, const float x[]) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(x + i));
+        acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(x + i + 16));
+    }
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(x + i));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        acc1 = _mm512_add_ps(acc1, _mm512_maskz_loadu_ps(m, x + i));
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+// NCHW8c blocks are one ymm wide and pooled rows are short (at most a few
+// dozen vectors), so AVX-512 machines (which all have AVX2 + FMA) use the
+// AVX2 NCHW8c and row-max kernels. Without VNNI the int8 convolution stays
+// on the AVX2 kernel as well.
+static const SimdKernels avx512_kernels = {
+    SIMD_AVX512, "avx512", AVX512_NR, sgemm_tile_avx512,
+    axpy_avx512, vmax_avx512, vadd_avx512, vsum_avx512, hmax3s2_avx2,
+    conv_nchw8c_avx2, conv_u8s8_avx2
+};
+
+//--------------------------------------------------------------------------
+// AVX-512 VNNI Kernels (vpdpbusd: 64 u8 x s8 products per instruction)
+//--------------------------------------------------------------------------
+#define AVX512_VNNI_TARGET __attribute__((target("avx512f,avx512bw,avx512vnni")))
+
+// T output pixels x 16 channels: one zmm of int32 per pixel, the 16 x 4
+// weight bytes of an input group in one zmm, and each pixel's 4 input bytes
+// broadcast. vpdpbusd sums the four products in int32, so nothing saturates.
+template<int T>
+AVX512_VNNI_TARGET
+static void conv_u8s8_vnni_tile(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                                const int8_t w[], int ICG, int KH, int KW,
+                                const int32_t bias[], const float scale[],
+                                uint8_t out[], int out_pstride)
+{
+    const int ps = S * in_pstride;
+    __m512i acc[T];
+    __m512i b = _mm512_loadu_si512(bias);
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) acc[p] = b;
+
+    for (int kh = 0; kh < KH; ++kh) {
+        for (int kw = 0; kw < KW; ++kw) {
+            const uint8_t* ip = in + kh * in_rstride + kw * in_pstride;
+            const int8_t* wp = w + (kh * KW + kw) * ICG * QUANT_OC_BLOCK * QUANT_IC_GROUP;
+            for (int g = 0; g < ICG; ++g) {
+                __m512i wv = _mm512_loadu_si512(wp + g * QUANT_OC_BLOCK * QUANT_IC_GROUP);
+#pragma GCC unroll 16
+                for (int p = 0; p < T; ++p) {
+                    int32_t dword;
+                    memcpy(&dword, ip + p * ps + g * QUANT_IC_GROUP, sizeof(dword));
+                    acc[p] = _mm512_dpbusd_epi32(acc[p], _mm512_set1_epi32(dword), wv);
+                }
+            }
+        }
+    }
+
+    const __m512 sv = _mm512_loadu_ps(scale);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 top = _mm512_set1_ps(255.0f);
+#pragma GCC unroll 16
+    for (int p = 0; p < T; ++p) {
+        __m512 v = _mm512_mul_ps(_mm512_cvtepi32_ps(acc[p]), sv);
+        __m512i q = _mm512_cvtps_epi32(_mm512_min_ps(_mm512_max_ps(v, zero), top));
+        _mm_storeu_si128((__m128i*)(out + p * out_pstride), _mm512_cvtepi32_epi8(q));
+    }
+}
+
+AVX512_VNNI_TARGET
+static void conv_u8s8_vnni(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                           const int8_t w[], int ICG, int KH, int KW, int n,
+                           const int32_t bias[], const float scale[],
+                           uint8_t out[], int out_pstride)
+{
+#define U8S8_TILE_CASE(T) \
+    case T: conv_u8s8_vnni_tile<T>(in, in_pstride, in_rstride, S, w, ICG, KH, KW, \
+                                   bias, scale, out, out_pstride); break;
+    switch (n) {
+        U8S8_TILE_CASE(1)  U8S8_TILE_CASE(2)  U8S8_TILE_CASE(3)
+        U8S8_TILE_CASE(4)  U8S8_TILE_CASE(5)  U8S8_TILE_CASE(6)
+        U8S8_TILE_CASE(7)  U8S8_TILE_CASE(8)  U8S8_TILE_CASE(9)
+        U8S8_TILE_CASE(10) U8S8_TILE_CASE(11) U8S8_TILE_CASE(12)
+        default: break;
+    }
+#undef U8S8_TILE_CASE
+}
+
+// Same as the AVX-512 table apart from the int8 convolution
+static const SimdKernels avx512_vnni_kernels = {
+    SIMD_AVX512_VNNI, "avx512-vnni", AVX512_NR, sgemm_tile_avx512,
+    axpy_avx512, vmax_avx512, vadd_avx512, vsum_avx512, hmax3s2_avx2,
+    conv_nchw8c_avx2, conv_u8s8_vnni
+};
+#pragma GCC diagnostic pop
+#endif // SIMD_X86
+
+//--------------------------------------------------------------------------
+// Dispatch
+//--------------------------------------------------------------------------
+SimdLevel simd_detect() {
+#ifdef SIMD_X86
+    // __builtin_cpu_supports also checks that the OS saves the wider registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vnni")) {
+        return SIMD_AVX512_VNNI;
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SIMD_AVX2;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+static const SimdKernels* kernels_for(SimdLevel level) {
+#ifdef SIMD_X86
+    if (level == SIMD_AVX512_VNNI) return &avx512_vnni_kernels;
+    if (level == SIMD_AVX512) return &avx512_kernels;
+    if (level == SIMD_AVX2) return &avx2_kernels;
+#endif
+    (void)level;
+    return &scalar_kernels;
+}
+
+// Atomic so inference threads can resolve the default on their first call
+// concurrently (they all store the same table)
+static std::atomic<const SimdKernels*> active_kernels(nullptr);
+
+const SimdKernels& simd_kernels() {
+    const SimdKernels* kernels = active_kernels.load(std::memory_order_acquire);
+    if (!kernels) {
+        kernels = kernels_for(simd_detect());
+        active_kernels.store(kernels, std::memory_order_release);
+    }
+    return *kernels;
+}
+
+bool set_simd_level(SimdLevel level) {
+    if (level > simd_detect()) {
+        return false;
+    }
+    active_kernels.store(kernels_for(level), std::memory_order_release);
+    return true;
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Max Pooling
+//--------------------------------------------------------------------------
+void max_pool_row_3s2(const float row[], int InW, int lanes, float out[], int OutW) {
+    const int full = std::max(0, std::min(OutW, (InW - 1) / 2)); // Windows with all 3 taps
+    simd_kernels().hmax3s2(full, lanes, row, out);
+    for (int ow = full; ow < OutW; ++ow) {
+        int taps = std::min(3, InW - 2 * ow);
+        for (int l = 0; l < lanes; ++l) {
+            float max_val = -FLT_MAX;
+            for (int kw = 0; kw < taps; ++kw) {
+                max_val = std::max(max_val, row[(2 * ow + kw) * lanes + l]);
+            }
+            out[ow * lanes + l] = max_val;
+        }
+    }
+}
+
+// 3x3/stride-2 (SqueezeNet pool1/4/8): separable. Each input row's horizontal
+// maxima are computed once, and the last row of one window is carried over
+// as the first row of the next, so output row oh only adds rows 2oh+1, 2oh+2.
+static void max_pooling_3x3s2_simd(
+    const SimdKernels& k, const float plane[], int InH, int InW,
+    float out[], int OutH, int OutW)
+{
+    float h_carry[SIMD_MAX_ROW_WIDTH];
+    float h_row[SIMD_MAX_ROW_WIDTH];
+
+    for (int oh = 0; oh < OutH; ++oh) {
+        int ih0 = oh * 2;
+        int rows = std::min(3, InH - ih0);
+        float* out_row = out + oh * OutW;
+        if (rows <= 0) {
+            std::fill(out_row, out_row + OutW, -FLT_MAX);
+            continue;
+        }
+        if (oh == 0) {
+            max_pool_row_3s2(plane, InW, 1, h_carry, OutW);
+        }
+        if (rows == 1) {
+            memcpy(out_row, h_carry, OutW * sizeof(float));
+            continue;
+        }
+        max_pool_row_3s2(plane + (ih0 + 1) * InW, InW, 1, h_row, OutW);
+        k.vmax(OutW, h_carry, h_row, out_row);
+        if (rows == 3) {
+            max_pool_row_3s2(plane + (ih0 + 2) * InW, InW, 1, h_carry, OutW);
+            k.vmax(OutW, out_row, h_carry, out_row);
+        }
+    }
+}
+
+// Other windows, per output row: the KH input rows are reduced with a
+// vertical vector max over the full width, then each window only scans KW
+// adjacent values.
+void max_pooling_simd(
+    const float input[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW)
+{
+    const SimdKernels& k = simd_kernels();
+    // Channel planes are independent work items
+    const double plane_cost = (double)OutH * (KH * InW + OutW * KW);
+    if (KH == 3 && KW == 3 && StrideH == 2 && StrideW == 2) {
+        parallel_for(InC, plane_cost, [&](int c0, int c1) {
+            for (int c = c0; c < c1; ++c) {
+                max_pooling_3x3s2_simd(k, input + c * InH * InW, InH, InW,
+                                       output + c * OutH * OutW, OutH, OutW);
+            }
+        });
+        return;
+    }
+
+    parallel_for(InC, plane_cost, [&](int c0, int c1) {
+        float row_max[SIMD_MAX_ROW_WIDTH];
+
+        for (int c = c0; c < c1; ++c) {
+            const float* plane = input + c * InH * InW;
+            float* out = output + c * OutH * OutW;
+            for (int oh = 0; oh < OutH; ++oh) {
+                int ih0 = oh * StrideH;
+                int rows = std::min(KH, InH - ih0);
+                if (rows <= 0) {
+                    std::fill(out + oh * OutW, out + (oh + 1) * OutW, -FLT_MAX);
+                    continue;
+                }
+                memcpy(row_max, plane + ih0 * InW, InW * sizeof(float));
+                for (int r = 1; r < rows; ++r) {
+                    k.vmax(InW, row_max, plane + (ih0 + r) * InW, row_max);
+                }
+                for (int ow = 0; ow < OutW; ++ow) {
+                    int iw0 = ow * StrideW;
+                    int taps = std::min(KW, InW - iw0);
+                    float max_val = -FLT_MAX;
+                    for (int kw = 0; kw < taps; ++kw) {
+                        max_val = std::max(max_val, row_max[iw0 + kw]);
+                    }
+                    out[oh * OutW + ow] = max_val;
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Global Average Pooling
+//--------------------------------------------------------------------------
+void global_average_pooling_simd(
+    const float input[], float output[], int InH, int InW, int InC)
+{
+    const SimdKernels& k = simd_kernels();
+    const int HW = InH * InW;
+    for (int c = 0; c < InC; ++c) {
+        output[c] = k.vsum(HW, input + c * HW) / (float)HW;
+    }
+}
+
+#endif // __SYNTHESIS__
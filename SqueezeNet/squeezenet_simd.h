@@ -0,0 +1,105 @@
+#ifndef SQUEEZENET_SIMD_H
+#define SQUEEZENET_SIMD_H
+
+// ==========================================================================
+// === SIMD Kernels with Runtime CPU Dispatch (Host Builds Only) ===========
+// ==========================================================================
+// Every x86 kernel is compiled with a per-function target attribute, so one
+// binary built without -mavx2/-mavx512f carries all variants. The best level
+// the CPU (and OS) supports is picked via cpuid the first time the table is
+// requested; the plain C++ loops are the portable fallback (SIMD_SCALAR).
+// ==========================================================================
+
+#include <cstdint> // For the int8 kernel operands
+
+enum SimdLevel {
+    SIMD_SCALAR,  // Portable C++ (also the non-x86 path)
+    SIMD_AVX2,    // AVX2 + FMA (Haswell and newer)
+    SIMD_AVX512,  // AVX-512F (Skylake-SP, Ice Lake and newer)
+    SIMD_AVX512_VNNI // AVX-512F + VNNI (Cascade Lake, Ice Lake and newer)
+};
+
+#define SIMD_MAX_NR 32          // Widest SGEMM micro-kernel tile (AVX-512)
+#define SIMD_MAX_ROW_WIDTH 1024 // Longest feature-map row the row-based kernels buffer
+#define NCHWC_BLOCK 8           // Channels per block in the NCHW8c layout (one ymm)
+#define NCHWC_TILE 12           // Output pixels per NCHW8c register tile
+#define QUANT_OC_BLOCK 16       // Output channels per int8 kernel call (16 int32 lanes, one zmm)
+#define QUANT_IC_GROUP 4        // Input channels per int8 multiply-add group (one dword)
+
+// Kernel table for one instruction set
+struct SimdKernels {
+    SimdLevel level;
+    const char* name;
+
+    // SGEMM micro-kernel: full SGEMM_MR x sgemm_nr tile of C (see _gemm.cpp for
+    // the bias/accumulate/ReLU epilogue contract). B rows are ldb floats apart.
+    int sgemm_nr;
+    void (*sgemm_tile)(int kc, const float A[], const float B[], int ldb,
+                       float C[], int ldc, const float bias[],
+                       bool accumulate, bool apply_relu);
+
+    // Streaming primitives over n contiguous floats
+    void (*axpy)(int n, float a, const float x[], float y[]);            // y += a * x
+    void (*vmax)(int n, const float a[], const float b[], float r[]);    // r = max(a, b)
+    void (*vadd)(int n, const float a[], const float b[], float r[]);    // r = a + b
+    float (*vsum)(int n, const float x[]);                               // sum(x)
+
+    // Horizontal pass of a 3x3/stride-2 max pool over a row of pixels that are
+    // `lanes` floats wide (1 for CHW rows, NCHWC_BLOCK for NCHW8c rows):
+    // r[i*lanes + l] = max(a[(2i+t)*lanes + l], t = 0..2) for i < n, so a must
+    // hold 2n+1 pixels
+    void (*hmax3s2)(int n, int lanes, const float a[], float r[]);
+
+    // NCHW8c direct convolution of n <= NCHWC_TILE output pixels along one row
+    // for one 8-channel output block. `in` points at the top-left input tap of
+    // the first pixel (padding already materialized around the map); input
+    // channel blocks are in_cstride floats apart, rows in_rstride, and output
+    // pixels sit S input pixels apart. w is the OIhw8i8o slice of this output
+    // block ([ICB][KH][KW][8i][8o]); only the first `lanes` input lanes of each
+    // block are read. out receives n pixels x 8 channels, contiguous.
+    void (*conv_nchw8c)(const float in[], int in_cstride, int in_rstride, int S,
+                        const float w[], int ICB, int lanes, int KH, int KW,
+                        int n, const float bias[], float out[], bool apply_relu);
+
+    // Int8 direct convolution of n <= NCHWC_TILE output pixels along one row
+    // for one block of QUANT_OC_BLOCK output channels (squeezenet_quant.h).
+    // Activations are unsigned bytes with the channels of a pixel innermost,
+    // zero-padded to whole QUANT_IC_GROUPs: `in` points at the top-left input
+    // tap of the first pixel, pixels are in_pstride bytes apart, rows
+    // in_rstride, and output pixels sit S input pixels apart. w is this
+    // block's signed weights [KH][KW][ICG][16 o][4 i]. Products are summed in
+    // int32, then requantized with ReLU:
+    //   out[o] = clamp(round_even((float)(acc[o] + bias[o]) * scale[o]), 0, 255)
+    // The float math is the same at every level, so all levels agree bit for
+    // bit. Output pixels get 16 bytes each, out_pstride bytes apart.
+    void (*conv_u8s8)(const uint8_t in[], int in_pstride, int in_rstride, int S,
+                      const int8_t w[], int ICG, int KH, int KW, int n,
+                      const int32_t bias[], const float scale[],
+                      uint8_t out[], int out_pstride);
+};
+
+// Best level supported by this CPU
+SimdLevel simd_detect();
+
+// Active kernel table (selected on first use)
+const SimdKernels& simd_kernels();
+
+// Force a level (e.g. to compare against the scalar fallback).
+// Returns false and keeps the current table if the CPU does not support it.
+bool set_simd_level(SimdLevel level);
+
+// --- Vectorized Layer Kernels (same contracts as the squeezenet.h versions) ---
+void max_pooling_simd(
+    const float input[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW);
+
+// Horizontal 3-wide/stride-2 maxima of one row of InW pixels (`lanes` floats
+// each) for OutW outputs; a window clipped at the right edge only takes the
+// pixels that exist
+void max_pool_row_3s2(const float row[], int InW, int lanes, float out[], int OutW);
+
+void global_average_pooling_simd(
+    const float input[], float output[], int InH, int InW, int InC);
+
+#endif // SQUEEZENET_SIMD_H
@@ -1,12 +1,71 @@
 #include <iostream>
+#include <cstdio>  // For the sweep table
 #include <vector> // Can use vectors for host-side manipulation/verification
 #include <cmath>
 #include <algorithm> // For std::max_element
 #include <iterator>  // For std::distance
 
 #include "squeezenet.h"      // Includes params, weights, and function prototypes
+#include "squeezenet_arena.h" // Activation arena plan (for the memory report)
+#include "squeezenet_quant.h" // INT8 precision mode
+#include "squeezenet_precision.h" // Per-layer precision policies
+#include "squeezenet_batch.h" // Batched inference
+#include "squeezenet_fixed_point.h" // ap_fixed network
+#include "squeezenet_calibration.h" // Activation ranges (fixed-point check)
+#include "squeezenet_weight_store.h" // Pre-packed weight cache
 #include "Test/input_image.h"     // Includes the sample input image data
 
+// Largest logit error a reduced-precision path may show against fp32, as a
+// fraction of the largest |fp32 logit|
+#define TOLERANCE_INT8 0.05f
+#define TOLERANCE_FIXED 0.1f // ap_fixed<16,6> (steps of 2^-10)
+
+//--------------------------------------------------------------------------
+// Synthetic Weights
+//--------------------------------------------------------------------------
+// The shipped squeezenet_weights.cpp holds all-zero placeholders, under
+// which every path returns all-zero logits and no check below can fail. The
+// testbench then loads seeded weights instead: uniform in +-sqrt(6 / fan-in)
+// (He scaling, so activations keep their size through the ReLUs) with biases
+// in +-0.01, from a fixed xorshift sequence, so every run sees the same ones.
+static unsigned synthetic_state = 1234;
+
+static float synthetic_uniform(float limit) {
+    synthetic_state ^= synthetic_state << 13;
+    synthetic_state ^= synthetic_state >> 17;
+    synthetic_state ^= synthetic_state << 5;
+    return limit * ((synthetic_state >> 8) * (2.0f / 16777216.0f) - 1.0f);
+}
+
+static void synthetic_layer(float weights[], float biases[], int OutC, int fan_in) {
+    const float limit = std::sqrt(6.0f / fan_in);
+    for (int i = 0; i < OutC * fan_in; ++i) weights[i] = synthetic_uniform(limit);
+    for (int i = 0; i < OutC; ++i) biases[i] = synthetic_uniform(0.01f);
+}
+
+static void load_synthetic_weights() {
+    synthetic_layer(conv1_weights, conv1_biases, CONV1_C_OUT, INPUT_C * CONV1_KH * CONV1_KW);
+#define SYNTHETIC_FIRE(n) \
+    synthetic_layer(fire##n##_squeeze1x1_weights, fire##n##_squeeze1x1_biases, FIRE##n##_S1x1, FIRE##n##_C_IN); \
+    synthetic_layer(fire##n##_expand1x1_weights, fire##n##_expand1x1_biases, FIRE##n##_E1x1, FIRE##n##_S1x1); \
+    synthetic_layer(fire##n##_expand3x3_weights, fire##n##_expand3x3_biases, FIRE##n##_E3x3, FIRE##n##_S1x1 * 9)
+    SYNTHETIC_FIRE(2); SYNTHETIC_FIRE(3); SYNTHETIC_FIRE(4); SYNTHETIC_FIRE(5);
+    SYNTHETIC_FIRE(6); SYNTHETIC_FIRE(7); SYNTHETIC_FIRE(8); SYNTHETIC_FIRE(9);
+#undef SYNTHETIC_FIRE
+    synthetic_layer(conv10_weights, conv10_biases, CONV10_C_OUT, CONV10_C_IN * CONV10_KH * CONV10_KW);
+}
+
+// One failed check when a path's class differs from fp32's or its largest
+// logit error exceeds `limit`
+static int check_path(const char* path, bool class_matches, float error, float limit) {
+    if (class_matches && error <= limit) {
+        return 0;
+    }
+    std::cout << "ERROR: " << path << ": " << (class_matches ? "" : "class differs from fp32, ")
+              << "max logit error " << error << " (limit " << limit << ")" << std::endl;
+    return 1;
+}
+
 int main() {
     std::cout << "--- SqueezeNet HLS Testbench ---" << std::endl;
 
@@ -19,6 +78,16 @@ int main() {
     std::cout << "Input image dimensions: " << INPUT_H << "x" << INPUT_W << "x" << INPUT_C << std::endl;
     std::cout << "Network output classes: " << NUM_CLASSES << std::endl;
 
+    bool placeholder = std::all_of(conv1_weights, conv1_weights + CONV1_C_OUT * INPUT_C * CONV1_KH * CONV1_KW,
+                                   [](float w) { return w == 0.0f; }) &&
+                       std::all_of(conv10_weights, conv10_weights + CONV10_C_OUT * CONV10_C_IN,
+                                   [](float w) { return w == 0.0f; });
+    if (placeholder) {
+        std::cout << "Placeholder (all-zero) weights: running on seeded synthetic weights" << std::endl;
+        load_synthetic_weights();
+    }
+    int failures = 0; // Checks failed below
+
     // --- Execute the SqueezeNet Model ---
     std::cout << "Running SqueezeNet inference..." << std::endl;
     SqueezeNet(input_image_data, output_logits);
@@ -37,6 +106,144 @@ int main() {
     std::cout << "\nPredicted Class (Max Logit Index): " << predicted_class << std::endl;
     std::cout << "Logit value: " << *max_logit_ptr << std::endl;
 
+    // Tolerances below are relative to the largest |fp32 logit|
+    float logit_scale = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        logit_scale = std::max(logit_scale, std::fabs(output_logits[i]));
+    }
+
+    // --- Activation Memory Report ---
+    // Peak footprint of the planned arena vs. one static buffer per tensor
+    std::cout << "\nActivation arena: " << squeezenet_arena_plan.size * sizeof(float) / 1024 << " KB"
+              << " (live peak " << squeezenet_arena_plan.live_peak * sizeof(float) / 1024 << " KB,"
+              << " dedicated buffers " << squeezenet_arena_plan.dedicated * sizeof(float) / 1024 << " KB)"
+              << std::endl;
+
+    // --- Batched Path ---
+    // Two copies of the sample image through SqueezeNetBatch(): each must
+    // reproduce SqueezeNet()'s logits up to float summation order, packing
+    // from the same weight arrays (the store check at the end covers that)
+    const int image_size = INPUT_C * INPUT_H * INPUT_W;
+    std::vector<float> batch_images(2 * image_size);
+    std::copy(input_image_data, input_image_data + image_size, batch_images.begin());
+    std::copy(input_image_data, input_image_data + image_size, batch_images.begin() + image_size);
+    float batch_logits[2 * NUM_CLASSES];
+    SqueezeNetBatch(2, batch_images.data(), batch_logits);
+    float batch_error = 0.0f;
+    for (int i = 0; i < 2 * NUM_CLASSES; ++i) {
+        batch_error = std::max(batch_error, std::fabs(batch_logits[i] - output_logits[i % NUM_CLASSES]));
+    }
+    std::cout << "Batched logits (2 images): max error vs SqueezeNet() " << batch_error << std::endl;
+    failures += check_path("batched", true, batch_error, 1e-4f * (1.0f + logit_scale));
+
+    // --- INT8 Path ---
+    // Calibrate the activation ranges on the sample image, rerun at int8 and
+    // check that it predicts the same class as the float network, within
+    // the int8 tolerance
+    squeezenet_int8_calibrate(1, input_image_data);
+    set_inference_precision(PRECISION_INT8);
+    float int8_logits[NUM_CLASSES];
+    SqueezeNet(input_image_data, int8_logits);
+    set_inference_precision(PRECISION_FP32);
+    int int8_class = std::distance(int8_logits, std::max_element(int8_logits, int8_logits + NUM_CLASSES));
+    float int8_error = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        int8_error = std::max(int8_error, std::fabs(int8_logits[i] - output_logits[i]));
+    }
+    std::cout << "\nINT8 Predicted Class: " << int8_class
+              << (int8_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+              << ", max logit error " << int8_error << std::endl;
+    failures += check_path("INT8", int8_class == predicted_class, int8_error, TOLERANCE_INT8 * logit_scale);
+
+    // --- Mixed-Precision Policy ---
+    // Keep conv1 and conv10 in fp32 and run the fires at int8, then sweep the
+    // candidate policies on the sample image for the fastest one that keeps
+    // the fp32 class. Every policy must keep the class and stay within the
+    // int8 tolerance.
+    PrecisionPolicy policy = uniform_precision_policy(LAYER_INT8);
+    policy.layer[POLICY_CONV1] = LAYER_FP32;
+    policy.layer[POLICY_CONV10] = LAYER_FP32;
+    set_precision_policy(policy);
+    float mixed_logits[NUM_CLASSES];
+    SqueezeNet(input_image_data, mixed_logits);
+    set_precision_policy(uniform_precision_policy(LAYER_FP32));
+    int mixed_class = std::distance(mixed_logits, std::max_element(mixed_logits, mixed_logits + NUM_CLASSES));
+    float mixed_error = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        mixed_error = std::max(mixed_error, std::fabs(mixed_logits[i] - output_logits[i]));
+    }
+    std::cout << "Mixed-Precision Predicted Class: " << mixed_class
+              << (mixed_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+              << ", max logit error " << mixed_error << std::endl;
+    failures += check_path("Mixed-Precision", mixed_class == predicted_class, mixed_error,
+                           TOLERANCE_INT8 * logit_scale);
+
+    PrecisionPolicy candidates[PRECISION_MAX_CANDIDATES];
+    PrecisionSweepResult sweep[PRECISION_MAX_CANDIDATES];
+    int candidate_count = precision_policy_candidates(candidates);
+    int fastest = squeezenet_precision_sweep(1, input_image_data, NULL, candidates, candidate_count, 0.0, sweep);
+    char policy_label[256];
+    std::cout << "Precision sweep (ms/image, max logit error vs fp32, policy):" << std::endl;
+    for (int i = 0; i < candidate_count; ++i) {
+        precision_policy_label(sweep[i].policy, policy_label, sizeof(policy_label));
+        printf("  %9.3f  %12.6g  %s\n", sweep[i].ms_per_image, sweep[i].max_logit_error, policy_label);
+        failures += check_path(policy_label, sweep[i].top1 == 1.0, (float)sweep[i].max_logit_error,
+                               TOLERANCE_INT8 * logit_scale);
+    }
+    if (fastest < 0) {
+        std::cout << "ERROR: no policy keeps the fp32 class" << std::endl;
+        ++failures;
+    } else {
+        precision_policy_label(sweep[fastest].policy, policy_label, sizeof(policy_label));
+        std::cout << "Fastest policy keeping the fp32 class: " << policy_label << " ("
+                  << sweep[fastest].ms_per_image << " ms vs " << sweep[0].ms_per_image << " ms at fp32"
+                  << ", max logit error " << sweep[fastest].max_logit_error << ")" << std::endl;
+    }
+
+    // --- Fixed-Point Path ---
+    // Check the sample image's calibrated activation ranges against
+    // ap_fixed<16,6>, round the image and weights to it, run the fixed-point
+    // top and check that it predicts the same class as the float network,
+    // within TOLERANCE_FIXED
+    const char* fixed_scale_path = "squeezenet_tb_scales.txt";
+    float calibration_logits[NUM_CLASSES];
+    calibration_begin();
+    SqueezeNet(input_image_data, calibration_logits);
+    calibration_end();
+    int saturating = calibration_write(fixed_scale_path) ? squeezenet_fixed_point_check_ranges(fixed_scale_path) : -1;
+    std::remove(fixed_scale_path);
+    if (saturating < 0) {
+        std::cout << "ERROR: Fixed-Point: could not write or read " << fixed_scale_path << std::endl;
+        ++failures;
+    } else if (saturating > 0) {
+        std::cout << "ERROR: Fixed-Point: " << saturating << " layer ranges saturate ap_fixed<16,6>" << std::endl;
+        ++failures;
+    }
+    static fixed_data_t fixed_image[INPUT_H * INPUT_W * INPUT_C];
+    static fixed_data_t fixed_weights[SQUEEZENET_FIXED_POINT_WEIGHTS];
+    fixed_data_t fixed_logits[NUM_CLASSES];
+    for (int i = 0; i < INPUT_H * INPUT_W * INPUT_C; ++i) fixed_image[i] = fixed_data_t(input_image_data[i]);
+    squeezenet_fixed_point_weights(fixed_weights);
+    SqueezeNetFixedPoint(fixed_image, fixed_weights, fixed_logits);
+    float fixed_error = 0.0f;
+    int fixed_class = 0;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        fixed_error = std::max(fixed_error, std::fabs(fixed_logits[i].to_float() - output_logits[i]));
+        if (fixed_logits[i] > fixed_logits[fixed_class]) fixed_class = i;
+    }
+    std::cout << "Fixed-Point Predicted Class: " << fixed_class
+              << (fixed_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+              << ", max logit error " << fixed_error << std::endl;
+    failures += check_path("Fixed-Point", fixed_class == predicted_class, fixed_error, TOLERANCE_FIXED * logit_scale);
+
+    // --- Weight Store ---
+    // Every path above packs the same weight arrays, so the store must hold them all
+    int store_overflows = weight_store_overflows();
+    if (store_overflows > 0) {
+        std::cout << "ERROR: the weight store was full for " << store_overflows << " lookups" << std::endl;
+        ++failures;
+    }
+
     // --- Verification (Optional) ---
     // Compare output_logits against expected values from a known framework (e.g., PyTorch, TensorFlow)
     // running the same model with the same weights and input. This requires having golden reference data.
@@ -58,6 +265,10 @@ int main() {
     //      std::cout << "Verification FAILED with " << errors << " mismatches." << std::endl;
     // }
 
+    if (failures > 0) {
+        std::cout << "--- Testbench FAILED (" << failures << " checks) ---" << std::endl;
+        return 1;
+    }
     std::cout << "--- Testbench Finished ---" << std::endl;
     return 0; // Return 0 for success
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side only; HLS parallelism comes from the pragmas
+
+#include <algorithm>          // For std::min, std::max, std::find
+#include <atomic>             // For std::atomic
+#include <condition_variable> // For std::condition_variable
+#include <memory>             // For std::unique_ptr
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread
+#include <vector>             // For the worker and job lists
+
+// One parallel_for() / parallel_branches() call: items [0, n) handed out
+// `chunk` at a time. Lives on the submitting thread's stack.
+struct ParallelJob {
+    const std::function<void(int, int)>* body;
+    int n;
+    int chunk;
+    std::atomic<int> next{0}; // First item not yet claimed
+    int helpers = 0;          // Threads running this job's items (pool mutex)
+};
+
+// Persistent workers. Any number of jobs can be posted at once (nested
+// calls, concurrent branches, concurrent inferences); idle threads help the
+// newest one, so inner jobs that outer items are waiting for go first.
+struct ThreadPool {
+    std::vector<std::thread> workers;
+    std::mutex mutex;                  // Guards jobs, helpers and stopping
+    std::condition_variable changed;   // A job was posted or lost its last helper
+    std::vector<ParallelJob*> jobs;    // Posted jobs, newest last
+    bool stopping = false;
+
+    explicit ThreadPool(int num_workers) {
+        for (int i = 0; i < num_workers; ++i) {
+            workers.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        changed.notify_all();
+        for (std::thread& t : workers) {
+            t.join();
+        }
+    }
+
+    // Newest posted job with items left to claim, or NULL (mutex held)
+    ParallelJob* open_job() {
+        for (int i = (int)jobs.size() - 1; i >= 0; --i) {
+            if (jobs[i]->next.load() < jobs[i]->n) {
+                return jobs[i];
+            }
+        }
+        return 0;
+    }
+
+    // Claim and run items of `job` until none are left. Called with the
+    // mutex held; it is released while the items run.
+    void help(std::unique_lock<std::mutex>& lock, ParallelJob& job) {
+        ++job.helpers;
+        lock.unlock();
+        for (;;) {
+            int begin = job.next.fetch_add(job.chunk);
+            if (begin >= job.n) {
+                break;
+            }
+            (*job.body)(begin, std::min(begin + job.chunk, job.n));
+        }
+        lock.lock();
+        if (--job.helpers == 0) {
+            changed.notify_all();
+        }
+    }
+
+    void worker_loop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            ParallelJob* job = 0;
+            changed.wait(lock, [&] { return stopping || (job = open_job()) != 0; });
+            if (stopping) {
+                return;
+            }
+            help(lock, *job);
+        }
+    }
+
+    // Post a job, work on it, and return once every item has finished. While
+    // other threads are still finishing its last items, the caller helps
+    // with whatever else is open instead of sleeping.
+    void run(ParallelJob& job) {
+        std::unique_lock<std::mutex> lock(mutex);
+        jobs.push_back(&job);
+        changed.notify_all();
+        help(lock, job);
+        jobs.erase(std::find(jobs.begin(), jobs.end(), &job));
+        while (job.helpers > 0) {
+            ParallelJob* other = open_job();
+            if (other) {
+                help(lock, *other);
+            } else {
+                changed.wait(lock);
+            }
+        }
+    }
+};
+
+static std::atomic<int> thread_count{0};     // 0 = not set yet (use the hardware count)
+static std::unique_ptr<ThreadPool> pool;     // Started on the first parallel job
+static std::mutex pool_mutex;                // Guards pool creation/replacement
+
+void set_num_threads(int n) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    thread_count = std::max(1, std::min(n, PARALLEL_MAX_THREADS));
+    pool.reset(); // Restarted with the new size on the next parallel job
+}
+
+int num_threads() {
+    int n = thread_count.load();
+    if (n == 0) {
+        n = std::max(1, std::min((int)std::thread::hardware_concurrency(), PARALLEL_MAX_THREADS));
+        thread_count = n;
+    }
+    return n;
+}
+
+static thread_local bool thread_serial = false; // set_thread_serial()
+
+void set_thread_serial(bool serial) {
+    thread_serial = serial;
+}
+
+static ThreadPool* thread_pool() {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if (!pool) {
+        pool.reset(new ThreadPool(num_threads() - 1));
+    }
+    return pool.get();
+}
+
+int parallel_task_count(double total_cost) {
+    int threads = num_threads();
+    if (threads <= 1 || thread_serial) {
+        return 1;
+    }
+    double by_cost = total_cost / PARALLEL_MIN_TASK_COST;
+    int tasks = threads * PARALLEL_TASKS_PER_THREAD;
+    if (by_cost < tasks) {
+        tasks = (int)by_cost;
+    }
+    return std::max(tasks, 1);
+}
+
+void parallel_for(int n, double item_cost, const std::function<void(int, int)>& body) {
+    if (n <= 0) {
+        return;
+    }
+    int tasks = std::min(n, parallel_task_count(n * item_cost));
+    if (tasks <= 1) {
+        body(0, n);
+        return;
+    }
+    ParallelJob job;
+    job.body = &body;
+    job.n = n;
+    job.chunk = (n + tasks - 1) / tasks;
+    thread_pool()->run(job);
+}
+
+void parallel_branches(double total_cost, std::initializer_list<std::function<void()>> branches) {
+    const std::function<void()>* branch = branches.begin();
+    const int n = (int)branches.size();
+    if (n <= 1 || parallel_task_count(total_cost) < 2) {
+        for (int b = 0; b < n; ++b) {
+            branch[b]();
+        }
+        return;
+    }
+    std::function<void(int, int)> body = [&](int begin, int end) {
+        for (int b = begin; b < end; ++b) {
+            branch[b]();
+        }
+    };
+    ParallelJob job;
+    job.body = &body;
+    job.n = n;
+    job.chunk = 1;
+    thread_pool()->run(job);
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,56 @@
+#ifndef SQUEEZENET_THREADS_H
+#define SQUEEZENET_THREADS_H
+
+#include <functional>       // For std::function
+#include <initializer_list> // For parallel_branches()
+
+// ==========================================================================
+// === Thread Pool and Branch Executor (Host Builds Only) ===================
+// ==========================================================================
+// One inference is spread over the cores by splitting each layer into
+// independent work items (output-channel block x spatial tile). A pool of
+// persistent workers, started on first use, picks the items up together
+// with the calling thread; nothing is allocated or spawned per layer.
+//
+// Each layer states what one item costs (in multiply-adds or comparable
+// units). parallel_for() groups items so that no task is cheaper than
+// PARALLEL_MIN_TASK_COST and runs layers too small to be worth a handoff
+// (13x13 fire modules, the classifier) inline on the caller, so small maps
+// do not drown in synchronization.
+//
+// Independent sub-graphs (the two fire expand layers, the residual and main
+// paths of an Xception block) are forked with parallel_branches() and joined
+// when it returns, before the concatenation or residual add. Jobs nest:
+// each branch still splits its own layers with parallel_for(), and a thread
+// waiting for a job's last items helps with any other open job (another
+// branch, another InferenceContext's layer) instead of sleeping.
+// ==========================================================================
+
+#define PARALLEL_MAX_THREADS 64        // Upper bound for set_num_threads()
+#define PARALLEL_MIN_TASK_COST 65536   // Work (multiply-adds) worth waking a thread for
+#define PARALLEL_TASKS_PER_THREAD 4    // Over-decomposition for load balance
+
+// Threads used per layer, the caller included (1 = serial). Defaults to the
+// number of hardware threads. Must not be called while an inference runs.
+void set_num_threads(int n);
+int num_threads();
+
+// Keep the calling thread's layers to itself: while set, its parallel_for()
+// and parallel_branches() calls run inline and parallel_task_count() is 1.
+// For threads that own a core of their own (pipeline stages).
+void set_thread_serial(bool serial);
+
+// Tasks a job of the given total cost should be split into: enough to keep
+// every thread busy, none below PARALLEL_MIN_TASK_COST, at least 1.
+int parallel_task_count(double total_cost);
+
+// Run body(begin, end) over disjoint ranges covering [0, n); every item
+// costs about item_cost. Returns when all items are done.
+void parallel_for(int n, double item_cost, const std::function<void(int, int)>& body);
+
+// Run independent branches concurrently and return when all are done.
+// total_cost is their combined work; below two tasks' worth the branches
+// simply run one after the other on the caller.
+void parallel_branches(double total_cost, std::initializer_list<std::function<void()>> branches);
+
+#endif // SQUEEZENET_THREADS_H
@@ -0,0 +1,161 @@
+#include "squeezenet_weight_store.h"
+
+#ifndef __SYNTHESIS__ // Host-side only; HLS reads the weight arrays directly
+
+#include <algorithm> // For std::min
+#include <cstdio>    // For the overflow report
+#include <mutex>     // For std::mutex
+
+// Packed layouts the store can hold
+enum PackedLayout {
+    PACKED_GEMM_PANELS,  // MR-row SGEMM panels
+    PACKED_OIHW8I8O      // NCHW8c direct convolution blocks
+};
+
+// One packed layer, keyed by its weight array and layout
+struct PackedLayer {
+    const float* weights;  // Original (M, K) row-major weights
+    const float* panels;   // Packed copy (see header)
+    PackedLayout layout;
+    int M, K;              // GEMM view: OutC x InC*KH*KW
+};
+
+static bool store_enabled = true;
+static PackedLayer layers[WEIGHT_STORE_MAX_LAYERS];
+static int num_layers = 0;
+static float panel_pool[WEIGHT_STORE_POOL_SIZE];
+static int panel_pool_used = 0;
+static float blocked_pool[WEIGHT_STORE_BLOCKED_POOL_SIZE];
+static int blocked_pool_used = 0;
+// Lookups and insertions are serialized so inference threads can share the
+// store; a hit returns a pointer into a pool that is never repacked.
+static std::mutex store_mutex;
+// Lookups turned away since the last clear. The pools are sized for every
+// layer of the network, so any overflow is a sizing bug (or weights that are
+// not the network's arrays) and costs a repack on every call.
+static int overflows = 0;
+
+void set_weight_store_enabled(bool enabled) {
+    store_enabled = enabled;
+}
+
+int weight_store_overflows() {
+    std::lock_guard<std::mutex> lock(store_mutex);
+    return overflows;
+}
+
+void weight_store_clear() {
+    std::lock_guard<std::mutex> lock(store_mutex);
+    overflows = 0;
+    num_layers = 0;
+    panel_pool_used = 0;
+    blocked_pool_used = 0;
+}
+
+// Called with store_mutex held; the first overflow is reported on stderr
+static void report_overflow(const char* pool, int M, int K) {
+    if (overflows++ == 0) {
+        fprintf(stderr, "weight store: %s full, the (%d x %d) layer is repacked on every call\n",
+                pool, M, K);
+    }
+}
+
+static const float* find_layer(const float weights[], PackedLayout layout, int M, int K) {
+    for (int l = 0; l < num_layers; ++l) {
+        if (layers[l].weights == weights && layers[l].layout == layout &&
+            layers[l].M == M && layers[l].K == K) {
+            return layers[l].panels;
+        }
+    }
+    return 0;
+}
+
+static void add_layer(const float weights[], const float panels[], PackedLayout layout, int M, int K) {
+    PackedLayer& layer = layers[num_layers++];
+    layer.weights = weights;
+    layer.panels = panels;
+    layer.layout = layout;
+    layer.M = M;
+    layer.K = K;
+}
+
+static void pack_panels(const float weights[], int M, int K, float dst[]) {
+    const int Mpad = WEIGHT_STORE_PANELS(M, 1);
+    for (int pc = 0; pc < K; pc += SGEMM_KC) {
+        int kc = std::min(SGEMM_KC, K - pc);
+        for (int ip = 0; ip < Mpad; ip += SGEMM_MR) {
+            for (int k = 0; k < kc; ++k) {
+                for (int i = 0; i < SGEMM_MR; ++i) {
+                    int row = ip + i;
+                    dst[i] = (row < M) ? weights[row * K + pc + k] : 0.0f;
+                }
+                dst += SGEMM_MR;
+            }
+        }
+    }
+}
+
+const float* weight_store_gemm_panels(const float weights[], int M, int K) {
+    if (!store_enabled) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(store_mutex);
+    const float* cached = find_layer(weights, PACKED_GEMM_PANELS, M, K);
+    if (cached) {
+        return cached;
+    }
+
+    int size = WEIGHT_STORE_PANELS(M, K);
+    if (num_layers == WEIGHT_STORE_MAX_LAYERS || panel_pool_used + size > WEIGHT_STORE_POOL_SIZE) {
+        report_overflow("panel pool", M, K);
+        return 0;
+    }
+    float* panels = panel_pool + panel_pool_used;
+    pack_panels(weights, M, K, panels);
+    panel_pool_used += size;
+    add_layer(weights, panels, PACKED_GEMM_PANELS, M, K);
+    return panels;
+}
+
+const float* weight_store_oihw8i8o(const float weights[], int OutC, int InC, int KH, int KW) {
+    if (!store_enabled) {
+        return 0;
+    }
+    const int K = InC * KH * KW;
+    std::lock_guard<std::mutex> lock(store_mutex);
+    const float* cached = find_layer(weights, PACKED_OIHW8I8O, OutC, K);
+    if (cached) {
+        return cached;
+    }
+
+    const int OCB = WEIGHT_STORE_ROUND_BLOCK(OutC) / NCHWC_BLOCK;
+    const int ICB = WEIGHT_STORE_ROUND_BLOCK(InC) / NCHWC_BLOCK;
+    int size = WEIGHT_STORE_BLOCKED(OutC, InC, KH * KW);
+    if (num_layers == WEIGHT_STORE_MAX_LAYERS || blocked_pool_used + size > WEIGHT_STORE_BLOCKED_POOL_SIZE) {
+        report_overflow("blocked pool", OutC, K);
+        return 0;
+    }
+    float* dst = blocked_pool + blocked_pool_used;
+    for (int ocb = 0; ocb < OCB; ++ocb) {
+        for (int icb = 0; icb < ICB; ++icb) {
+            for (int kh = 0; kh < KH; ++kh) {
+                for (int kw = 0; kw < KW; ++kw) {
+                    for (int i = 0; i < NCHWC_BLOCK; ++i) {
+                        for (int o = 0; o < NCHWC_BLOCK; ++o) {
+                            int oc = ocb * NCHWC_BLOCK + o;
+                            int ic = icb * NCHWC_BLOCK + i;
+                            *dst++ = (oc < OutC && ic < InC) ?
+                                weights[((oc * InC + ic) * KH + kh) * KW + kw] : 0.0f;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    float* packed = blocked_pool + blocked_pool_used;
+    blocked_pool_used += size;
+    add_layer(weights, packed, PACKED_OIHW8I8O, OutC, K);
+    return packed;
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,76 @@
+#ifndef SQUEEZENET_WEIGHT_STORE_H
+#define SQUEEZENET_WEIGHT_STORE_H
+
+#include "squeezenet_params.h"
+#include "squeezenet_gemm.h"
+#include "squeezenet_simd.h"
+
+// ==========================================================================
+// === Pre-Packed Weight Store (Host Builds Only) ===========================
+// ==========================================================================
+// The SGEMM backends used to re-pack each layer's (OutC, InC*KH*KW) weights
+// into MR-row panels on every call. The store packs each layer once, the
+// first time its weight array is seen, and hands the kernels the cached
+// panels from then on. Layout, for every KC-deep slice of the reduction:
+//   [MR-row panel p][k][i]   = weights[p*MR + i][pc + k]  (rows zero-padded)
+// Slice pc starts at offset pc * round_up(OutC, MR), and panel p of that
+// slice at (p * MR) * kc, so any MC x KC block the macro-kernel walks is
+// already contiguous. The panel shape only depends on SGEMM_MR/SGEMM_KC,
+// which are the same for every instruction set.
+//
+// The NCHW8c path (squeezenet_nchwc.h) reads the same weights in OIhw8i8o
+// order: [OutC/8][InC/8][KH][KW][8 in][8 out], both channel counts
+// zero-padded to whole blocks.
+// ==========================================================================
+
+#define WEIGHT_STORE_MAX_LAYERS 64 // GEMM panels + OIhw8i8o copies of every layer
+
+// Floats needed for one packed (M x K) weight matrix
+#define WEIGHT_STORE_PANELS(M, K) ((((M) + SGEMM_MR - 1) / SGEMM_MR) * SGEMM_MR * (K))
+#define WEIGHT_STORE_FIRE(n) ( \
+    WEIGHT_STORE_PANELS(FIRE##n##_S1x1, FIRE##n##_C_IN) + \
+    WEIGHT_STORE_PANELS(FIRE##n##_E1x1, FIRE##n##_S1x1) + \
+    WEIGHT_STORE_PANELS(FIRE##n##_E3x3, 9 * FIRE##n##_S1x1))
+
+// Every conv layer in SqueezeNet() (expand3x3 included for the direct fallback)
+#define WEIGHT_STORE_POOL_SIZE ( \
+    WEIGHT_STORE_PANELS(CONV1_C_OUT, INPUT_C * CONV1_KH * CONV1_KW) + \
+    WEIGHT_STORE_FIRE(2) + WEIGHT_STORE_FIRE(3) + WEIGHT_STORE_FIRE(4) + \
+    WEIGHT_STORE_FIRE(5) + WEIGHT_STORE_FIRE(6) + WEIGHT_STORE_FIRE(7) + \
+    WEIGHT_STORE_FIRE(8) + WEIGHT_STORE_FIRE(9) + \
+    WEIGHT_STORE_PANELS(CONV10_C_OUT, CONV10_C_IN * CONV10_KH * CONV10_KW))
+
+// Floats needed for one OIhw8i8o weight tensor
+#define WEIGHT_STORE_ROUND_BLOCK(C) ((((C) + NCHWC_BLOCK - 1) / NCHWC_BLOCK) * NCHWC_BLOCK)
+#define WEIGHT_STORE_BLOCKED(OutC, InC, KK) \
+    (WEIGHT_STORE_ROUND_BLOCK(OutC) * WEIGHT_STORE_ROUND_BLOCK(InC) * (KK))
+#define WEIGHT_STORE_BLOCKED_FIRE(n) ( \
+    WEIGHT_STORE_BLOCKED(FIRE##n##_S1x1, FIRE##n##_C_IN, 1) + \
+    WEIGHT_STORE_BLOCKED(FIRE##n##_E1x1, FIRE##n##_S1x1, 1) + \
+    WEIGHT_STORE_BLOCKED(FIRE##n##_E3x3, FIRE##n##_S1x1, 9))
+
+#define WEIGHT_STORE_BLOCKED_POOL_SIZE ( \
+    WEIGHT_STORE_BLOCKED(CONV1_C_OUT, INPUT_C, CONV1_KH * CONV1_KW) + \
+    WEIGHT_STORE_BLOCKED_FIRE(2) + WEIGHT_STORE_BLOCKED_FIRE(3) + WEIGHT_STORE_BLOCKED_FIRE(4) + \
+    WEIGHT_STORE_BLOCKED_FIRE(5) + WEIGHT_STORE_BLOCKED_FIRE(6) + WEIGHT_STORE_BLOCKED_FIRE(7) + \
+    WEIGHT_STORE_BLOCKED_FIRE(8) + WEIGHT_STORE_BLOCKED_FIRE(9) + \
+    WEIGHT_STORE_BLOCKED(CONV10_C_OUT, CONV10_C_IN, CONV10_KH * CONV10_KW))
+
+// Enable/disable the store (enabled by default; disabled = pack per call)
+void set_weight_store_enabled(bool enabled);
+
+// Packed MR-row panels for an (M x K) row-major weight matrix.
+// Returns NULL if the store is disabled or full; callers then pack per call.
+const float* weight_store_gemm_panels(const float weights[], int M, int K);
+
+// OIhw8i8o copy of (OutC, InC, KH, KW) weights, or NULL if disabled or full
+const float* weight_store_oihw8i8o(const float weights[], int OutC, int InC, int KH, int KW);
+
+// Drop every cached layer (e.g. after the weight arrays were overwritten)
+void weight_store_clear();
+
+// Lookups turned away because the store was full, since the last clear. The
+// first one is reported on stderr; the testbench fails on any.
+int weight_store_overflows();
+
+#endif // SQUEEZENET_WEIGHT_STORE_H
@@ -3,12 +3,21 @@
 
 #include "squeezenet_params.h"
 
+#ifdef __SYNTHESIS__
+#define WEIGHTS_CONST const
+#else
+#define WEIGHTS_CONST
+#endif
+
 // ==========================================================================
-// === PLACEHOLDER WEIGHTS AND BIASES =======================================
+// === SqueezeNet 1.1 Weights and Biases ====================================
 // ==========================================================================
-// IMPORTANT: Replace these zero arrays with actual pre-trained weights
-//            and biases for SqueezeNet 1.1. The dimensions must match
-//            those defined in squeezenet_params.h.
+// Declarations only: the arrays are defined once, in squeezenet_weights.cpp
+// (placeholder zeros, or the output of Scripts/generate_weights.py),
+// so every file that includes this header sees the same array. The host
+// weight store caches packed copies by array address. HLS reads them as
+// constants; host builds keep them writable, so a testbench can load other
+// weights before its first inference (or call weight_store_clear() after).
 //
 // Weight shape convention: (OutC, InC, KH, KW) flattened
 // Bias shape convention: (OutC)
@@ -16,103 +25,103 @@
 
 // --- Conv1 ---
 // Shape: (64, 3, 3, 3) = 1728
-static const float conv1_weights[CONV1_C_OUT * INPUT_C * CONV1_KH * CONV1_KW] = {0.0f};
+extern WEIGHTS_CONST float conv1_weights[CONV1_C_OUT * INPUT_C * CONV1_KH * CONV1_KW];
 // Shape: (64)
-static const float conv1_biases[CONV1_C_OUT] = {0.0f};
+extern WEIGHTS_CONST float conv1_biases[CONV1_C_OUT];
 
 // --- Fire2 ---
 // Squeeze 1x1: (16, 64, 1, 1) = 1024
-static const float fire2_squeeze1x1_weights[FIRE2_S1x1 * FIRE2_C_IN * 1 * 1] = {0.0f};
-static const float fire2_squeeze1x1_biases[FIRE2_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire2_squeeze1x1_weights[FIRE2_S1x1 * FIRE2_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire2_squeeze1x1_biases[FIRE2_S1x1];
 // Expand 1x1: (64, 16, 1, 1) = 1024
-static const float fire2_expand1x1_weights[FIRE2_E1x1 * FIRE2_S1x1 * 1 * 1] = {0.0f};
-static const float fire2_expand1x1_biases[FIRE2_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire2_expand1x1_weights[FIRE2_E1x1 * FIRE2_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire2_expand1x1_biases[FIRE2_E1x1];
 // Expand 3x3: (64, 16, 3, 3) = 9216
-static const float fire2_expand3x3_weights[FIRE2_E3x3 * FIRE2_S1x1 * 3 * 3] = {0.0f};
-static const float fire2_expand3x3_biases[FIRE2_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire2_expand3x3_weights[FIRE2_E3x3 * FIRE2_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire2_expand3x3_biases[FIRE2_E3x3];
 
 // --- Fire3 ---
 // Squeeze 1x1: (16, 128, 1, 1) = 2048
-static const float fire3_squeeze1x1_weights[FIRE3_S1x1 * FIRE3_C_IN * 1 * 1] = {0.0f};
-static const float fire3_squeeze1x1_biases[FIRE3_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire3_squeeze1x1_weights[FIRE3_S1x1 * FIRE3_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire3_squeeze1x1_biases[FIRE3_S1x1];
 // Expand 1x1: (64, 16, 1, 1) = 1024
-static const float fire3_expand1x1_weights[FIRE3_E1x1 * FIRE3_S1x1 * 1 * 1] = {0.0f};
-static const float fire3_expand1x1_biases[FIRE3_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire3_expand1x1_weights[FIRE3_E1x1 * FIRE3_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire3_expand1x1_biases[FIRE3_E1x1];
 // Expand 3x3: (64, 16, 3, 3) = 9216
-static const float fire3_expand3x3_weights[FIRE3_E3x3 * FIRE3_S1x1 * 3 * 3] = {0.0f};
-static const float fire3_expand3x3_biases[FIRE3_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire3_expand3x3_weights[FIRE3_E3x3 * FIRE3_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire3_expand3x3_biases[FIRE3_E3x3];
 
 // --- Fire4 ---
 // Squeeze 1x1: (32, 128, 1, 1) = 4096
-static const float fire4_squeeze1x1_weights[FIRE4_S1x1 * FIRE4_C_IN * 1 * 1] = {0.0f};
-static const float fire4_squeeze1x1_biases[FIRE4_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire4_squeeze1x1_weights[FIRE4_S1x1 * FIRE4_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire4_squeeze1x1_biases[FIRE4_S1x1];
 // Expand 1x1: (128, 32, 1, 1) = 4096
-static const float fire4_expand1x1_weights[FIRE4_E1x1 * FIRE4_S1x1 * 1 * 1] = {0.0f};
-static const float fire4_expand1x1_biases[FIRE4_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire4_expand1x1_weights[FIRE4_E1x1 * FIRE4_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire4_expand1x1_biases[FIRE4_E1x1];
 // Expand 3x3: (128, 32, 3, 3) = 36864
-static const float fire4_expand3x3_weights[FIRE4_E3x3 * FIRE4_S1x1 * 3 * 3] = {0.0f};
-static const float fire4_expand3x3_biases[FIRE4_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire4_expand3x3_weights[FIRE4_E3x3 * FIRE4_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire4_expand3x3_biases[FIRE4_E3x3];
 
 // --- Fire5 ---
 // Squeeze 1x1: (32, 256, 1, 1) = 8192
-static const float fire5_squeeze1x1_weights[FIRE5_S1x1 * FIRE5_C_IN * 1 * 1] = {0.0f};
-static const float fire5_squeeze1x1_biases[FIRE5_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire5_squeeze1x1_weights[FIRE5_S1x1 * FIRE5_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire5_squeeze1x1_biases[FIRE5_S1x1];
 // Expand 1x1: (128, 32, 1, 1) = 4096
-static const float fire5_expand1x1_weights[FIRE5_E1x1 * FIRE5_S1x1 * 1 * 1] = {0.0f};
-static const float fire5_expand1x1_biases[FIRE5_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire5_expand1x1_weights[FIRE5_E1x1 * FIRE5_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire5_expand1x1_biases[FIRE5_E1x1];
 // Expand 3x3: (128, 32, 3, 3) = 36864
-static const float fire5_expand3x3_weights[FIRE5_E3x3 * FIRE5_S1x1 * 3 * 3] = {0.0f};
-static const float fire5_expand3x3_biases[FIRE5_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire5_expand3x3_weights[FIRE5_E3x3 * FIRE5_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire5_expand3x3_biases[FIRE5_E3x3];
 
 // --- Fire6 ---
 // Squeeze 1x1: (48, 256, 1, 1) = 12288
-static const float fire6_squeeze1x1_weights[FIRE6_S1x1 * FIRE6_C_IN * 1 * 1] = {0.0f};
-static const float fire6_squeeze1x1_biases[FIRE6_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire6_squeeze1x1_weights[FIRE6_S1x1 * FIRE6_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire6_squeeze1x1_biases[FIRE6_S1x1];
 // Expand 1x1: (192, 48, 1, 1) = 9216
-static const float fire6_expand1x1_weights[FIRE6_E1x1 * FIRE6_S1x1 * 1 * 1] = {0.0f};
-static const float fire6_expand1x1_biases[FIRE6_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire6_expand1x1_weights[FIRE6_E1x1 * FIRE6_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire6_expand1x1_biases[FIRE6_E1x1];
 // Expand 3x3: (192, 48, 3, 3) = 82944
-static const float fire6_expand3x3_weights[FIRE6_E3x3 * FIRE6_S1x1 * 3 * 3] = {0.0f};
-static const float fire6_expand3x3_biases[FIRE6_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire6_expand3x3_weights[FIRE6_E3x3 * FIRE6_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire6_expand3x3_biases[FIRE6_E3x3];
 
 // --- Fire7 ---
 // Squeeze 1x1: (48, 384, 1, 1) = 18432
-static const float fire7_squeeze1x1_weights[FIRE7_S1x1 * FIRE7_C_IN * 1 * 1] = {0.0f};
-static const float fire7_squeeze1x1_biases[FIRE7_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire7_squeeze1x1_weights[FIRE7_S1x1 * FIRE7_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire7_squeeze1x1_biases[FIRE7_S1x1];
 // Expand 1x1: (192, 48, 1, 1) = 9216
-static const float fire7_expand1x1_weights[FIRE7_E1x1 * FIRE7_S1x1 * 1 * 1] = {0.0f};
-static const float fire7_expand1x1_biases[FIRE7_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire7_expand1x1_weights[FIRE7_E1x1 * FIRE7_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire7_expand1x1_biases[FIRE7_E1x1];
 // Expand 3x3: (192, 48, 3, 3) = 82944
-static const float fire7_expand3x3_weights[FIRE7_E3x3 * FIRE7_S1x1 * 3 * 3] = {0.0f};
-static const float fire7_expand3x3_biases[FIRE7_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire7_expand3x3_weights[FIRE7_E3x3 * FIRE7_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire7_expand3x3_biases[FIRE7_E3x3];
 
 // --- Fire8 ---
 // Squeeze 1x1: (64, 384, 1, 1) = 24576
-static const float fire8_squeeze1x1_weights[FIRE8_S1x1 * FIRE8_C_IN * 1 * 1] = {0.0f};
-static const float fire8_squeeze1x1_biases[FIRE8_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire8_squeeze1x1_weights[FIRE8_S1x1 * FIRE8_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire8_squeeze1x1_biases[FIRE8_S1x1];
 // Expand 1x1: (256, 64, 1, 1) = 16384
-static const float fire8_expand1x1_weights[FIRE8_E1x1 * FIRE8_S1x1 * 1 * 1] = {0.0f};
-static const float fire8_expand1x1_biases[FIRE8_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire8_expand1x1_weights[FIRE8_E1x1 * FIRE8_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire8_expand1x1_biases[FIRE8_E1x1];
 // Expand 3x3: (256, 64, 3, 3) = 147456
-static const float fire8_expand3x3_weights[FIRE8_E3x3 * FIRE8_S1x1 * 3 * 3] = {0.0f};
-static const float fire8_expand3x3_biases[FIRE8_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire8_expand3x3_weights[FIRE8_E3x3 * FIRE8_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire8_expand3x3_biases[FIRE8_E3x3];
 
 // --- Fire9 ---
 // Squeeze 1x1: (64, 512, 1, 1) = 32768
-static const float fire9_squeeze1x1_weights[FIRE9_S1x1 * FIRE9_C_IN * 1 * 1] = {0.0f};
-static const float fire9_squeeze1x1_biases[FIRE9_S1x1] = {0.0f};
+extern WEIGHTS_CONST float fire9_squeeze1x1_weights[FIRE9_S1x1 * FIRE9_C_IN * 1 * 1];
+extern WEIGHTS_CONST float fire9_squeeze1x1_biases[FIRE9_S1x1];
 // Expand 1x1: (256, 64, 1, 1) = 16384
-static const float fire9_expand1x1_weights[FIRE9_E1x1 * FIRE9_S1x1 * 1 * 1] = {0.0f};
-static const float fire9_expand1x1_biases[FIRE9_E1x1] = {0.0f};
+extern WEIGHTS_CONST float fire9_expand1x1_weights[FIRE9_E1x1 * FIRE9_S1x1 * 1 * 1];
+extern WEIGHTS_CONST float fire9_expand1x1_biases[FIRE9_E1x1];
 // Expand 3x3: (256, 64, 3, 3) = 147456
-static const float fire9_expand3x3_weights[FIRE9_E3x3 * FIRE9_S1x1 * 3 * 3] = {0.0f};
-static const float fire9_expand3x3_biases[FIRE9_E3x3] = {0.0f};
+extern WEIGHTS_CONST float fire9_expand3x3_weights[FIRE9_E3x3 * FIRE9_S1x1 * 3 * 3];
+extern WEIGHTS_CONST float fire9_expand3x3_biases[FIRE9_E3x3];
 
 // --- Conv10 ---
 // Shape: (NUM_CLASSES, 512, 1, 1) = NUM_CLASSES * 512
-static const float conv10_weights[NUM_CLASSES * CONV10_C_IN * CONV10_KH * CONV10_KW] = {0.0f};
+extern WEIGHTS_CONST float conv10_weights[NUM_CLASSES * CONV10_C_IN * CONV10_KH * CONV10_KW];
 // Shape: (NUM_CLASSES)
-static const float conv10_biases[NUM_CLASSES] = {0.0f};
+extern WEIGHTS_CONST float conv10_biases[NUM_CLASSES];
 
 
 #endif // SQUEEZENET_WEIGHTS_H
\ No newline at end of file
@@ -0,0 +1,312 @@
+#include "squeezenet_winograd.h"
+#include "squeezenet_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side path only; HLS synthesizes the direct convolution
+
+#include <algorithm> // For std::min, std::max
+#include <cmath>     // For std::fabs
+#include <memory>    // For std::unique_ptr
+#include <mutex>     // For std::mutex
+
+#define WINOGRAD_TILE_AREA (WINOGRAD_T * WINOGRAD_T)
+
+// Per-layer state, keyed by the layer's weight array
+struct WinogradLayer {
+    const float* weights;  // Original (OutC, InC, 3, 3) weights
+    const float* U;        // Transformed weights: [36][OutC][InC]
+    int InC, OutC;
+    bool use_winograd;     // false if the tolerance check failed
+};
+
+static bool winograd_enabled = true;
+static WinogradLayer layers[WINOGRAD_MAX_LAYERS];
+static int num_layers = 0;
+static float weight_pool[WINOGRAD_WEIGHT_POOL_SIZE];
+static int weight_pool_used = 0;
+
+// Per-batch work buffers
+static std::mutex layers_mutex; // Guards layers/weight_pool across inference threads
+
+// Per-thread transformed batches (allocated on a thread's first call)
+struct WinogradScratch {
+    float V[WINOGRAD_TILE_AREA * WINOGRAD_MAX_IN_C * WINOGRAD_TILE_BATCH];  // [36][InC][TB]
+    float Mt[WINOGRAD_TILE_AREA * WINOGRAD_MAX_OUT_C * WINOGRAD_TILE_BATCH]; // [36][OutC][TB]
+};
+
+static WinogradScratch& winograd_scratch() {
+    static thread_local std::unique_ptr<WinogradScratch> scratch(new WinogradScratch);
+    return *scratch;
+}
+
+// Filter transform matrix G (6x3) for F(4x4,3x3), interpolation points 0, +-1, +-2
+static const float G[WINOGRAD_T][3] = {
+    {  1.0f / 4.0f,   0.0f,          0.0f        },
+    { -1.0f / 6.0f,  -1.0f / 6.0f,  -1.0f / 6.0f },
+    { -1.0f / 6.0f,   1.0f / 6.0f,  -1.0f / 6.0f },
+    {  1.0f / 24.0f,  1.0f / 12.0f,  1.0f / 6.0f },
+    {  1.0f / 24.0f, -1.0f / 12.0f,  1.0f / 6.0f },
+    {  0.0f,          0.0f,          1.0f        }
+};
+
+void set_winograd_enabled(bool enabled) {
+    winograd_enabled = enabled;
+}
+
+//--------------------------------------------------------------------------
+// 1-D Transforms (applied to columns, then rows)
+//--------------------------------------------------------------------------
+// r = B^T d
+static inline void input_transform_1d(const float d[], int ds, float r[], int rs) {
+    float d0 = d[0], d1 = d[ds], d2 = d[2 * ds], d3 = d[3 * ds], d4 = d[4 * ds], d5 = d[5 * ds];
+    r[0]      = 4.0f * d0 - 5.0f * d2 + d4;
+    r[rs]     = -4.0f * d1 - 4.0f * d2 + d3 + d4;
+    r[2 * rs] = 4.0f * d1 - 4.0f * d2 - d3 + d4;
+    r[3 * rs] = -2.0f * d1 - d2 + 2.0f * d3 + d4;
+    r[4 * rs] = 2.0f * d1 - d2 - 2.0f * d3 + d4;
+    r[5 * rs] = 4.0f * d1 - 5.0f * d3 + d5;
+}
+
+// y = A^T m
+static inline void output_transform_1d(const float m[], int ms, float y[], int ys) {
+    float m0 = m[0], m1 = m[ms], m2 = m[2 * ms], m3 = m[3 * ms], m4 = m[4 * ms], m5 = m[5 * ms];
+    float s12 = m1 + m2, d12 = m1 - m2;
+    float s34 = m3 + m4, d34 = m3 - m4;
+    y[0]      = m0 + s12 + s34;
+    y[ys]     = d12 + 2.0f * d34;
+    y[2 * ys] = s12 + 4.0f * s34;
+    y[3 * ys] = d12 + 8.0f * d34 + m5;
+}
+
+// v = B^T d B for one 6x6 tile
+static void input_transform(const float d[WINOGRAD_TILE_AREA], float v[WINOGRAD_TILE_AREA]) {
+    float tmp[WINOGRAD_TILE_AREA];
+    for (int j = 0; j < WINOGRAD_T; ++j) {
+        input_transform_1d(d + j, WINOGRAD_T, tmp + j, WINOGRAD_T);
+    }
+    for (int i = 0; i < WINOGRAD_T; ++i) {
+        input_transform_1d(tmp + i * WINOGRAD_T, 1, v + i * WINOGRAD_T, 1);
+    }
+}
+
+// y = A^T m A for one 6x6 tile -> 4x4 outputs
+static void output_transform(const float m[WINOGRAD_TILE_AREA], float y[WINOGRAD_M * WINOGRAD_M]) {
+    float tmp[WINOGRAD_M * WINOGRAD_T];
+    for (int j = 0; j < WINOGRAD_T; ++j) {
+        output_transform_1d(m + j, WINOGRAD_T, tmp + j, WINOGRAD_T);
+    }
+    for (int i = 0; i < WINOGRAD_M; ++i) {
+        output_transform_1d(tmp + i * WINOGRAD_T, 1, y + i * WINOGRAD_M, 1);
+    }
+}
+
+// u = G g G^T for one 3x3 filter
+static void weight_transform(const float g[9], float u[WINOGRAD_TILE_AREA]) {
+    float tmp[WINOGRAD_T][3];
+    for (int i = 0; i < WINOGRAD_T; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            tmp[i][j] = G[i][0] * g[j] + G[i][1] * g[3 + j] + G[i][2] * g[6 + j];
+        }
+    }
+    for (int i = 0; i < WINOGRAD_T; ++i) {
+        for (int j = 0; j < WINOGRAD_T; ++j) {
+            u[i * WINOGRAD_T + j] = tmp[i][0] * G[j][0] + tmp[i][1] * G[j][1] + tmp[i][2] * G[j][2];
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Layer Preparation (weight transform + tolerance check)
+//--------------------------------------------------------------------------
+// Compare one Winograd tile against the direct 3x3 convolution on a
+// deterministic pseudo-random 6x6 probe.
+static bool winograd_within_tolerance(const WinogradLayer& layer) {
+    const int InC = layer.InC;
+    float probe[WINOGRAD_MAX_IN_C][WINOGRAD_TILE_AREA];
+    float v[WINOGRAD_MAX_IN_C][WINOGRAD_TILE_AREA];
+
+    unsigned int seed = 0x9E3779B9u;
+    for (int ic = 0; ic < InC; ++ic) {
+        for (int i = 0; i < WINOGRAD_TILE_AREA; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            probe[ic][i] = (float)(seed >> 8) / (float)(1 << 23) - 1.0f; // [-1, 1)
+        }
+        input_transform(probe[ic], v[ic]);
+    }
+
+    float max_err = 0.0f;
+    float max_ref = 0.0f;
+    for (int oc = 0; oc < layer.OutC; ++oc) {
+        float m[WINOGRAD_TILE_AREA] = {};
+        for (int ic = 0; ic < InC; ++ic) {
+            for (int p = 0; p < WINOGRAD_TILE_AREA; ++p) {
+                m[p] += layer.U[(p * layer.OutC + oc) * InC + ic] * v[ic][p];
+            }
+        }
+        float y[WINOGRAD_M * WINOGRAD_M];
+        output_transform(m, y);
+
+        for (int oh = 0; oh < WINOGRAD_M; ++oh) {
+            for (int ow = 0; ow < WINOGRAD_M; ++ow) {
+                float ref = 0.0f;
+                for (int ic = 0; ic < InC; ++ic) {
+                    const float* g = layer.weights + (oc * InC + ic) * 9;
+                    for (int kh = 0; kh < 3; ++kh) {
+                        for (int kw = 0; kw < 3; ++kw) {
+                            ref += g[kh * 3 + kw] * probe[ic][(oh + kh) * WINOGRAD_T + ow + kw];
+                        }
+                    }
+                }
+                max_err = std::max(max_err, std::fabs(y[oh * WINOGRAD_M + ow] - ref));
+                max_ref = std::max(max_ref, std::fabs(ref));
+            }
+        }
+    }
+    return max_err <= WINOGRAD_TOLERANCE * std::max(max_ref, 1e-6f);
+}
+
+// Find (or create) the cached state for a layer. Returns NULL if it cannot be cached.
+static const WinogradLayer* winograd_prepare(const float weights[], int InC, int OutC) {
+    std::lock_guard<std::mutex> lock(layers_mutex);
+    for (int l = 0; l < num_layers; ++l) {
+        if (layers[l].weights == weights) {
+            return &layers[l];
+        }
+    }
+
+    int size = WINOGRAD_TILE_AREA * OutC * InC;
+    if (num_layers == WINOGRAD_MAX_LAYERS || weight_pool_used + size > WINOGRAD_WEIGHT_POOL_SIZE) {
+        return 0;
+    }
+
+    float* U = weight_pool + weight_pool_used;
+    weight_pool_used += size;
+    for (int oc = 0; oc < OutC; ++oc) {
+        for (int ic = 0; ic < InC; ++ic) {
+            float u[WINOGRAD_TILE_AREA];
+            weight_transform(weights + (oc * InC + ic) * 9, u);
+            for (int p = 0; p < WINOGRAD_TILE_AREA; ++p) {
+                U[(p * OutC + oc) * InC + ic] = u[p];
+            }
+        }
+    }
+
+    WinogradLayer& layer = layers[num_layers++];
+    layer.weights = weights;
+    layer.U = U;
+    layer.InC = InC;
+    layer.OutC = OutC;
+    layer.use_winograd = winograd_within_tolerance(layer);
+    return &layer;
+}
+
+//--------------------------------------------------------------------------
+// Winograd F(4x4,3x3) Convolution (stride 1, pad 1)
+//--------------------------------------------------------------------------
+bool winograd_conv3x3(
+    const float input[], const float weights[], const float biases[], float output[],
+    int H, int W, int InC, int OutC, bool apply_relu)
+{
+    if (!winograd_enabled || InC > WINOGRAD_MAX_IN_C || OutC > WINOGRAD_MAX_OUT_C) {
+        return false;
+    }
+    const WinogradLayer* layer = winograd_prepare(weights, InC, OutC);
+    if (!layer || !layer->use_winograd) {
+        return false;
+    }
+    const float* U = layer->U;
+
+    const int tiles_w = (W + WINOGRAD_M - 1) / WINOGRAD_M;
+    const int tiles_h = (H + WINOGRAD_M - 1) / WINOGRAD_M;
+    const int num_tiles = tiles_h * tiles_w;
+    const int num_batches = (num_tiles + WINOGRAD_TILE_BATCH - 1) / WINOGRAD_TILE_BATCH;
+
+    // Tile batches are independent work items; V and Mt are per thread
+    parallel_for(num_batches, (double)WINOGRAD_TILE_AREA * OutC * InC * WINOGRAD_TILE_BATCH,
+                 [&](int batch_begin, int batch_end) {
+        WinogradScratch& scratch = winograd_scratch();
+        float* V = scratch.V;
+        float* Mt = scratch.Mt;
+
+        for (int tb = batch_begin; tb < batch_end; ++tb) {
+            int t0 = tb * WINOGRAD_TILE_BATCH;
+            int nt = std::min(WINOGRAD_TILE_BATCH, num_tiles - t0);
+
+            // 1. Input transform: V[p][ic][t] = (B^T d B)[p] for every tile in the batch
+            for (int ic = 0; ic < InC; ++ic) {
+                const float* plane = input + ic * H * W;
+                for (int t = 0; t < WINOGRAD_TILE_BATCH; ++t) {
+                    float d[WINOGRAD_TILE_AREA] = {};
+                    float v[WINOGRAD_TILE_AREA];
+                    if (t < nt) {
+                        int ih0 = ((t0 + t) / tiles_w) * WINOGRAD_M - 1; // pad = 1
+                        int iw0 = ((t0 + t) % tiles_w) * WINOGRAD_M - 1;
+                        for (int i = 0; i < WINOGRAD_T; ++i) {
+                            int ih = ih0 + i;
+                            if (ih < 0 || ih >= H) continue;
+                            for (int j = 0; j < WINOGRAD_T; ++j) {
+                                int iw = iw0 + j;
+                                if (iw >= 0 && iw < W) {
+                                    d[i * WINOGRAD_T + j] = plane[ih * W + iw];
+                                }
+                            }
+                        }
+                    }
+                    input_transform(d, v);
+                    for (int p = 0; p < WINOGRAD_TILE_AREA; ++p) {
+                        V[(p * InC + ic) * WINOGRAD_TILE_BATCH + t] = v[p];
+                    }
+                }
+            }
+
+            // 2. Element-wise stage: 36 independent (OutC x InC) * (InC x TB) products
+            for (int p = 0; p < WINOGRAD_TILE_AREA; ++p) {
+                const float* Up = U + p * OutC * InC;
+                const float* Vp = V + p * InC * WINOGRAD_TILE_BATCH;
+                for (int oc = 0; oc < OutC; ++oc) {
+                    float acc[WINOGRAD_TILE_BATCH] = {};
+                    for (int ic = 0; ic < InC; ++ic) {
+                        float u = Up[oc * InC + ic];
+                        const float* v = Vp + ic * WINOGRAD_TILE_BATCH;
+                        for (int t = 0; t < WINOGRAD_TILE_BATCH; ++t) {
+                            acc[t] += u * v[t];
+                        }
+                    }
+                    float* m = Mt + (p * OutC + oc) * WINOGRAD_TILE_BATCH;
+                    for (int t = 0; t < WINOGRAD_TILE_BATCH; ++t) {
+                        m[t] = acc[t];
+                    }
+                }
+            }
+
+            // 3. Output transform, bias, ReLU and store of the valid part of each tile
+            for (int oc = 0; oc < OutC; ++oc) {
+                float* plane = output + oc * H * W;
+                for (int t = 0; t < nt; ++t) {
+                    float m[WINOGRAD_TILE_AREA];
+                    float y[WINOGRAD_M * WINOGRAD_M];
+                    for (int p = 0; p < WINOGRAD_TILE_AREA; ++p) {
+                        m[p] = Mt[(p * OutC + oc) * WINOGRAD_TILE_BATCH + t];
+                    }
+                    output_transform(m, y);
+
+                    int oh0 = ((t0 + t) / tiles_w) * WINOGRAD_M;
+                    int ow0 = ((t0 + t) % tiles_w) * WINOGRAD_M;
+                    int mh = std::min(WINOGRAD_M, H - oh0);
+                    int mw = std::min(WINOGRAD_M, W - ow0);
+                    for (int i = 0; i < mh; ++i) {
+                        for (int j = 0; j < mw; ++j) {
+                            float v = y[i * WINOGRAD_M + j] + biases[oc];
+                            if (apply_relu && v < 0.0f) {
+                                v = 0.0f;
+                            }
+                            plane[(oh0 + i) * W + ow0 + j] = v;
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return true;
+}
+
+#endif // __SYNTHESIS__
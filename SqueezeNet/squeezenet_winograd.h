@@ -0,0 +1,50 @@
+#ifndef SQUEEZENET_WINOGRAD_H
+#define SQUEEZENET_WINOGRAD_H
+
+#include "squeezenet_params.h"
+
+// ==========================================================================
+// === Winograd F(4x4,3x3) for Fire Expand 3x3 Layers (Host Builds Only) ===
+// ==========================================================================
+// Each 4x4 output tile is computed from a 6x6 input tile with 36 multiplies
+// per (input, output) channel pair instead of 144 (4x fewer). Weights are
+// transformed once per layer (U = G g G^T) and cached by weight pointer.
+// When a layer is first seen, its Winograd output is compared against the
+// direct 3x3 convolution on a probe tile; if the relative error exceeds
+// WINOGRAD_TOLERANCE the layer is marked to use direct convolution instead.
+// ==========================================================================
+
+#define WINOGRAD_M 4               // Output tile size (m in F(m x m, 3x3))
+#define WINOGRAD_T 6               // Input tile size (m + 3 - 1)
+#define WINOGRAD_TILE_BATCH 16     // Tiles transformed/multiplied together
+#define WINOGRAD_TOLERANCE 1e-3f   // Max error relative to the probe output magnitude
+#define WINOGRAD_MAX_LAYERS 8      // Fire2 ... Fire9
+
+// Transformed weights for every fire expand3x3 layer: 36 * E3x3 * S1x1 each
+#define WINOGRAD_WEIGHT_POOL_SIZE (WINOGRAD_T * WINOGRAD_T * ( \
+    FIRE2_E3x3 * FIRE2_S1x1 + FIRE3_E3x3 * FIRE3_S1x1 + \
+    FIRE4_E3x3 * FIRE4_S1x1 + FIRE5_E3x3 * FIRE5_S1x1 + \
+    FIRE6_E3x3 * FIRE6_S1x1 + FIRE7_E3x3 * FIRE7_S1x1 + \
+    FIRE8_E3x3 * FIRE8_S1x1 + FIRE9_E3x3 * FIRE9_S1x1))
+
+// Largest squeeze/expand3x3 channel counts (Fire8/9)
+#define WINOGRAD_MAX_IN_C 64
+#define WINOGRAD_MAX_OUT_C 256
+
+// Enable/disable the Winograd path (enabled by default)
+void set_winograd_enabled(bool enabled);
+
+// 3x3, stride 1, pad 1 convolution via Winograd F(4x4,3x3).
+// Returns false (and writes nothing) if the layer must use direct convolution:
+// Winograd disabled, shape out of range, weight pool full, or tolerance check failed.
+bool winograd_conv3x3(
+    const float input[],         // Input feature map (flattened: InC, H, W)
+    const float weights[],       // Kernel weights (flattened: OutC, InC, 3, 3)
+    const float biases[],        // Kernel biases (size: OutC)
+    float output[],              // Output feature map (flattened: OutC, H, W)
+    int H, int W,                // Spatial dims (same for input and output)
+    int InC, int OutC,           // Channel counts
+    bool apply_relu              // Flag to apply ReLU activation
+);
+
+#endif // SQUEEZENET_WINOGRAD_H
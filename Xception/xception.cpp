@@ -1,5 +1,12 @@
 #include "xception.h"
-#include <cfloat> // For FLT_MIN in max_pooling
+#include "xception_calibration.h"
+#include "xception_fixed.h"
+#include "xception_gemm.h"
+#include "xception_half.h"
+#include "xception_simd.h"
+#include "xception_threads.h"
+#include "xception_typed.h"
+#include <cstring> // For memcpy in the middle flow
 
 //--------------------------------------------------------------------------
 // Standard Convolution (Same as SqueezeNet, check padding impl.)
@@ -9,36 +16,28 @@ void convolution(
     int InH, int InW, int InC, int OutH, int OutW, int OutC,
     int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu)
 {
-    // Output Feature Map (OFM) Loops
-    OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
-        OUT_H_LOOP: for (int oh = 0; oh < OutH; ++oh) {
-            OUT_W_LOOP: for (int ow = 0; ow < OutW; ++ow) {
-#pragma HLS PIPELINE II=1
-
-                float sum = biases ? biases[oc] : 0.0f; // Initialize with bias if provided
-
-                // Kernel Loops
-                IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
-                    KERNEL_H_LOOP: for (int kh = 0; kh < KH; ++kh) {
-                        KERNEL_W_LOOP: for (int kw = 0; kw < KW; ++kw) {
-                            int ih = oh * StrideH + kh - PadH;
-                            int iw = ow * StrideW + kw - PadW;
-
-                            // Check bounds (for padding)
-                            if (ih >= 0 && ih < InH && iw >= 0 && iw < InW) {
-                                int input_idx = ic * InH * InW + ih * InW + iw;
-                                int weight_idx = oc * (InC * KH * KW) + ic * (KH * KW) + kh * KW + kw;
-                                sum += input[input_idx] * weights[weight_idx];
-                            }
-                        }
-                    }
-                }
-                float result = apply_relu ? relu_activation(sum) : sum;
-                int output_idx = oc * OutH * OutW + oh * OutW + ow;
-                output[output_idx] = result;
-            }
-        }
+#ifndef __SYNTHESIS__
+    // Host builds: 1x1 layers go to the pointwise engine, other large layers
+    // to the im2col + blocked SGEMM backend
+    ConvBackend backend = conv_select_backend(InC, OutH, OutW, OutC, KH, KW,
+                                              StrideH, StrideW, PadH, PadW);
+    if (backend == CONV_BACKEND_POINTWISE) {
+        pointwise_convolution(input, weights, biases, output,
+                              OutH * OutW, InC, OutC, apply_relu);
+        return;
     }
+    if (backend == CONV_BACKEND_GEMM) {
+        convolution_gemm(input, weights, biases, output,
+                         InH, InW, InC, OutH, OutW, OutC,
+                         KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
+        return;
+    }
+#endif
+
+    // Direct loop nest (xception_typed.h)
+    convolution<float, float>(input, weights, biases, output,
+                              InH, InW, InC, OutH, OutW, OutC,
+                              KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
 }
 
 //--------------------------------------------------------------------------
@@ -53,34 +52,19 @@ void depthwise_convolution(
     int PadH, int PadW,         // Padding ('same' usually means P=(K-1)/2)
     bool apply_relu)
 {
-    DW_C_LOOP: for (int c = 0; c < C; ++c) { // Loop over channels (input and output)
-        DW_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
-            DW_OW_LOOP: for (int ow = 0; ow < OutW; ++ow) {
-#pragma HLS PIPELINE II=1
-
-                float sum = biases ? biases[c] : 0.0f; // Use bias for this channel if provided
-
-                DW_KH_LOOP: for (int kh = 0; kh < KH; ++kh) {
-                    DW_KW_LOOP: for (int kw = 0; kw < KW; ++kw) {
-                        int ih = oh * StrideH + kh - PadH;
-                        int iw = ow * StrideW + kw - PadW;
-
-                        // Check bounds for padding
-                        if (ih >= 0 && ih < InH && iw >= 0 && iw < InW) {
-                            int input_idx = c * InH * InW + ih * InW + iw;
-                            // Depthwise weight index: Channel * KernelH * KernelW + KernelRow * KernelW + KernelCol
-                            // Assumes weights are [C, 1, KH, KW] flattened
-                            int weight_idx = c * (KH * KW) + kh * KW + kw;
-                            sum += input[input_idx] * weights[weight_idx];
-                        }
-                    }
-                }
-                float result = apply_relu ? relu_activation(sum) : sum;
-                int output_idx = c * OutH * OutW + oh * OutW + ow;
-                output[output_idx] = result;
-            }
-        }
+#ifndef __SYNTHESIS__
+    // Host builds: row-wise AVX2/AVX-512 kernel for the stride-1 layers
+    if (simd_kernels().level != SIMD_SCALAR && StrideW == 1) {
+        depthwise_convolution_simd(input, weights, biases, output,
+                                   InH, InW, C, OutH, OutW,
+                                   KH, KW, StrideH, PadH, PadW, apply_relu);
+        return;
     }
+#endif
+
+    depthwise_convolution<float, float>(input, weights, biases, output,
+                                        InH, InW, C, OutH, OutW,
+                                        KH, KW, StrideH, StrideW, PadH, PadW, apply_relu);
 }
 
 //--------------------------------------------------------------------------
@@ -119,28 +103,17 @@ void max_pooling(
     int InH, int InW, int InC, int OutH, int OutW,
     int KH, int KW, int StrideH, int StrideW)
 {
-    POOL_C_LOOP: for (int c = 0; c < InC; ++c) {
-        POOL_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
-            POOL_OW_LOOP: for (int ow = 0; ow < OutW; ++ow) {
-#pragma HLS PIPELINE II=1
-                float max_val = -FLT_MAX;
-                POOL_KH_LOOP: for (int kh = 0; kh < KH; ++kh) {
-                    POOL_KW_LOOP: for (int kw = 0; kw < KW; ++kw) {
-                        int ih = oh * StrideH + kh;
-                        int iw = ow * StrideW + kw;
-                        if (ih < InH && iw < InW) {
-                            int input_idx = c * InH * InW + ih * InW + iw;
-                            if (input[input_idx] > max_val) {
-                                max_val = input[input_idx];
-                            }
-                        }
-                    }
-                }
-                int output_idx = c * OutH * OutW + oh * OutW + ow;
-                output[output_idx] = max_val;
-            }
-        }
+#ifndef __SYNTHESIS__
+    // Host builds: vectorized row-max kernel when AVX2/AVX-512 is available
+    if (simd_kernels().level != SIMD_SCALAR && InW <= SIMD_MAX_ROW_WIDTH) {
+        max_pooling_simd(input, output, InH, InW, InC, OutH, OutW,
+                         KH, KW, StrideH, StrideW);
+        return;
     }
+#endif
+
+    max_pooling<float>(input, output, InH, InW, InC, OutH, OutW,
+                       KH, KW, StrideH, StrideW);
 }
 
 //--------------------------------------------------------------------------
@@ -149,17 +122,14 @@ void max_pooling(
 void global_average_pooling(
     const float input[], float output[], int InH, int InW, int InC)
 {
-    GAP_C_LOOP: for (int c = 0; c < InC; ++c) {
-#pragma HLS PIPELINE II=1
-        float sum = 0.0f;
-        GAP_H_LOOP: for (int h = 0; h < InH; ++h) {
-            GAP_W_LOOP: for (int w = 0; w < InW; ++w) {
-                int input_idx = c * InH * InW + h * InW + w;
-                sum += input[input_idx];
-            }
-        }
-        output[c] = sum / (float)(InH * InW);
+#ifndef __SYNTHESIS__
+    if (simd_kernels().level != SIMD_SCALAR) {
+        global_average_pooling_simd(input, output, InH, InW, InC);
+        return;
     }
+#endif
+
+    global_average_pooling<float, float>(input, output, InH, InW, InC);
 }
 
 //--------------------------------------------------------------------------
@@ -167,12 +137,99 @@ void global_average_pooling(
 //--------------------------------------------------------------------------
 void add_arrays(const float a[], const float b[], float result[], int size) {
 #pragma HLS INLINE // Suggest inlining this simple operation
-    ADD_LOOP: for (int i = 0; i < size; ++i) {
-#pragma HLS PIPELINE II=1
-        result[i] = a[i] + b[i];
+#ifndef __SYNTHESIS__
+    if (simd_kernels().level != SIMD_SCALAR) {
+        add_arrays_simd(a, b, result, size);
+        return;
     }
+#endif
+    add_arrays<float>(a, b, result, size);
 }
 
+//--------------------------------------------------------------------------
+// Entry Flow Block 1 Paths
+//--------------------------------------------------------------------------
+// Residual Path (Conv 1x1, S=2) -> res
+static void entry_block1_residual(const float in[], float res[]) {
+    convolution_fixed<CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_SEP2_C_OUT, 1, 2, 0>( // Output matches final block output dims
+        in, entry_b1_res_conv_weights, entry_b1_res_conv_biases, res,
+        false); // No ReLU on residual path conv
+    CALIBRATION_OBSERVE("block1/residual", res, B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT);
+}
+
+// Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2) -> out1
+static void entry_block1_main(const float in[], float out1[], float out2[], float sep_dw[]) {
+    // SepConv1 (S=1, P='same') -> ReLU
+    separable_conv_block_fixed<CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_SEP1_C_OUT, 3, 1, 1>( // DW K=3, S=1, P='same'
+        in, out1,                                                   // Input buf_conv2, Output buf_block_out1
+        entry_b1_sep1_dw_weights, NULL, false,                      // DW: No Bias, No ReLU before PW usually
+        entry_b1_sep1_pw_weights, entry_b1_sep1_pw_biases, true,    // PW: Bias, ReLU
+        sep_dw);                                                    // Temp DW buffer
+    CALIBRATION_OBSERVE("block1/sep1/depthwise", sep_dw, CONV2_H_OUT * CONV2_W_OUT * CONV2_C_OUT);
+    CALIBRATION_OBSERVE("block1/sep1", out1, CONV2_H_OUT * CONV2_W_OUT * B1_SEP1_C_OUT);
+
+    // SepConv2 (S=1, P='same') -> No ReLU before Add
+    separable_conv_block_fixed<CONV2_H_OUT, CONV2_W_OUT, B1_SEP1_C_OUT, B1_SEP2_C_OUT, 3, 1, 1>(
+        out1, out2,                                                 // Input buf_block_out1, Output buf_block_out2
+        entry_b1_sep2_dw_weights, NULL, false,                      // DW
+        entry_b1_sep2_pw_weights, entry_b1_sep2_pw_biases, false,   // PW: No ReLU before pool/add
+        sep_dw);                                                    // Temp DW buffer
+    CALIBRATION_OBSERVE("block1/sep2/depthwise", sep_dw, CONV2_H_OUT * CONV2_W_OUT * B1_SEP1_C_OUT);
+    CALIBRATION_OBSERVE("block1/sep2", out2, CONV2_H_OUT * CONV2_W_OUT * B1_SEP2_C_OUT);
+
+    // MaxPool (S=2)
+    max_pooling(out2, out1, // Input buf_block_out2, Output buf_block_out1 (reuse)
+                CONV2_H_OUT, CONV2_W_OUT, B1_SEP2_C_OUT,
+                B1_POOL_H_OUT, B1_POOL_W_OUT,
+                3, 3, 2, 2); // K=3, S=2
+    CALIBRATION_OBSERVE("block1/pool", out1, B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT);
+}
+
+// Multiply-adds of both paths (for the branch cost model)
+#define ENTRY_BLOCK1_COST ((double)B1_POOL_H_OUT * B1_POOL_W_OUT * CONV2_C_OUT * B1_SEP2_C_OUT + \
+    (double)CONV2_H_OUT * CONV2_W_OUT * (CONV2_C_OUT * (9 + B1_SEP1_C_OUT) + B1_SEP1_C_OUT * (9 + B1_SEP2_C_OUT)))
+
+//--------------------------------------------------------------------------
+// Exit Flow Block 12 Paths (same structure as block 1, on the middle-flow output)
+//--------------------------------------------------------------------------
+// Residual Path (Conv 1x1, S=2) -> res
+static void exit_block12_residual(const float in[], float res[]) {
+    convolution_fixed<MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_SEP2_C_OUT, 1, 2, 0>(
+        in, exit_b12_res_conv_weights, exit_b12_res_conv_biases, res,
+        false); // No ReLU on residual path conv
+    CALIBRATION_OBSERVE("block12/residual", res, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
+}
+
+// Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2) -> out1
+static void exit_block12_main(const float in[], float out1[], float out2[], float sep_dw[]) {
+    // SepConv1 (S=1, P='same') -> ReLU
+    separable_conv_block_fixed<MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_SEP1_C_OUT, 3, 1, 1>(
+        in, out1,
+        exit_b12_sep1_dw_weights, NULL, false,
+        exit_b12_sep1_pw_weights, exit_b12_sep1_pw_biases, true,
+        sep_dw);
+    CALIBRATION_OBSERVE("block12/sep1/depthwise", sep_dw, BUF_MIDDLE_SIZE);
+    CALIBRATION_OBSERVE("block12/sep1", out1, MIDDLE_H * MIDDLE_W * B5_SEP1_C_OUT);
+
+    // SepConv2 (S=1, P='same') -> No ReLU before Add
+    separable_conv_block_fixed<MIDDLE_H, MIDDLE_W, B5_SEP1_C_OUT, B5_SEP2_C_OUT, 3, 1, 1>(
+        out1, out2,
+        exit_b12_sep2_dw_weights, NULL, false,
+        exit_b12_sep2_pw_weights, exit_b12_sep2_pw_biases, false,
+        sep_dw);
+    CALIBRATION_OBSERVE("block12/sep2/depthwise", sep_dw, MIDDLE_H * MIDDLE_W * B5_SEP1_C_OUT);
+    CALIBRATION_OBSERVE("block12/sep2", out2, MIDDLE_H * MIDDLE_W * B5_SEP2_C_OUT);
+
+    // MaxPool (S=2): 19 -> 10, the last window clipped at the edge
+    max_pooling(out2, out1,
+                MIDDLE_H, MIDDLE_W, B5_SEP2_C_OUT,
+                B5_POOL_H_OUT, B5_POOL_W_OUT,
+                3, 3, 2, 2); // K=3, S=2
+    CALIBRATION_OBSERVE("block12/pool", out1, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
+}
+
+#define EXIT_BLOCK12_COST ((double)B5_POOL_H_OUT * B5_POOL_W_OUT * MIDDLE_C * B5_SEP2_C_OUT + \
+    (double)MIDDLE_H * MIDDLE_W * (MIDDLE_C * (9 + B5_SEP1_C_OUT) + B5_SEP1_C_OUT * (9 + B5_SEP2_C_OUT)))
 
 //--------------------------------------------------------------------------
 // Top-level Xception Function Implementation
@@ -187,71 +244,100 @@ void Xception(
     #pragma HLS INTERFACE s_axilite port=return        bundle=control
     // Add other ports to s_axilite if needed for control/debugging
 
-    // --- Intermediate Buffers (Static Allocation) ---
-    // Use sizes from xception_params.h. Ping-pong buffering might save memory
-    // but adds complexity. Using dedicated named buffers for clarity.
-    // Ensure these buffers are large enough based on the *verified* dimensions.
-    static float buf_conv1[BUF_CONV1_SIZE];
-    static float buf_conv2[BUF_CONV2_SIZE];
-    // Buffers for blocks (reuse where possible if sizes match, otherwise unique)
-    static float buf_block_in[BUF_MIDDLE_SIZE]; // To hold input for residual adds
-    static float buf_block_out1[BUF_MIDDLE_SIZE];
-    static float buf_block_out2[BUF_MIDDLE_SIZE]; // Need two if ping-ponging
-    // Intermediate buffer for depthwise stage within separable conv
-    static float buf_sep_dw[MAX_SEP_DW_SIZE];
-    // Buffer for residual path convolutions
-    static float buf_res_conv[BUF_MIDDLE_SIZE];
-    // Buffer for final stages
-    static float buf_final_block[BUF_EXIT_MAX_SIZE];
-    static float buf_gap[GAP_OUT_SIZE];
+    // Default context: the same dedicated static buffers as before
+    static InferenceContext default_context;
+    xception_inference(default_context, input_image, output_logits);
+}
 
+//--------------------------------------------------------------------------
+// Reentrant Xception Implementation
+//--------------------------------------------------------------------------
+void xception_inference(
+    InferenceContext& ctx,
+    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+    float output_logits[NUM_CLASSES]
+) {
+#ifndef __SYNTHESIS__
+    // Host builds: 16-bit storage or per-layer precision network when
+    // selected (xception_half.h); calibration sessions always measure the
+    // fp32 layers
+    if (inference_precision() == PRECISION_MIXED && !calibration_active()) {
+        xception_mixed(ctx, precision_policy(), input_image, output_logits);
+        return;
+    }
+    if (inference_precision() != PRECISION_FP32 && !calibration_active()) {
+        xception_half(ctx, input_image, output_logits,
+                      (inference_precision() == PRECISION_FP16) ? HALF_FP16 : HALF_BF16);
+        return;
+    }
+#endif
+
+    // --- Intermediate Buffers (from the context) ---
+    // Dedicated named buffers sized from xception_params.h; the stage code
+    // below only sees these pointers.
+    float* buf_conv1 = ctx.buf_conv1;
+    float* buf_conv2 = ctx.buf_conv2;
+    float* buf_block_in = ctx.buf_block_in;
+    float* buf_block_out1 = ctx.buf_block_out1;
+    float* buf_block_out2 = ctx.buf_block_out2;
+    float* buf_sep_dw = ctx.buf_sep_dw;
+    float* buf_res_conv = ctx.buf_res_conv;
+    float* buf_final_block = ctx.buf_final_block;
+    float* buf_gap = ctx.buf_gap;
+
+    // --- Compile-Time Shape Checks ---
+    // params.h output sizes must agree with the kernels, and every stage must
+    // fit the buffer it is written to
+    static_assert(conv_out_dim(INPUT_H, 3, 2, 1) == CONV1_H_OUT &&
+                  conv_out_dim(INPUT_W, 3, 2, 1) == CONV1_W_OUT, "conv1 shape");
+    static_assert(conv_out_dim(CONV1_H_OUT, 3, 1, 1) == CONV2_H_OUT &&
+                  conv_out_dim(CONV1_W_OUT, 3, 1, 1) == CONV2_W_OUT, "conv2 shape");
+    static_assert(conv_out_dim(CONV2_H_OUT, 1, 2, 0) == B1_POOL_H_OUT &&
+                  conv_out_dim(CONV2_W_OUT, 1, 2, 0) == B1_POOL_W_OUT, "block 1 residual shape");
+    static_assert(CONV2_H_OUT * CONV2_W_OUT * B1_SEP1_C_OUT <= BUF_BLOCK_MAX_SIZE &&
+                  CONV2_H_OUT * CONV2_W_OUT * B1_SEP2_C_OUT <= BUF_BLOCK_MAX_SIZE, "block 1 sep conv buffers");
+    static_assert(B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT <= BUF_RESIDUAL_MAX_SIZE, "block 1 residual buffers");
+    static_assert(BUF_MIDDLE_SIZE <= BUF_RESIDUAL_MAX_SIZE && BUF_MIDDLE_SIZE <= BUF_BLOCK_MAX_SIZE, "middle flow buffers");
+    static_assert(conv_out_dim(MIDDLE_H, 1, 2, 0) == B5_POOL_H_OUT &&
+                  conv_out_dim(MIDDLE_W, 1, 2, 0) == B5_POOL_W_OUT, "block 12 residual shape");
+    static_assert(MIDDLE_H * MIDDLE_W * B5_SEP2_C_OUT <= BUF_BLOCK_MAX_SIZE &&
+                  B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT <= BUF_RESIDUAL_MAX_SIZE &&
+                  B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT <= BUF_EXIT_MAX_SIZE, "block 12 buffers");
+    static_assert(B6_H_OUT * B6_W_OUT * B6_SEP1_C_OUT <= BUF_BLOCK_MAX_SIZE, "block 13 sep conv1 buffer");
+
+
+    // Calibration hooks (xception_calibration.h) follow each layer; they
+    // return at once outside a calibration session and vanish in HLS
+    CALIBRATION_OBSERVE("input", input_image, INPUT_H * INPUT_W * INPUT_C);
 
     // === Entry Flow ===
     // Conv1: 3x3, S=2
-    convolution(input_image, entry_conv1_weights, entry_conv1_biases, buf_conv1,
-                INPUT_H, INPUT_W, INPUT_C, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
-                3, 3, 2, 2, 1, 1, true); // Assume P=1 for 'same'ish with S=2
+    convolution_fixed<INPUT_H, INPUT_W, INPUT_C, CONV1_C_OUT, 3, 2, 1>( // Assume P=1 for 'same'ish with S=2
+        input_image, entry_conv1_weights, entry_conv1_biases, buf_conv1, true);
+    CALIBRATION_OBSERVE("conv1", buf_conv1, CONV1_H_OUT * CONV1_W_OUT * CONV1_C_OUT);
 
     // Conv2: 3x3, S=1
-    convolution(buf_conv1, entry_conv2_weights, entry_conv2_biases, buf_conv2,
-                CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT, CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT,
-                3, 3, 1, 1, 1, 1, true); // Assume P=1 for 'same' with S=1
+    convolution_fixed<CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT, CONV2_C_OUT, 3, 1, 1>( // Assume P=1 for 'same' with S=1
+        buf_conv1, entry_conv2_weights, entry_conv2_biases, buf_conv2, true);
+    CALIBRATION_OBSERVE("conv2", buf_conv2, CONV2_H_OUT * CONV2_W_OUT * CONV2_C_OUT);
 
 
     // --- Block 1 ---
-    // Residual Path (Conv 1x1, S=2)
-    convolution(buf_conv2, entry_b1_res_conv_weights, entry_b1_res_conv_biases, buf_res_conv,
-                 CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_POOL_H_OUT, B1_POOL_W_OUT, B1_SEP2_C_OUT, // Output matches final block output dims
-                 1, 1, 2, 2, 0, 0, false); // No ReLU on residual path conv
-
-    // Main Path - SepConv1 (S=1, P='same') -> ReLU
-    separable_conv_block(buf_conv2, buf_block_out1, // Input buf_conv2, Output buf_block_out1
-                         CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT,             // Input dims
-                         CONV2_H_OUT, CONV2_W_OUT,                           // DW Out Dims (S=1, P='same')
-                         CONV2_H_OUT, CONV2_W_OUT, B1_SEP1_C_OUT,           // PW Out Dims (final C)
-                         3, 3, 1, 1, 1, 1,                                  // DW Params K=3, S=1, P=1
-                         entry_b1_sep1_dw_weights, NULL, false,             // DW: No Bias, No ReLU before PW usually
-                         entry_b1_sep1_pw_weights, entry_b1_sep1_pw_biases, true, // PW: Bias, ReLU
-                         buf_sep_dw);                                        // Temp DW buffer
-
-    // Main Path - SepConv2 (S=1, P='same') -> No ReLU before Add
-     separable_conv_block(buf_block_out1, buf_block_out2, // Input buf_block_out1, Output buf_block_out2
-                          CONV2_H_OUT, CONV2_W_OUT, B1_SEP1_C_OUT,            // Input dims
-                          CONV2_H_OUT, CONV2_W_OUT,                           // DW Out Dims
-                          CONV2_H_OUT, CONV2_W_OUT, B1_SEP2_C_OUT,           // PW Out Dims
-                          3, 3, 1, 1, 1, 1,                                  // DW Params
-                          entry_b1_sep2_dw_weights, NULL, false,             // DW
-                          entry_b1_sep2_pw_weights, entry_b1_sep2_pw_biases, false,// PW: No ReLU before pool/add
-                          buf_sep_dw);                                        // Temp DW buffer
-
-    // Main Path - MaxPool (S=2)
-    max_pooling(buf_block_out2, buf_block_out1, // Input buf_block_out2, Output buf_block_out1 (reuse)
-                CONV2_H_OUT, CONV2_W_OUT, B1_SEP2_C_OUT,
-                B1_POOL_H_OUT, B1_POOL_W_OUT,
-                3, 3, 2, 2); // K=3, S=2
+    // The residual and main paths both read buf_conv2 and write disjoint
+    // buffers, so host builds run them as concurrent branches
+#ifndef __SYNTHESIS__
+    parallel_branches(ENTRY_BLOCK1_COST, {
+        [&] { entry_block1_residual(buf_conv2, buf_res_conv); },
+        [&] { entry_block1_main(buf_conv2, buf_block_out1, buf_block_out2, buf_sep_dw); }
+    });
+#else
+    entry_block1_residual(buf_conv2, buf_res_conv);
+    entry_block1_main(buf_conv2, buf_block_out1, buf_block_out2, buf_sep_dw);
+#endif
 
     // Add Residual
     add_arrays(buf_block_out1, buf_res_conv, buf_block_in, B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT);
+    CALIBRATION_OBSERVE("block1", buf_block_in, B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT);
     // Result is now in buf_block_in, which becomes input for Block 2
 
 
@@ -293,87 +379,96 @@ void Xception(
         // Note: Original Xception applies ReLU *before* the first SepConv in middle blocks.
 
         // SepConv 1 (ReLU -> SepConv)
-        separable_conv_block(buf_block_in, buf_block_out1,
-                             MIDDLE_H, MIDDLE_W, MIDDLE_C, // Input
-                             MIDDLE_H, MIDDLE_W,           // DW Out Dims
-                             MIDDLE_H, MIDDLE_W, MIDDLE_C, // PW Out Dims
-                             3, 3, 1, 1, 1, 1,             // DW Params
-                             middle_b4_sep1_dw_weights, NULL, true, // DW: Apply ReLU *before* or *after*? Paper implies after. Check ref impl. Let's assume after DW.
-                             middle_b4_sep1_pw_weights, middle_b4_sep1_pw_biases, true, // PW: Apply ReLU after PW
-                             buf_sep_dw);
+        separable_conv_block_fixed<MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C, 3, 1, 1>(
+            buf_block_in, buf_block_out1,
+            middle_b4_sep1_dw_weights, NULL, true, // DW: Apply ReLU *before* or *after*? Paper implies after. Check ref impl. Let's assume after DW.
+            middle_b4_sep1_pw_weights, middle_b4_sep1_pw_biases, true, // PW: Apply ReLU after PW
+            buf_sep_dw);
                              // Use weights middle_b[4+i]_...
+        CALIBRATION_OBSERVE("middle/sep1/depthwise", buf_sep_dw, BUF_MIDDLE_SIZE);
+        CALIBRATION_OBSERVE("middle/sep1", buf_block_out1, BUF_MIDDLE_SIZE);
 
         // SepConv 2 (ReLU -> SepConv)
-        separable_conv_block(buf_block_out1, buf_block_out2,
-                             MIDDLE_H, MIDDLE_W, MIDDLE_C, // Input
-                             MIDDLE_H, MIDDLE_W,           // DW Out Dims
-                             MIDDLE_H, MIDDLE_W, MIDDLE_C, // PW Out Dims
-                             3, 3, 1, 1, 1, 1,             // DW Params
-                             middle_b4_sep2_dw_weights, NULL, true, // DW ReLU
-                             middle_b4_sep2_pw_weights, middle_b4_sep2_pw_biases, true, // PW ReLU
-                             buf_sep_dw);
+        separable_conv_block_fixed<MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C, 3, 1, 1>(
+            buf_block_out1, buf_block_out2,
+            middle_b4_sep2_dw_weights, NULL, true, // DW ReLU
+            middle_b4_sep2_pw_weights, middle_b4_sep2_pw_biases, true, // PW ReLU
+            buf_sep_dw);
                               // Use weights middle_b[4+i]_...
+        CALIBRATION_OBSERVE("middle/sep2/depthwise", buf_sep_dw, BUF_MIDDLE_SIZE);
+        CALIBRATION_OBSERVE("middle/sep2", buf_block_out2, BUF_MIDDLE_SIZE);
 
         // SepConv 3 (ReLU -> SepConv) -> NO ReLU before ADD
-         separable_conv_block(buf_block_out2, buf_block_out1, // Output to buf_block_out1 (reuse)
-                              MIDDLE_H, MIDDLE_W, MIDDLE_C, // Input
-                              MIDDLE_H, MIDDLE_W,           // DW Out Dims
-                              MIDDLE_H, MIDDLE_W, MIDDLE_C, // PW Out Dims
-                              3, 3, 1, 1, 1, 1,             // DW Params
-                              middle_b4_sep3_dw_weights, NULL, true,  // DW ReLU
-                              middle_b4_sep3_pw_weights, middle_b4_sep3_pw_biases, false,// PW NO ReLU before add
-                              buf_sep_dw);
+        separable_conv_block_fixed<MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C, 3, 1, 1>(
+            buf_block_out2, buf_block_out1, // Output to buf_block_out1 (reuse)
+            middle_b4_sep3_dw_weights, NULL, true,  // DW ReLU
+            middle_b4_sep3_pw_weights, middle_b4_sep3_pw_biases, false,// PW NO ReLU before add
+            buf_sep_dw);
                                // Use weights middle_b[4+i]_...
+        CALIBRATION_OBSERVE("middle/sep3/depthwise", buf_sep_dw, BUF_MIDDLE_SIZE);
+        CALIBRATION_OBSERVE("middle/sep3", buf_block_out1, BUF_MIDDLE_SIZE);
 
         // Add Residual (Output of SepConv3 + Original Input)
         add_arrays(buf_block_out1, buf_res_conv, buf_block_in, BUF_MIDDLE_SIZE);
+        CALIBRATION_OBSERVE("middle", buf_block_in, BUF_MIDDLE_SIZE);
         // Result for this block is now in buf_block_in, ready for next iteration or Exit Flow
     }
     // After loop, result (19x19x728) is in buf_block_in
 
     // === Exit Flow ===
-    // Block 12 (like Entry Block 3, but different channels)
+    // --- Block 12 ---
     // Residual Path (Conv 1x1, S=2) -> buf_res_conv
     // Main Path: SepConv1 -> ReLU -> buf_block_out1
     //            SepConv2 -> buf_block_out2
     //            MaxPool (S=2) -> buf_block_out1
-    // Add Residual (buf_block_out1 + buf_res_conv) -> buf_final_block (reuse buffer)
-    // ... (Code omitted for brevity, use exit_b12 params and weights) ...
+    // Both read buf_block_in, so host builds run them as concurrent branches
+#ifndef __SYNTHESIS__
+    parallel_branches(EXIT_BLOCK12_COST, {
+        [&] { exit_block12_residual(buf_block_in, buf_res_conv); },
+        [&] { exit_block12_main(buf_block_in, buf_block_out1, buf_block_out2, buf_sep_dw); }
+    });
+#else
+    exit_block12_residual(buf_block_in, buf_res_conv);
+    exit_block12_main(buf_block_in, buf_block_out1, buf_block_out2, buf_sep_dw);
+#endif
+
+    // Add Residual (buf_block_out1 + buf_res_conv) -> buf_final_block
+    add_arrays(buf_block_out1, buf_res_conv, buf_final_block, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
+    CALIBRATION_OBSERVE("block12", buf_final_block, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
     // Output is 10x10x1024
 
 
     // Block 13 (Two Separable Convs, NO residual, NO pool)
     // SepConv1 -> ReLU
-    separable_conv_block(buf_final_block, buf_block_out1, // Input from B12, output intermediate
-                         B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT, // Input dims
-                         B6_H_OUT, B6_W_OUT,           // DW Out Dims (S=1)
-                         B6_H_OUT, B6_W_OUT, B6_SEP1_C_OUT, // PW Out Dims
-                         3, 3, 1, 1, 1, 1,             // DW Params
-                         exit_b13_sep1_dw_weights, NULL, true, // DW ReLU
-                         exit_b13_sep1_pw_weights, exit_b13_sep1_pw_biases, true, // PW ReLU
-                         buf_sep_dw);
+    separable_conv_block_fixed<B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT, B6_SEP1_C_OUT, 3, 1, 1>( // DW S=1
+        buf_final_block, buf_block_out1, // Input from B12, output intermediate
+        exit_b13_sep1_dw_weights, NULL, true, // DW ReLU
+        exit_b13_sep1_pw_weights, exit_b13_sep1_pw_biases, true, // PW ReLU
+        buf_sep_dw);
+    CALIBRATION_OBSERVE("block13/sep1/depthwise", buf_sep_dw, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
+    CALIBRATION_OBSERVE("block13/sep1", buf_block_out1, B6_H_OUT * B6_W_OUT * B6_SEP1_C_OUT);
 
     // SepConv2 -> ReLU
-    separable_conv_block(buf_block_out1, buf_final_block, // Input intermediate, output final block result
-                         B6_H_OUT, B6_W_OUT, B6_SEP1_C_OUT, // Input dims
-                         B6_H_OUT, B6_W_OUT,           // DW Out Dims (S=1)
-                         B6_H_OUT, B6_W_OUT, B6_SEP2_C_OUT, // PW Out Dims
-                         3, 3, 1, 1, 1, 1,             // DW Params
-                         exit_b13_sep2_dw_weights, NULL, true,  // DW ReLU
-                         exit_b13_sep2_pw_weights, exit_b13_sep2_pw_biases, true, // PW ReLU
-                         buf_sep_dw);
+    separable_conv_block_fixed<B6_H_OUT, B6_W_OUT, B6_SEP1_C_OUT, B6_SEP2_C_OUT, 3, 1, 1>( // DW S=1
+        buf_block_out1, buf_final_block, // Input intermediate, output final block result
+        exit_b13_sep2_dw_weights, NULL, true,  // DW ReLU
+        exit_b13_sep2_pw_weights, exit_b13_sep2_pw_biases, true, // PW ReLU
+        buf_sep_dw);
+    CALIBRATION_OBSERVE("block13/sep2/depthwise", buf_sep_dw, B6_H_OUT * B6_W_OUT * B6_SEP1_C_OUT);
+    CALIBRATION_OBSERVE("block13/sep2", buf_final_block, B6_H_OUT * B6_W_OUT * B6_SEP2_C_OUT);
     // Result is in buf_final_block (10x10x2048)
 
     // Global Average Pooling
     global_average_pooling(buf_final_block, buf_gap,
                            B6_H_OUT, B6_W_OUT, B6_SEP2_C_OUT); // Input dims, output size GAP_OUT_SIZE
+    CALIBRATION_OBSERVE("gap", buf_gap, GAP_OUT_SIZE);
 
     // Final Classifier (Fully Connected or Conv 1x1)
     // Using Conv 1x1 here as example
     // Treat GAP output as 1x1 spatial input
-     convolution(buf_gap, final_conv_weights, final_conv_biases, output_logits,
-                 1, 1, GAP_OUT_SIZE,         // Input Dims (1x1 spatial, C=GAP_OUT_SIZE)
-                 1, 1, NUM_CLASSES,        // Output Dims (1x1 spatial, C=NUM_CLASSES)
-                 1, 1, 1, 1, 0, 0, false);    // 1x1 Conv, No ReLU before Softmax
+    convolution_fixed<1, 1, GAP_OUT_SIZE, NUM_CLASSES, 1, 1, 0>( // 1x1 spatial input, C=GAP_OUT_SIZE
+        buf_gap, final_conv_weights, final_conv_biases, output_logits,
+        false); // 1x1 Conv, No ReLU before Softmax
+    CALIBRATION_OBSERVE("logits", output_logits, NUM_CLASSES);
 
 }
\ No newline at end of file
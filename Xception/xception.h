@@ -12,6 +12,21 @@ inline float relu_activation(float x) {
     return (x < 0.0f) ? 0.0f : x;
 }
 
+// Output positions [begin, end) along one axis whose K-tap window (stride S,
+// padding P) lies entirely inside an input of size In. Only outputs outside
+// this range can touch padding (or a window clipped at the edge), so only
+// they need per-tap bounds checks.
+constexpr int window_interior_begin(int Out, int S, int P) {
+    return ((P + S - 1) / S < Out) ? (P + S - 1) / S : Out;
+}
+
+constexpr int window_interior_end(int In, int Out, int K, int S, int P) {
+    return (In + P - K < 0) ? window_interior_begin(Out, S, P) :
+           ((In + P - K) / S + 1 > Out) ? Out :
+           ((In + P - K) / S + 1 < window_interior_begin(Out, S, P)) ? window_interior_begin(Out, S, P) :
+           (In + P - K) / S + 1;
+}
+
 // --- Basic Layers ---
 
 // Standard Convolution (from SqueezeNet, ensure padding handling is robust)
@@ -65,7 +80,33 @@ void separable_conv_block(
 // Consists of: Residual Input -> ReLU -> SepConv -> ReLU -> SepConv -> ReLU -> SepConv -> Add
 // Note: Implement the sequence directly.
 
+// --- Per-Inference State ---
+// Every intermediate buffer of one Xception pass (sizes from xception_params.h).
+// Weights are shared read-only and the host backends keep their packing
+// scratch per thread, so threads running xception_inference() on separate
+// contexts do not interfere. A context is tens of MB: allocate it on the heap
+// (or make it static), never on the stack.
+struct InferenceContext {
+    float buf_conv1[BUF_CONV1_SIZE];
+    float buf_conv2[BUF_CONV2_SIZE];
+    float buf_block_in[BUF_RESIDUAL_MAX_SIZE];  // Input for residual adds
+    float buf_block_out1[BUF_BLOCK_MAX_SIZE];
+    float buf_block_out2[BUF_BLOCK_MAX_SIZE];
+    float buf_sep_dw[MAX_SEP_DW_SIZE];          // Depthwise stage of separable convs
+    float buf_res_conv[BUF_RESIDUAL_MAX_SIZE];  // Residual path convolutions
+    float buf_final_block[BUF_EXIT_MAX_SIZE];
+    float buf_gap[GAP_OUT_SIZE];
+};
+
+// Reentrant Xception on the caller's context
+void xception_inference(
+    InferenceContext& ctx,                                 // Buffers for this call
+    const float input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
+    float output_logits[NUM_CLASSES]                       // Output logits
+);
+
 // --- Top-level Function ---
+// HLS top; runs on a static default context, so it is not reentrant
 void Xception(
     const float input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
     float output_logits[NUM_CLASSES]                       // Output logits
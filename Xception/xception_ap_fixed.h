@@ -0,0 +1,242 @@
+#ifndef XCEPTION_AP_FIXED_H
+#define XCEPTION_AP_FIXED_H
+
+#include <cmath>       // For ldexp, floor, fmod
+#include <cstdint>     // For int64_t
+#include <type_traits> // For conditional, is_integral
+
+// ==========================================================================
+// === Software ap_fixed (Builds Without the Vitis HLS Headers) =============
+// ==========================================================================
+// Header-only stand-in for the signed ap_fixed<W, I, Q, O> of Vitis HLS.
+// xception_types.h uses it when <ap_fixed.h> is not on the include path,
+// so the fixed-point layers build and run under plain g++ and give the bits
+// the Vitis type gives:
+//   - A value is a W-bit two's complement integer V scaled by 2^-(W-I),
+//     kept in the narrowest of int8_t .. int64_t that holds it.
+//   - + and - return the exact result (max(I1,I2)+1 integer bits, max(F1,F2)
+//     fraction bits), * the exact product (W1+W2 bits, I1+I2 integer bits)
+//     and unary - one more integer bit, as the Vitis operators do.
+//   - Storing a value into a type (construction, assignment, +=, -=, *=)
+//     quantizes the dropped fraction bits by Q, then resolves overflow by O.
+//   - Conversion from float/double quantizes the exact binary value.
+// Limits: W <= 64 and 0 <= W-I <= 63, so that every intermediate fits in
+// 128 bits. AP_WRAP_SM, saturation bits (N > 0), ap_ufixed, ap_int and the
+// bit-level methods are not provided; values convert to float/double only
+// through to_float() / to_double().
+// ==========================================================================
+
+// Quantization (rounding) modes, applied to the dropped fraction bits
+enum ap_q_mode {
+    AP_RND,         // Round to nearest, ties towards +infinity
+    AP_RND_ZERO,    // Round to nearest, ties towards zero
+    AP_RND_MIN_INF, // Round to nearest, ties towards -infinity
+    AP_RND_INF,     // Round to nearest, ties away from zero
+    AP_RND_CONV,    // Round to nearest, ties to even
+    AP_TRN,         // Truncate towards -infinity (default)
+    AP_TRN_ZERO     // Truncate towards zero
+};
+
+// Overflow modes, applied to values outside the W-bit range
+enum ap_o_mode {
+    AP_SAT,         // Saturate to the minimum/maximum
+    AP_SAT_ZERO,    // Set to zero
+    AP_SAT_SYM,     // Saturate to +-maximum
+    AP_WRAP,        // Keep the low W bits (default)
+    AP_WRAP_SM      // Sign-magnitude wrap (not supported)
+};
+
+template<int _AP_W, int _AP_I, ap_q_mode _AP_Q = AP_TRN, ap_o_mode _AP_O = AP_WRAP, int _AP_N = 0>
+struct ap_fixed;
+
+namespace ap_fixed_detail {
+
+typedef __int128 wide_t; // Exact intermediates
+
+constexpr int max_int(int a, int b) { return a > b ? a : b; }
+
+inline wide_t pow2(int n) { return (wide_t)1 << n; }
+
+// Whether rounding mode Q moves the floor of a value up by one. vs_half is
+// the sign of (dropped bits - 1/2); exact means nothing was dropped.
+template<ap_q_mode Q>
+inline bool round_up(bool neg, bool exact, int vs_half, bool odd) {
+    switch (Q) {
+    case AP_TRN:         return false;
+    case AP_TRN_ZERO:    return neg && !exact;
+    case AP_RND:         return vs_half >= 0;
+    case AP_RND_ZERO:    return vs_half > 0 || (vs_half == 0 && neg);
+    case AP_RND_MIN_INF: return vs_half > 0;
+    case AP_RND_INF:     return vs_half > 0 || (vs_half == 0 && !neg);
+    default:             return vs_half > 0 || (vs_half == 0 && odd); // AP_RND_CONV
+    }
+}
+
+// Resolve overflow of the integer v into W bits by mode O
+template<int W, ap_o_mode O>
+inline int64_t overflow(wide_t v) {
+    const wide_t hi = pow2(W - 1) - 1;
+    const wide_t lo = -hi - 1;
+    if (v >= lo && v <= hi) return (int64_t)v;
+    switch (O) {
+    case AP_SAT:      return (int64_t)(v > hi ? hi : lo);
+    case AP_SAT_ZERO: return 0;
+    case AP_SAT_SYM:  return (int64_t)(v > hi ? hi : -hi);
+    default: {        // AP_WRAP: the low W bits, sign-extended
+        uint64_t bits = (uint64_t)v;
+        if (W < 64) {
+            const uint64_t mask = ((uint64_t)1 << (W % 64)) - 1;
+            bits &= mask;
+            if (bits >> (W - 1)) bits |= ~mask;
+        }
+        return (int64_t)bits;
+    }
+    }
+}
+
+// Store v * 2^-FromF into W bits with F fraction bits
+template<int W, int F, ap_q_mode Q, ap_o_mode O, int FromF>
+inline int64_t fit(wide_t v) {
+    if (FromF > F) {
+        const int shift = FromF > F ? FromF - F : 0;
+        const wide_t q = v >> shift; // Floor
+        const wide_t rem = v - q * pow2(shift);
+        const wide_t half = pow2(shift - 1);
+        if (round_up<Q>(v < 0, rem == 0, (rem > half) - (rem < half), q & 1)) {
+            v = q + 1;
+        } else {
+            v = q;
+        }
+    } else if (FromF < F) {
+        v *= pow2(FromF < F ? F - FromF : 0);
+    }
+    return overflow<W, O>(v);
+}
+
+// Store x into W bits with F fraction bits
+template<int W, int F, ap_q_mode Q, ap_o_mode O>
+inline int64_t fit_double(double x) {
+    if (x != x) return 0; // NaN
+    const double scaled = std::ldexp(x, F); // Exact unless it overflows
+    const double floor_v = std::floor(scaled);
+    const double big = std::ldexp(1.0, 100);  // Beyond every W-bit range
+    wide_t v;
+    if (floor_v > -big && floor_v < big) {
+        const double rem = scaled - floor_v;  // Exact, in [0, 1)
+        v = (wide_t)floor_v;
+        if (round_up<Q>(x < 0, rem == 0, (rem > 0.5) - (rem < 0.5), v & 1)) v += 1;
+    } else if (O == AP_WRAP && std::isfinite(floor_v)) {
+        v = (wide_t)std::fmod(floor_v, std::ldexp(1.0, 64)); // Same low 64 bits
+    } else {
+        v = (floor_v > 0) ? pow2(100) : -pow2(100);
+    }
+    return overflow<W, O>(v);
+}
+
+// V of a in units of 2^-F
+template<int F, class T>
+inline wide_t align(const T& a) {
+    return (wide_t)a.V * pow2(F - T::F);
+}
+
+// Exact result types of the binary operators (as Vitis HLS)
+template<int W1, int I1, int W2, int I2>
+struct result {
+    static const int F = max_int(W1 - I1, W2 - I2);
+    static const int plus_i = max_int(I1, I2) + 1;
+    typedef ap_fixed<plus_i + F, plus_i> plus;
+    typedef ap_fixed<W1 + W2, I1 + I2> mult;
+};
+
+} // namespace ap_fixed_detail
+
+template<int _AP_W, int _AP_I, ap_q_mode _AP_Q, ap_o_mode _AP_O, int _AP_N>
+struct ap_fixed {
+    static_assert(_AP_W >= 1 && _AP_W <= 64, "ap_fixed stand-in supports 1 <= W <= 64");
+    static_assert(_AP_W - _AP_I >= 0 && _AP_W - _AP_I <= 63, "ap_fixed stand-in supports 0 <= W-I <= 63");
+    static_assert(_AP_O != AP_WRAP_SM && _AP_N == 0, "ap_fixed stand-in does not support AP_WRAP_SM or N > 0");
+
+    // Value * 2^F in the narrowest integer that holds W bits
+    typedef typename std::conditional<(_AP_W <= 8), int8_t,
+            typename std::conditional<(_AP_W <= 16), int16_t,
+            typename std::conditional<(_AP_W <= 32), int32_t, int64_t>::type>::type>::type storage_t;
+
+    static const int F = _AP_W - _AP_I; // Fraction bits
+    storage_t V;
+
+    ap_fixed() : V(0) {}
+    ap_fixed(double x) : V(ap_fixed_detail::fit_double<_AP_W, F, _AP_Q, _AP_O>(x)) {}
+    ap_fixed(float x) : V(ap_fixed_detail::fit_double<_AP_W, F, _AP_Q, _AP_O>(x)) {}
+
+    template<class Int, class = typename std::enable_if<std::is_integral<Int>::value>::type>
+    ap_fixed(Int x) : V(ap_fixed_detail::fit<_AP_W, F, _AP_Q, _AP_O, 0>(x)) {}
+
+    template<int W2, int I2, ap_q_mode Q2, ap_o_mode O2, int N2>
+    ap_fixed(const ap_fixed<W2, I2, Q2, O2, N2>& x)
+        : V(ap_fixed_detail::fit<_AP_W, F, _AP_Q, _AP_O, W2 - I2>(x.V)) {}
+
+    // A value that is already exact in this type
+    static ap_fixed from_raw(int64_t v) {
+        ap_fixed r;
+        r.V = (storage_t)v;
+        return r;
+    }
+
+    double to_double() const { return std::ldexp((double)V, -F); }
+    float to_float() const { return (float)to_double(); }
+
+    ap_fixed<_AP_W + 1, _AP_I + 1> operator-() const {
+        return ap_fixed<_AP_W + 1, _AP_I + 1>::from_raw(-V);
+    }
+
+    template<int W2, int I2, ap_q_mode Q2, ap_o_mode O2, int N2>
+    ap_fixed& operator+=(const ap_fixed<W2, I2, Q2, O2, N2>& b) { return *this = *this + b; }
+    template<int W2, int I2, ap_q_mode Q2, ap_o_mode O2, int N2>
+    ap_fixed& operator-=(const ap_fixed<W2, I2, Q2, O2, N2>& b) { return *this = *this - b; }
+    template<int W2, int I2, ap_q_mode Q2, ap_o_mode O2, int N2>
+    ap_fixed& operator*=(const ap_fixed<W2, I2, Q2, O2, N2>& b) { return *this = *this * b; }
+};
+
+// --- Arithmetic (exact results) ---
+#define AP_FIXED_BINARY_ARGS \
+    int W1, int I1, ap_q_mode Q1, ap_o_mode O1, int N1, int W2, int I2, ap_q_mode Q2, ap_o_mode O2, int N2
+#define AP_FIXED_A const ap_fixed<W1, I1, Q1, O1, N1>& a
+#define AP_FIXED_B const ap_fixed<W2, I2, Q2, O2, N2>& b
+
+template<AP_FIXED_BINARY_ARGS>
+inline typename ap_fixed_detail::result<W1, I1, W2, I2>::plus operator+(AP_FIXED_A, AP_FIXED_B) {
+    typedef typename ap_fixed_detail::result<W1, I1, W2, I2>::plus R;
+    return R::from_raw((int64_t)(ap_fixed_detail::align<R::F>(a) + ap_fixed_detail::align<R::F>(b)));
+}
+
+template<AP_FIXED_BINARY_ARGS>
+inline typename ap_fixed_detail::result<W1, I1, W2, I2>::plus operator-(AP_FIXED_A, AP_FIXED_B) {
+    typedef typename ap_fixed_detail::result<W1, I1, W2, I2>::plus R;
+    return R::from_raw((int64_t)(ap_fixed_detail::align<R::F>(a) - ap_fixed_detail::align<R::F>(b)));
+}
+
+template<AP_FIXED_BINARY_ARGS>
+inline typename ap_fixed_detail::result<W1, I1, W2, I2>::mult operator*(AP_FIXED_A, AP_FIXED_B) {
+    typedef typename ap_fixed_detail::result<W1, I1, W2, I2>::mult R;
+    return R::from_raw((int64_t)((ap_fixed_detail::wide_t)a.V * b.V));
+}
+
+// --- Comparisons (exact) ---
+#define AP_FIXED_COMPARE(op) \
+    template<AP_FIXED_BINARY_ARGS> \
+    inline bool operator op(AP_FIXED_A, AP_FIXED_B) { \
+        const int F = ap_fixed_detail::max_int(W1 - I1, W2 - I2); \
+        return ap_fixed_detail::align<F>(a) op ap_fixed_detail::align<F>(b); \
+    }
+AP_FIXED_COMPARE(==)
+AP_FIXED_COMPARE(!=)
+AP_FIXED_COMPARE(<)
+AP_FIXED_COMPARE(<=)
+AP_FIXED_COMPARE(>)
+AP_FIXED_COMPARE(>=)
+#undef AP_FIXED_COMPARE
+#undef AP_FIXED_BINARY_ARGS
+#undef AP_FIXED_A
+#undef AP_FIXED_B
+
+#endif // XCEPTION_AP_FIXED_H
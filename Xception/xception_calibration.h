@@ -0,0 +1,80 @@
+#ifndef XCEPTION_CALIBRATION_H
+#define XCEPTION_CALIBRATION_H
+
+#include <cstddef> // For size_t
+#include <string>  // For the image file list
+#include <vector>
+#include "xception_params.h"
+
+// ==========================================================================
+// === Activation-Range Calibration (Host Builds Only) ======================
+// ==========================================================================
+// Quantized and fixed-point inference need each layer's activation range.
+// While calibration is active (calibration_begin() .. calibration_end()),
+// every layer output the network produces is handed to the collector,
+// which accumulates per layer:
+//   - min, max and the fraction of exact zeros,
+//   - a CALIBRATION_BINS-bin histogram of |x| for percentiles. The bins
+//     cover [0, range]; when a larger value arrives the range doubles and
+//     neighbouring bins merge, so no pass over earlier data is needed.
+// calibration_write() stores the result as a per-layer scale file, which
+// xception_fixed_point_check_ranges() checks against the fixed-point format
+// (reading it back with calibration_load_ranges()).
+//
+// xception_inference() stores every layer output whole, so the hooks sit
+// right after its layers. Layers are named "input", "conv1", "conv2",
+// "block1/residual", "block1/sep1/depthwise", "block1/sep1",
+// "block1/sep2/depthwise", "block1/sep2", "block1/pool", "block1" (after
+// the residual add), the same for "block12", "middle" (without residual
+// conv and pool; the statistics pool all 8 passes) and "block13" (sep1 and
+// sep2 only), then "gap" and "logits".
+// ==========================================================================
+
+#define CALIBRATION_MAX_LAYERS 64      // Distinct layer names per session
+#define CALIBRATION_BINS 2048          // Histogram bins of |x| per layer
+#define CALIBRATION_PERCENTILE 99.99   // Percentile of |x| written as a layer's range
+
+// Start a session (earlier statistics are dropped) / stop observing (the
+// statistics are kept until the next calibration_begin())
+void calibration_begin();
+void calibration_end();
+bool calibration_active();
+
+// Hook: add a layer output of `count` floats to the layer's statistics.
+// Returns at once when no session is active; safe from several threads.
+void calibration_observe(const char* layer, const float data[], size_t count);
+
+// CALIBRATION_PERCENTILE of |x| over everything the layer produced (never
+// above its max |x|); 0 for a layer that was not observed
+float calibration_range(const char* layer);
+
+// Write the scale file, one line per layer in the order first observed:
+//   <layer> <count> <min> <max> <zero fraction> <p99> <p99.9> <p99.99> <range>
+// percentiles are of |x|, range as calibration_range(). False on I/O errors.
+bool calibration_write(const char* path);
+
+// Read the ranges of the given layers back from a scale file. False if the
+// file cannot be read or a layer is missing from it.
+bool calibration_load_ranges(const char* path, const char* const layers[], int count, float ranges[]);
+
+// Calibrate over a directory of raw images: every regular file holding
+// exactly INPUT_C x INPUT_H x INPUT_W float32 values (CHW, preprocessed like
+// Test/input_image_xception.h) runs through Xception() in a calibration
+// session, in file name order, and the scale file is written to scale_path.
+// Returns the number of images used, or -1 if the directory cannot be read
+// or the file not written.
+int xception_calibrate_directory(const char* dir, const char* scale_path);
+
+// The raw images of a directory (regular files of exactly INPUT_C x INPUT_H
+// x INPUT_W float32 values), in file name order. Returns their count, or -1
+// if the directory cannot be read.
+int calibration_image_files(const char* dir, std::vector<std::string>& paths);
+
+// Hook for code that is also synthesized: compiles to nothing in HLS
+#ifndef __SYNTHESIS__
+#define CALIBRATION_OBSERVE(layer, data, count) calibration_observe(layer, data, count)
+#else
+#define CALIBRATION_OBSERVE(layer, data, count) ((void)0)
+#endif
+
+#endif // XCEPTION_CALIBRATION_H
@@ -0,0 +1,204 @@
+#ifndef XCEPTION_FIXED_H
+#define XCEPTION_FIXED_H
+
+#include "xception.h"
+#include "xception_gemm.h"
+#include "xception_simd.h"
+
+// ==========================================================================
+// === Shape-Specialized Layer Templates ====================================
+// ==========================================================================
+// Every layer shape in xception_params.h is known at compile time, so the
+// top-level Xception() instantiates one kernel per layer instead of passing
+// InH..PadW as runtime ints. Trip counts and index strides become constants:
+// HLS can fully unroll the kernel window and pipeline with a fixed latency,
+// and the C++ compiler can unroll/vectorize the same loops on the host.
+// Shape mistakes (e.g. an output size that does not match the kernel/stride/
+// padding) are caught by static_assert instead of overrunning a buffer.
+// ==========================================================================
+
+// Output size of a convolution/pooling window along one axis
+constexpr int conv_out_dim(int In, int K, int S, int P) {
+    return (In + 2 * P - K) / S + 1;
+}
+
+// One output pixel of convolution_fixed(); w_oc points at the output
+// channel's InC x K x K weights and (ih0, iw0) at the top-left input tap.
+// Border=false is only used for windows fully inside the input.
+template<int InH, int InW, int InC, int K, bool Border>
+inline float conv_pixel_fixed(
+    const float input[], const float w_oc[], float bias,
+    int ih0, int iw0, bool apply_relu)
+{
+#pragma HLS INLINE
+    float sum = bias;
+
+    FIXED_IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
+#pragma HLS PIPELINE II=1
+        // K x K window fully unrolled: K*K MACs per input channel
+        FIXED_KERNEL_H_LOOP: for (int kh = 0; kh < K; ++kh) {
+#pragma HLS UNROLL
+            FIXED_KERNEL_W_LOOP: for (int kw = 0; kw < K; ++kw) {
+#pragma HLS UNROLL
+                int ih = ih0 + kh;
+                int iw = iw0 + kw;
+                if (!Border || (ih >= 0 && ih < InH && iw >= 0 && iw < InW)) {
+                    sum += input[ic * InH * InW + ih * InW + iw] * w_oc[ic * K * K + kh * K + kw];
+                }
+            }
+        }
+    }
+    return apply_relu ? relu_activation(sum) : sum;
+}
+
+//--------------------------------------------------------------------------
+// Convolution (square kernel K, stride S, padding P)
+//--------------------------------------------------------------------------
+template<int InH, int InW, int InC, int OutC, int K, int S, int P>
+void convolution_fixed(
+    const float input[InC * InH * InW],
+    const float weights[OutC * InC * K * K],
+    const float biases[OutC],
+    float output[],               // OutC * OutH * OutW
+    bool apply_relu)
+{
+    static_assert(InH > 0 && InW > 0 && InC > 0 && OutC > 0, "empty convolution");
+    static_assert(K > 0 && S > 0 && P >= 0 && P < K, "invalid kernel/stride/padding");
+    static_assert(InH + 2 * P >= K && InW + 2 * P >= K, "kernel larger than padded input");
+
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    constexpr int OutHW = OutH * OutW;
+    constexpr int KK = K * K;
+
+#ifndef __SYNTHESIS__
+    // Host builds: same backend choice as convolution(), with constant shapes
+    ConvBackend backend = conv_select_backend(InC, OutH, OutW, OutC, K, K, S, S, P, P);
+    if (backend == CONV_BACKEND_POINTWISE) {
+        pointwise_convolution(input, weights, biases, output, OutHW, InC, OutC, apply_relu);
+        return;
+    }
+    if (backend == CONV_BACKEND_GEMM) {
+        convolution_gemm(input, weights, biases, output,
+                         InH, InW, InC, OutH, OutW, OutC,
+                         K, K, S, S, P, P, apply_relu);
+        return;
+    }
+#endif
+
+    // Border split resolved at compile time: with P == 0 every pixel is interior
+    constexpr int OH_LO = window_interior_begin(OutH, S, P);
+    constexpr int OH_HI = window_interior_end(InH, OutH, K, S, P);
+    constexpr int OW_LO = window_interior_begin(OutW, S, P);
+    constexpr int OW_HI = window_interior_end(InW, OutW, K, S, P);
+
+    FIXED_OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
+        const float* w_oc = weights + oc * (InC * KK);
+        FIXED_OUT_H_LOOP: for (int oh = 0; oh < OutH; ++oh) {
+            bool interior_row = (oh >= OH_LO && oh < OH_HI);
+            int w_lo = interior_row ? OW_LO : OutW;
+            int w_hi = interior_row ? OW_HI : OutW;
+            float* out_row = output + oc * OutHW + oh * OutW;
+
+            FIXED_OUT_W_BORDER_L_LOOP: for (int ow = 0; ow < w_lo; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, true>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_OUT_W_INTERIOR_LOOP: for (int ow = w_lo; ow < w_hi; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, false>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_OUT_W_BORDER_R_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, InC, K, true>(
+                    input, w_oc, biases[oc], oh * S - P, ow * S - P, apply_relu);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Depthwise Convolution (one K x K filter per channel)
+//--------------------------------------------------------------------------
+template<int InH, int InW, int C, int K, int S, int P>
+void depthwise_convolution_fixed(
+    const float input[C * InH * InW],
+    const float weights[C * K * K],
+    const float biases[],         // C, may be NULL
+    float output[],               // C * OutH * OutW
+    bool apply_relu)
+{
+    static_assert(InH > 0 && InW > 0 && C > 0, "empty depthwise convolution");
+    static_assert(K > 0 && S > 0 && P >= 0 && P < K, "invalid kernel/stride/padding");
+    static_assert(InH + 2 * P >= K && InW + 2 * P >= K, "kernel larger than padded input");
+
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    constexpr int InHW = InH * InW;
+    constexpr int OutHW = OutH * OutW;
+
+#ifndef __SYNTHESIS__
+    if (S == 1 && simd_kernels().level != SIMD_SCALAR) {
+        depthwise_convolution_simd(input, weights, biases, output,
+                                   InH, InW, C, OutH, OutW,
+                                   K, K, S, P, P, apply_relu);
+        return;
+    }
+#endif
+
+    // Depthwise channel c is a 1-input-channel convolution of plane c
+    constexpr int OH_LO = window_interior_begin(OutH, S, P);
+    constexpr int OH_HI = window_interior_end(InH, OutH, K, S, P);
+    constexpr int OW_LO = window_interior_begin(OutW, S, P);
+    constexpr int OW_HI = window_interior_end(InW, OutW, K, S, P);
+
+    FIXED_DW_C_LOOP: for (int c = 0; c < C; ++c) {
+        const float* in_c = input + c * InHW;
+        const float* w_c = weights + c * K * K;
+        float bias = biases ? biases[c] : 0.0f;
+        FIXED_DW_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
+            bool interior_row = (oh >= OH_LO && oh < OH_HI);
+            int w_lo = interior_row ? OW_LO : OutW;
+            int w_hi = interior_row ? OW_HI : OutW;
+            float* out_row = output + c * OutHW + oh * OutW;
+
+            FIXED_DW_OW_BORDER_L_LOOP: for (int ow = 0; ow < w_lo; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, 1, K, true>(
+                    in_c, w_c, bias, oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_DW_OW_INTERIOR_LOOP: for (int ow = w_lo; ow < w_hi; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, 1, K, false>(
+                    in_c, w_c, bias, oh * S - P, ow * S - P, apply_relu);
+            }
+            FIXED_DW_OW_BORDER_R_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+                out_row[ow] = conv_pixel_fixed<InH, InW, 1, K, true>(
+                    in_c, w_c, bias, oh * S - P, ow * S - P, apply_relu);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Separable Convolution Block (Depthwise K x K -> Pointwise 1x1)
+//--------------------------------------------------------------------------
+template<int InH, int InW, int InC, int OutC, int K, int S, int P>
+void separable_conv_block_fixed(
+    const float input[InC * InH * InW],
+    float output[],               // OutC * OutH * OutW
+    const float dw_weights[InC * K * K], const float dw_biases[], bool apply_relu_dw,
+    const float pw_weights[OutC * InC], const float pw_biases[OutC], bool apply_relu_pw,
+    float dw_buffer[])            // InC * OutH * OutW
+{
+    constexpr int OutH = conv_out_dim(InH, K, S, P);
+    constexpr int OutW = conv_out_dim(InW, K, S, P);
+    static_assert(InC * OutH * OutW <= MAX_SEP_DW_SIZE, "separable conv depthwise buffer too small");
+
+    // 1. Depthwise Convolution
+    depthwise_convolution_fixed<InH, InW, InC, K, S, P>(
+        input, dw_weights, dw_biases, dw_buffer, apply_relu_dw);
+
+    // 2. Pointwise Convolution (Standard 1x1 Conv)
+    convolution_fixed<OutH, OutW, InC, OutC, 1, 1, 0>(
+        dw_buffer, pw_weights, pw_biases, output, apply_relu_pw);
+}
+
+#endif // XCEPTION_FIXED_H
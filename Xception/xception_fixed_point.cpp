@@ -0,0 +1,222 @@
+#include <cmath>
+#include <cstdio>
+#include "xception_fixed_point.h"
+#include "xception_typed.h"
+#include "xception_calibration.h" // For the range check
+
+// One layer's weights and biases in the blob
+struct FixedPointLayer {
+    const fixed_data_t* weights;
+    const fixed_data_t* biases;
+};
+
+// The standard conv at `offset`, which is advanced past it
+static FixedPointLayer fixed_point_layer(const fixed_data_t blob[], int& offset, int InC, int OutC, int K) {
+#pragma HLS INLINE
+    FixedPointLayer layer;
+    layer.weights = blob + offset;
+    layer.biases = blob + offset + OutC * InC * K * K;
+    offset += fixed_point_layer_size(InC, OutC, K);
+    return layer;
+}
+
+// Depthwise 3x3 (S=1, P=1, no bias) -> pointwise on an H x W map, as
+// separable_conv_block_fixed(); its weights are read at `offset`
+static void fixed_point_separable(
+    const fixed_data_t input[], fixed_data_t output[], int H, int W, int InC, int OutC,
+    const fixed_data_t blob[], int& offset, bool apply_relu_dw, bool apply_relu_pw,
+    fixed_data_t dw_buffer[])
+{
+    const fixed_data_t* dw_weights = blob + offset;
+    offset += InC * 3 * 3;
+    FixedPointLayer pw = fixed_point_layer(blob, offset, InC, OutC, 1);
+    separable_conv_block<fixed_data_t, fixed_acc_t>(
+        input, output, H, W, InC, H, W, H, W, OutC, 3, 3, 1, 1, 1, 1,
+        dw_weights, 0, apply_relu_dw, pw.weights, pw.biases, apply_relu_pw, dw_buffer);
+}
+
+//--------------------------------------------------------------------------
+// Reentrant Fixed-Point Xception Implementation
+//--------------------------------------------------------------------------
+void xception_fixed_point_inference(
+    FixedPointContext& ctx,
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+) {
+    typedef fixed_data_t T;
+    typedef fixed_acc_t Acc;
+    int offset = 0; // Next layer in the weight blob
+
+    // === Entry Flow ===
+    FixedPointLayer conv1 = fixed_point_layer(weights, offset, INPUT_C, CONV1_C_OUT, 3);
+    convolution<T, Acc>(input_image, conv1.weights, conv1.biases, ctx.buf_conv1,
+                        INPUT_H, INPUT_W, INPUT_C, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
+                        3, 3, 2, 2, 1, 1, true);
+    FixedPointLayer conv2 = fixed_point_layer(weights, offset, CONV1_C_OUT, CONV2_C_OUT, 3);
+    convolution<T, Acc>(ctx.buf_conv1, conv2.weights, conv2.biases, ctx.buf_conv2,
+                        CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT, CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT,
+                        3, 3, 1, 1, 1, 1, true);
+
+    // --- Block 1 ---
+    // Residual Path (Conv 1x1, S=2)
+    FixedPointLayer res = fixed_point_layer(weights, offset, CONV2_C_OUT, B1_SEP2_C_OUT, 1);
+    convolution<T, Acc>(ctx.buf_conv2, res.weights, res.biases, ctx.buf_res_conv,
+                        CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_POOL_H_OUT, B1_POOL_W_OUT, B1_SEP2_C_OUT,
+                        1, 1, 2, 2, 0, 0, false);
+    // Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2)
+    fixed_point_separable(ctx.buf_conv2, ctx.buf_block_out1, CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_SEP1_C_OUT,
+                          weights, offset, false, true, ctx.buf_sep_dw);
+    fixed_point_separable(ctx.buf_block_out1, ctx.buf_block_out2, CONV2_H_OUT, CONV2_W_OUT, B1_SEP1_C_OUT, B1_SEP2_C_OUT,
+                          weights, offset, false, false, ctx.buf_sep_dw);
+    max_pooling<T>(ctx.buf_block_out2, ctx.buf_block_out1, CONV2_H_OUT, CONV2_W_OUT, B1_SEP2_C_OUT,
+                   B1_POOL_H_OUT, B1_POOL_W_OUT, 3, 3, 2, 2);
+    add_arrays<T>(ctx.buf_block_out1, ctx.buf_res_conv, ctx.buf_block_in, B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT);
+
+    // (Blocks 2 and 3 are omitted, as in xception_inference())
+
+    // === Middle Flow (Repeat 8 times, the block 4 weights each time) ===
+    const int middle_offset = offset;
+    FIXED_MIDDLE_FLOW_LOOP: for (int i = 0; i < 8; ++i) {
+        offset = middle_offset;
+        fixed_point_separable(ctx.buf_block_in, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                              weights, offset, true, true, ctx.buf_sep_dw);
+        fixed_point_separable(ctx.buf_block_out1, ctx.buf_block_out2, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                              weights, offset, true, true, ctx.buf_sep_dw);
+        fixed_point_separable(ctx.buf_block_out2, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                              weights, offset, true, false, ctx.buf_sep_dw);
+        // Residual add in place: the block input is not read again
+        add_arrays<T>(ctx.buf_block_out1, ctx.buf_block_in, ctx.buf_block_in, BUF_MIDDLE_SIZE);
+    }
+
+    // === Exit Flow ===
+    // --- Block 12 (block 1's structure, on the middle-flow output) ---
+    // Residual Path (Conv 1x1, S=2)
+    FixedPointLayer res12 = fixed_point_layer(weights, offset, MIDDLE_C, B5_SEP2_C_OUT, 1);
+    convolution<T, Acc>(ctx.buf_block_in, res12.weights, res12.biases, ctx.buf_res_conv,
+                        MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT,
+                        1, 1, 2, 2, 0, 0, false);
+    // Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2)
+    fixed_point_separable(ctx.buf_block_in, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_SEP1_C_OUT,
+                          weights, offset, false, true, ctx.buf_sep_dw);
+    fixed_point_separable(ctx.buf_block_out1, ctx.buf_block_out2, MIDDLE_H, MIDDLE_W, B5_SEP1_C_OUT, B5_SEP2_C_OUT,
+                          weights, offset, false, false, ctx.buf_sep_dw);
+    max_pooling<T>(ctx.buf_block_out2, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, B5_SEP2_C_OUT,
+                   B5_POOL_H_OUT, B5_POOL_W_OUT, 3, 3, 2, 2);
+    add_arrays<T>(ctx.buf_block_out1, ctx.buf_res_conv, ctx.buf_final_block, B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT);
+
+    // Block 13: two separable convs, no residual, no pool
+    fixed_point_separable(ctx.buf_final_block, ctx.buf_block_out1, B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT, B6_SEP1_C_OUT,
+                          weights, offset, true, true, ctx.buf_sep_dw);
+    fixed_point_separable(ctx.buf_block_out1, ctx.buf_final_block, B6_H_OUT, B6_W_OUT, B6_SEP1_C_OUT, B6_SEP2_C_OUT,
+                          weights, offset, true, true, ctx.buf_sep_dw);
+
+    // Global Average Pooling, Final Classifier (Conv 1x1, no ReLU)
+    global_average_pooling<T, Acc>(ctx.buf_final_block, ctx.buf_gap, B6_H_OUT, B6_W_OUT, B6_SEP2_C_OUT);
+    FixedPointLayer classifier = fixed_point_layer(weights, offset, GAP_OUT_SIZE, NUM_CLASSES, 1);
+    convolution<T, Acc>(ctx.buf_gap, classifier.weights, classifier.biases, output_logits,
+                        1, 1, GAP_OUT_SIZE, 1, 1, NUM_CLASSES, 1, 1, 1, 1, 0, 0, false);
+}
+
+//--------------------------------------------------------------------------
+// Top-level Fixed-Point Xception Function
+//--------------------------------------------------------------------------
+void XceptionFixedPoint(
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+) {
+    #pragma HLS INTERFACE m_axi     port=input_image   offset=slave bundle=gmem0
+    #pragma HLS INTERFACE m_axi     port=output_logits offset=slave bundle=gmem1
+    #pragma HLS INTERFACE m_axi     port=weights       offset=slave bundle=gmem2
+    #pragma HLS INTERFACE s_axilite port=return        bundle=control
+
+    static FixedPointContext default_context;
+    xception_fixed_point_inference(default_context, input_image, weights, output_logits);
+}
+
+#ifndef __SYNTHESIS__
+//--------------------------------------------------------------------------
+// Weight Blob (Host)
+//--------------------------------------------------------------------------
+// Append n rounded values
+static void fixed_point_pack(fixed_data_t blob[], int& offset, const float values[], int n) {
+    for (int i = 0; i < n; ++i) blob[offset++] = fixed_data_t(values[i]);
+}
+
+static void fixed_point_pack_separable(fixed_data_t blob[], int& offset, const float dw_weights[],
+                                       const float pw_weights[], const float pw_biases[], int InC, int OutC)
+{
+    fixed_point_pack(blob, offset, dw_weights, InC * 3 * 3);
+    fixed_point_pack(blob, offset, pw_weights, OutC * InC);
+    fixed_point_pack(blob, offset, pw_biases, OutC);
+}
+
+void xception_fixed_point_weights(fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS]) {
+    int offset = 0;
+    fixed_point_pack(weights, offset, entry_conv1_weights, CONV1_C_OUT * INPUT_C * 3 * 3);
+    fixed_point_pack(weights, offset, entry_conv1_biases, CONV1_C_OUT);
+    fixed_point_pack(weights, offset, entry_conv2_weights, CONV2_C_OUT * CONV1_C_OUT * 3 * 3);
+    fixed_point_pack(weights, offset, entry_conv2_biases, CONV2_C_OUT);
+    fixed_point_pack(weights, offset, entry_b1_res_conv_weights, B1_SEP2_C_OUT * CONV2_C_OUT);
+    fixed_point_pack(weights, offset, entry_b1_res_conv_biases, B1_SEP2_C_OUT);
+    fixed_point_pack_separable(weights, offset, entry_b1_sep1_dw_weights, entry_b1_sep1_pw_weights,
+                               entry_b1_sep1_pw_biases, CONV2_C_OUT, B1_SEP1_C_OUT);
+    fixed_point_pack_separable(weights, offset, entry_b1_sep2_dw_weights, entry_b1_sep2_pw_weights,
+                               entry_b1_sep2_pw_biases, B1_SEP1_C_OUT, B1_SEP2_C_OUT);
+    fixed_point_pack_separable(weights, offset, middle_b4_sep1_dw_weights, middle_b4_sep1_pw_weights,
+                               middle_b4_sep1_pw_biases, MIDDLE_C, MIDDLE_C);
+    fixed_point_pack_separable(weights, offset, middle_b4_sep2_dw_weights, middle_b4_sep2_pw_weights,
+                               middle_b4_sep2_pw_biases, MIDDLE_C, MIDDLE_C);
+    fixed_point_pack_separable(weights, offset, middle_b4_sep3_dw_weights, middle_b4_sep3_pw_weights,
+                               middle_b4_sep3_pw_biases, MIDDLE_C, MIDDLE_C);
+    fixed_point_pack(weights, offset, exit_b12_res_conv_weights, B5_SEP2_C_OUT * MIDDLE_C);
+    fixed_point_pack(weights, offset, exit_b12_res_conv_biases, B5_SEP2_C_OUT);
+    fixed_point_pack_separable(weights, offset, exit_b12_sep1_dw_weights, exit_b12_sep1_pw_weights,
+                               exit_b12_sep1_pw_biases, MIDDLE_C, B5_SEP1_C_OUT);
+    fixed_point_pack_separable(weights, offset, exit_b12_sep2_dw_weights, exit_b12_sep2_pw_weights,
+                               exit_b12_sep2_pw_biases, B5_SEP1_C_OUT, B5_SEP2_C_OUT);
+    fixed_point_pack_separable(weights, offset, exit_b13_sep1_dw_weights, exit_b13_sep1_pw_weights,
+                               exit_b13_sep1_pw_biases, B5_SEP2_C_OUT, B6_SEP1_C_OUT);
+    fixed_point_pack_separable(weights, offset, exit_b13_sep2_dw_weights, exit_b13_sep2_pw_weights,
+                               exit_b13_sep2_pw_biases, B6_SEP1_C_OUT, B6_SEP2_C_OUT);
+    fixed_point_pack(weights, offset, final_conv_weights, NUM_CLASSES * GAP_OUT_SIZE);
+    fixed_point_pack(weights, offset, final_conv_biases, NUM_CLASSES);
+}
+
+//--------------------------------------------------------------------------
+// Range Check (Host)
+//--------------------------------------------------------------------------
+// Every map the fixed-point network stores, named as in the scale file
+static const char* const fixed_point_map_names[] = {
+    "input", "conv1", "conv2",
+    "block1/residual", "block1/sep1/depthwise", "block1/sep1", "block1/sep2/depthwise", "block1/sep2",
+    "block1/pool", "block1",
+    "middle/sep1/depthwise", "middle/sep1", "middle/sep2/depthwise", "middle/sep2",
+    "middle/sep3/depthwise", "middle/sep3", "middle",
+    "block12/residual", "block12/sep1/depthwise", "block12/sep1", "block12/sep2/depthwise", "block12/sep2",
+    "block12/pool", "block12",
+    "block13/sep1/depthwise", "block13/sep1", "block13/sep2/depthwise", "block13/sep2",
+    "gap", "logits",
+};
+
+#define FIXED_POINT_NUM_MAPS ((int)(sizeof(fixed_point_map_names) / sizeof(fixed_point_map_names[0])))
+
+int xception_fixed_point_check_ranges(const char* scale_path) {
+    float ranges[FIXED_POINT_NUM_MAPS];
+    if (!calibration_load_ranges(scale_path, fixed_point_map_names, FIXED_POINT_NUM_MAPS, ranges)) {
+        return -1;
+    }
+    // Largest fixed_data_t: 2^(I-1) less one step
+    const float limit = std::ldexp(1.0f, FIXED_DATA_I - 1) - std::ldexp(1.0f, FIXED_DATA_I - FIXED_DATA_W);
+    int saturating = 0;
+    for (int l = 0; l < FIXED_POINT_NUM_MAPS; ++l) {
+        if (ranges[l] > limit) {
+            fprintf(stderr, "fixed point: %s range %g saturates ap_fixed<%d,%d> (max %g)\n",
+                    fixed_point_map_names[l], ranges[l], FIXED_DATA_W, FIXED_DATA_I, limit);
+            ++saturating;
+        }
+    }
+    return saturating;
+}
+#endif // __SYNTHESIS__
@@ -0,0 +1,94 @@
+#ifndef XCEPTION_FIXED_POINT_H
+#define XCEPTION_FIXED_POINT_H
+
+#include "xception.h"
+#include "xception_types.h"
+
+// ==========================================================================
+// === Fixed-Point Xception =================================================
+// ==========================================================================
+// The Xception() layer sequence on the datatype-templated layers
+// (xception_typed.h) at <fixed_data_t, fixed_acc_t>: ap_fixed<16,6> maps,
+// weights and biases and ap_fixed<36,16> sums (xception_params.h).
+// XceptionFixedPoint() is a second HLS top next to Xception(); under plain
+// g++ it runs on the ap_fixed stand-in with the same bits.
+//
+// The weights are one fixed_data_t blob read over AXI, in the order the
+// layers run: conv1, conv2, the block 1 residual conv and separable convs,
+// the middle flow's separable convs, the block 12 residual conv and
+// separable convs, block 13's, then the classifier. A standard conv stores
+// its weights, then its biases; a separable conv its depthwise weights (no
+// bias), then the pointwise weights and biases.
+// xception_fixed_point_weights() rounds the float arrays of
+// xception_weights.h into it on the host.
+//
+// Every layer shares the one format: the widths are template arguments of
+// the layers and the blob, fixed when the top is synthesized, and a
+// per-layer format would need one instantiation of each layer kernel per
+// layer. The calibration scale file is therefore not loaded by the top but
+// used on the host: xception_fixed_point_check_ranges() reports the layers
+// whose calibrated activation range the format would saturate, which says
+// whether FIXED_DATA_I (params) must grow for a given set of weights.
+// ==========================================================================
+
+// Blob values of a standard (K x K) and of a separable (3x3 DW + PW) conv
+constexpr int fixed_point_layer_size(int InC, int OutC, int K) {
+    return OutC * InC * K * K + OutC;
+}
+
+constexpr int fixed_point_separable_size(int InC, int OutC) {
+    return InC * 3 * 3 + fixed_point_layer_size(InC, OutC, 1);
+}
+
+// Values in the weight blob
+#define XCEPTION_FIXED_POINT_WEIGHTS (fixed_point_layer_size(INPUT_C, CONV1_C_OUT, 3) + \
+    fixed_point_layer_size(CONV1_C_OUT, CONV2_C_OUT, 3) + fixed_point_layer_size(CONV2_C_OUT, B1_SEP2_C_OUT, 1) + \
+    fixed_point_separable_size(CONV2_C_OUT, B1_SEP1_C_OUT) + fixed_point_separable_size(B1_SEP1_C_OUT, B1_SEP2_C_OUT) + \
+    3 * fixed_point_separable_size(MIDDLE_C, MIDDLE_C) + fixed_point_layer_size(MIDDLE_C, B5_SEP2_C_OUT, 1) + \
+    fixed_point_separable_size(MIDDLE_C, B5_SEP1_C_OUT) + fixed_point_separable_size(B5_SEP1_C_OUT, B5_SEP2_C_OUT) + \
+    fixed_point_separable_size(B5_SEP2_C_OUT, B6_SEP1_C_OUT) + fixed_point_separable_size(B6_SEP1_C_OUT, B6_SEP2_C_OUT) + \
+    fixed_point_layer_size(GAP_OUT_SIZE, NUM_CLASSES, 1))
+
+// Per-inference buffers of the fixed-point network (the roles of
+// InferenceContext's; the middle-flow residual is added in place, so
+// buf_res_conv only holds the block 1 and block 12 residual convs)
+struct FixedPointContext {
+    fixed_data_t buf_conv1[BUF_CONV1_SIZE];
+    fixed_data_t buf_conv2[BUF_CONV2_SIZE];
+    fixed_data_t buf_block_in[BUF_RESIDUAL_MAX_SIZE];
+    fixed_data_t buf_block_out1[BUF_BLOCK_MAX_SIZE];
+    fixed_data_t buf_block_out2[BUF_BLOCK_MAX_SIZE];
+    fixed_data_t buf_sep_dw[MAX_SEP_DW_SIZE];
+    fixed_data_t buf_res_conv[BUF_RESIDUAL_MAX_SIZE];
+    fixed_data_t buf_final_block[BUF_EXIT_MAX_SIZE];
+    fixed_data_t buf_gap[GAP_OUT_SIZE];
+};
+
+// Reentrant fixed-point Xception on the caller's context (tens of MB: heap
+// or static, never the stack)
+void xception_fixed_point_inference(
+    FixedPointContext& ctx,
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C],
+    const fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS],
+    fixed_data_t output_logits[NUM_CLASSES]
+);
+
+// HLS top; runs on a static default context, so it is not reentrant
+void XceptionFixedPoint(
+    const fixed_data_t input_image[INPUT_H * INPUT_W * INPUT_C], // Input image
+    const fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS],     // Weight blob
+    fixed_data_t output_logits[NUM_CLASSES]                       // Output logits
+);
+
+#ifndef __SYNTHESIS__
+// Host: round the float weights (xception_weights.h) into a blob
+void xception_fixed_point_weights(fixed_data_t weights[XCEPTION_FIXED_POINT_WEIGHTS]);
+
+// Host: check a scale file (calibration_write() format) against the
+// format. Lists each layer whose calibrated range exceeds fixed_data_t's
+// largest value, where its maps saturate, on stderr and returns their
+// count; -1 if the file cannot be read or lacks one of the layers.
+int xception_fixed_point_check_ranges(const char* scale_path);
+#endif
+
+#endif // XCEPTION_FIXED_POINT_H
@@ -0,0 +1,91 @@
+#ifndef XCEPTION_GEMM_H
+#define XCEPTION_GEMM_H
+
+#include "xception_simd.h" // For HalfFormat
+
+// ==========================================================================
+// === im2col + Blocked SGEMM Convolution Backend (Host Builds Only) ========
+// ==========================================================================
+// Lowers a convolution onto C = A * B where
+//   A = weights      (OutC x InC*KH*KW, row-major exactly as stored)
+//   B = im2col(input)(InC*KH*KW x OutH*OutW, packed on the fly)
+//   C = output       (OutC x OutH*OutW, i.e. the usual CHW output map)
+// The GEMM is blocked BLIS-style: B is packed in KC x NC blocks (L3/L2),
+// A in MC x KC blocks (L2), and an MR x NR register tile is computed by the
+// micro-kernel out of L1. The HLS synthesis flow never sees this code.
+//
+// 1x1 / stride-1 / pad-0 layers skip im2col entirely: the CHW input already
+// is the [InC x H*W] B matrix, so pointwise_convolution() feeds it straight
+// into the same register-blocked micro-kernel.
+//
+// The register tile width NR depends on the instruction set and is taken
+// from the active SIMD kernel table (xception_simd.h) at run time.
+// ==========================================================================
+
+// --- Blocking Parameters ---
+#define SGEMM_MR 6    // Micro-kernel rows (output channels per register tile)
+#define SGEMM_MIN_N 16 // Fewest output pixels worth packing for (one scalar/AVX2 tile)
+#define SGEMM_KC 256  // Depth of a packed panel: MR*KC + KC*NR floats stay in L1/L2
+#define SGEMM_MC 96   // Rows of a packed A block: MC*KC floats = 96 KB (L2)
+#define SGEMM_NC 2048 // Columns of a packed B block: KC*NC floats = 2 MB (L3)
+
+// Convolution backend selection
+enum ConvBackend {
+    CONV_BACKEND_AUTO,      // Pick per layer from the layer shape (default)
+    CONV_BACKEND_DIRECT,    // Always use the direct loop nest in convolution()
+    CONV_BACKEND_GEMM,      // Always lower to im2col + SGEMM
+    CONV_BACKEND_POINTWISE  // 1x1 GEMM engine (picked automatically for 1x1, S=1, P=0)
+};
+
+// Override the per-layer backend choice (mainly for testing/benchmarking)
+void set_conv_backend(ConvBackend backend);
+
+// Backend convolution() uses for a layer of the given shape
+ConvBackend conv_select_backend(
+    int InC, int OutH, int OutW, int OutC, int KH, int KW,
+    int StrideH, int StrideW, int PadH, int PadW);
+
+// im2col + blocked SGEMM convolution (same contract as convolution())
+void convolution_gemm(
+    const float input[],         // Input feature map (flattened)
+    const float weights[],       // Kernel weights (flattened: OutC, InC, KH, KW)
+    const float biases[],        // Kernel biases (size: OutC), may be NULL
+    float output[],              // Output feature map (flattened)
+    int InH, int InW, int InC,   // Input dimensions H, W, C
+    int OutH, int OutW, int OutC,// Output dimensions H, W, C
+    int KH, int KW,              // Kernel dimensions H, W
+    int StrideH, int StrideW,    // Stride in H, W
+    int PadH, int PadW,          // Padding in H, W
+    bool apply_relu              // Flag to apply ReLU activation
+);
+
+// Pointwise (1x1, stride 1, pad 0) convolution engine:
+// output[OutC x HW] = weights[OutC x InC] * input[InC x HW], bias + ReLU fused
+void pointwise_convolution(
+    const float input[],         // Input feature map (flattened: InC, H*W)
+    const float weights[],       // Kernel weights (flattened: OutC, InC)
+    const float biases[],        // Kernel biases (size: OutC), may be NULL
+    float output[],              // Output feature map (flattened: OutC, H*W)
+    int HW,                      // Spatial size H*W (same for input and output)
+    int InC, int OutC,           // Channel counts
+    bool apply_relu              // Flag to apply ReLU activation
+);
+
+// --- 16-Bit Storage Variants (xception_half.h) ---
+// Same contracts with fp16/bf16 input and output maps. The weights come from
+// the store as full-K 16-bit panels (xception_weight_store.h); A tiles and
+// B panels are widened to fp32 as they are packed, so every register tile
+// sums its whole reduction in fp32 in one micro-kernel call and is rounded
+// to 16 bits only when it is stored. The reduction (InC*KH*KW) is limited to
+// SGEMM_MC*SGEMM_KC/SGEMM_MR (4096), the widened A tile's scratch.
+void convolution_gemm_half(
+    const uint16_t input[], const float weights[], const float biases[], uint16_t output[],
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu,
+    HalfFormat format);
+
+void pointwise_convolution_half(
+    const uint16_t input[], const float weights[], const float biases[], uint16_t output[],
+    int HW, int InC, int OutC, bool apply_relu, HalfFormat format);
+
+#endif // XCEPTION_GEMM_H
@@ -0,0 +1,405 @@
+#include "xception_half.h"
+#include "xception_fixed.h"
+#include "xception_gemm.h"
+#include "xception_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side reduced-precision path only
+
+#include <algorithm> // For std::min
+#include <cstring>   // For memcpy
+#include <vector>    // For the fp32 scratch planes and conversion slots
+
+static InferencePrecision current_precision = PRECISION_FP32;
+
+void set_inference_precision(InferencePrecision precision) {
+    current_precision = precision;
+}
+
+InferencePrecision inference_precision() {
+    return current_precision;
+}
+
+// The 16-bit view of a context buffer
+static uint16_t* half_buffer(float buffer[]) {
+    return reinterpret_cast<uint16_t*>(buffer);
+}
+
+static const uint16_t* half_buffer(const float buffer[]) {
+    return reinterpret_cast<const uint16_t*>(buffer);
+}
+
+//--------------------------------------------------------------------------
+// Plane-wise Layers
+//--------------------------------------------------------------------------
+// Each channel plane is widened into fp32 scratch, run through the fp32 SIMD
+// kernel with a single channel, and the result rounded back. Planes are the
+// thread pool's work items; each task allocates its scratch once.
+
+// Depthwise convolution, stride 1 along W (as depthwise_convolution_simd)
+static void depthwise_convolution_half(
+    const uint16_t input[], const float weights[], uint16_t output[],
+    int InH, int InW, int C, int OutH, int OutW,
+    int K, int Stride, int Pad, bool apply_relu, HalfFormat format)
+{
+    const SimdKernels& simd = simd_kernels();
+    parallel_for(C, (double)OutH * OutW * K * K, [&](int c0, int c1) {
+        std::vector<float> in_plane((size_t)InH * InW);
+        std::vector<float> out_plane((size_t)OutH * OutW);
+        for (int c = c0; c < c1; ++c) {
+            simd.half_to_float[format](InH * InW, input + (size_t)c * InH * InW, in_plane.data());
+            depthwise_convolution_simd(in_plane.data(), weights + c * K * K, 0, out_plane.data(),
+                                       InH, InW, 1, OutH, OutW, K, K, Stride, Pad, Pad, apply_relu);
+            simd.float_to_half[format](OutH * OutW, out_plane.data(), output + (size_t)c * OutH * OutW);
+        }
+    });
+}
+
+static void max_pooling_half(
+    const uint16_t input[], uint16_t output[],
+    int InH, int InW, int C, int OutH, int OutW, int K, int Stride, HalfFormat format)
+{
+    const SimdKernels& simd = simd_kernels();
+    parallel_for(C, (double)OutH * (K * InW + OutW * K), [&](int c0, int c1) {
+        std::vector<float> in_plane((size_t)InH * InW);
+        std::vector<float> out_plane((size_t)OutH * OutW);
+        for (int c = c0; c < c1; ++c) {
+            simd.half_to_float[format](InH * InW, input + (size_t)c * InH * InW, in_plane.data());
+            max_pooling_simd(in_plane.data(), out_plane.data(), InH, InW, 1, OutH, OutW,
+                             K, K, Stride, Stride);
+            // A max is one of its inputs, so rounding it back is exact
+            simd.float_to_half[format](OutH * OutW, out_plane.data(), output + (size_t)c * OutH * OutW);
+        }
+    });
+}
+
+// GAP into an fp32 vector (the classifier input)
+static void global_average_pooling_half(
+    const uint16_t input[], float output[], int InH, int InW, int C, HalfFormat format)
+{
+    const SimdKernels& simd = simd_kernels();
+    const int HW = InH * InW;
+    std::vector<float> plane(HW);
+    for (int c = 0; c < C; ++c) {
+        simd.half_to_float[format](HW, input + (size_t)c * HW, plane.data());
+        output[c] = simd.vsum(HW, plane.data()) / (float)HW;
+    }
+}
+
+#define HALF_BLOCK 4096 // Values per residual-add / conversion work item
+
+static void add_arrays_half(const uint16_t a[], const uint16_t b[], uint16_t result[],
+                            int size, HalfFormat format)
+{
+    const SimdKernels& simd = simd_kernels();
+    const int blocks = (size + HALF_BLOCK - 1) / HALF_BLOCK;
+    parallel_for(blocks, HALF_BLOCK, [&](int b0, int b1) {
+        float fa[HALF_BLOCK], fb[HALF_BLOCK];
+        for (int blk = b0; blk < b1; ++blk) {
+            int offset = blk * HALF_BLOCK;
+            int n = std::min(HALF_BLOCK, size - offset);
+            simd.half_to_float[format](n, a + offset, fa);
+            simd.half_to_float[format](n, b + offset, fb);
+            simd.vadd(n, fa, fb, fa);
+            simd.float_to_half[format](n, fa, result + offset);
+        }
+    });
+}
+
+// Depthwise 3x3 (S=1, P=1) -> pointwise, as separable_conv_block_fixed()
+static void separable_conv_half(
+    const uint16_t input[], uint16_t output[], int H, int W, int InC, int OutC,
+    const float dw_weights[], bool apply_relu_dw,
+    const float pw_weights[], const float pw_biases[], bool apply_relu_pw,
+    uint16_t dw_buffer[], HalfFormat format)
+{
+    depthwise_convolution_half(input, dw_weights, dw_buffer, H, W, InC, H, W, 3, 1, 1,
+                               apply_relu_dw, format);
+    pointwise_convolution_half(dw_buffer, pw_weights, pw_biases, output, H * W, InC, OutC,
+                               apply_relu_pw, format);
+}
+
+//--------------------------------------------------------------------------
+// Per-Layer Precision
+//--------------------------------------------------------------------------
+static HalfFormat half_format(LayerPrecision precision) {
+    return (precision == LAYER_BF16) ? HALF_BF16 : HALF_FP16;
+}
+
+// Bytes of one value stored at `precision`
+static size_t precision_bytes(LayerPrecision precision) {
+    return (precision == LAYER_FP32) ? sizeof(float) : sizeof(uint16_t);
+}
+
+// Convert n values stored at `from` into `to` (fp16 <-> bf16 through fp32)
+static void convert_map(const float input[], LayerPrecision from, float output[], LayerPrecision to, int n) {
+    const SimdKernels& simd = simd_kernels();
+    const int blocks = (n + HALF_BLOCK - 1) / HALF_BLOCK;
+    parallel_for(blocks, HALF_BLOCK, [&](int b0, int b1) {
+        float wide[HALF_BLOCK];
+        for (int blk = b0; blk < b1; ++blk) {
+            int offset = blk * HALF_BLOCK;
+            int count = std::min(HALF_BLOCK, n - offset);
+            if (from == LAYER_FP32) {
+                simd.float_to_half[half_format(to)](count, input + offset, half_buffer(output) + offset);
+            } else if (to == LAYER_FP32) {
+                simd.half_to_float[half_format(from)](count, half_buffer(input) + offset, output + offset);
+            } else {
+                simd.half_to_float[half_format(from)](count, half_buffer(input) + offset, wide);
+                simd.float_to_half[half_format(to)](count, wide, half_buffer(output) + offset);
+            }
+        }
+    });
+}
+
+#define MIXED_SLOTS 2 // Conversions alive at once (one per block 1 branch)
+
+// The calling thread's conversion scratch `slot`, grown to n floats on first use
+static float* conversion_slot(int slot, size_t n) {
+    static thread_local std::vector<float> slots[MIXED_SLOTS];
+    if (slots[slot].size() < n) {
+        slots[slot].resize(n);
+    }
+    return slots[slot].data();
+}
+
+// A map of n values stored at `from`, read by a layer running at `to`: the
+// map itself when they agree, otherwise its conversion in scratch `slot`
+static const float* mixed_input(const float map[], LayerPrecision from, LayerPrecision to, int slot, int n) {
+    if (from == to) {
+        return map;
+    }
+    float* converted = conversion_slot(slot, n);
+    convert_map(map, from, converted, to, n);
+    return converted;
+}
+
+// The layers at `precision`, with maps stored at it: the float layers of
+// xception.cpp for fp32, the 16-bit layers above otherwise
+static void mixed_convolution(
+    const float input[], const float weights[], const float biases[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int K, int Stride, int Pad, bool apply_relu, LayerPrecision precision)
+{
+    if (precision == LAYER_FP32) {
+        convolution(input, weights, biases, output, InH, InW, InC, OutH, OutW, OutC,
+                    K, K, Stride, Stride, Pad, Pad, apply_relu);
+    } else {
+        convolution_gemm_half(half_buffer(input), weights, biases, half_buffer(output),
+                              InH, InW, InC, OutH, OutW, OutC, K, K, Stride, Stride, Pad, Pad,
+                              apply_relu, half_format(precision));
+    }
+}
+
+static void mixed_separable(
+    const float input[], float output[], int H, int W, int InC, int OutC,
+    const float dw_weights[], bool apply_relu_dw,
+    const float pw_weights[], const float pw_biases[], bool apply_relu_pw,
+    float dw_buffer[], LayerPrecision precision)
+{
+    if (precision == LAYER_FP32) {
+        depthwise_convolution(input, dw_weights, NULL, dw_buffer, H, W, InC, H, W,
+                              3, 3, 1, 1, 1, 1, apply_relu_dw);
+        convolution(dw_buffer, pw_weights, pw_biases, output, H, W, InC, H, W, OutC,
+                    1, 1, 1, 1, 0, 0, apply_relu_pw);
+    } else {
+        separable_conv_half(half_buffer(input), half_buffer(output), H, W, InC, OutC,
+                            dw_weights, apply_relu_dw, pw_weights, pw_biases, apply_relu_pw,
+                            half_buffer(dw_buffer), half_format(precision));
+    }
+}
+
+static void mixed_max_pooling(
+    const float input[], float output[],
+    int InH, int InW, int C, int OutH, int OutW, int K, int Stride, LayerPrecision precision)
+{
+    if (precision == LAYER_FP32) {
+        max_pooling(input, output, InH, InW, C, OutH, OutW, K, K, Stride, Stride);
+    } else {
+        max_pooling_half(half_buffer(input), half_buffer(output), InH, InW, C, OutH, OutW,
+                         K, Stride, half_format(precision));
+    }
+}
+
+static void mixed_add(const float a[], const float b[], float result[], int size, LayerPrecision precision) {
+    if (precision == LAYER_FP32) {
+        add_arrays(a, b, result, size);
+    } else {
+        add_arrays_half(half_buffer(a), half_buffer(b), half_buffer(result), size, half_format(precision));
+    }
+}
+
+static void mixed_global_average_pooling(
+    const float input[], float output[], int InH, int InW, int C, LayerPrecision precision)
+{
+    if (precision == LAYER_FP32) {
+        global_average_pooling(input, output, InH, InW, C);
+    } else {
+        global_average_pooling_half(half_buffer(input), output, InH, InW, C, half_format(precision));
+    }
+}
+
+//--------------------------------------------------------------------------
+// Mixed-Precision Xception
+//--------------------------------------------------------------------------
+void xception_mixed(InferenceContext& ctx, const PrecisionPolicy& policy,
+                    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+                    float output_logits[NUM_CLASSES])
+{
+    const LayerPrecision* p = policy.layer;
+    const SimdKernels& simd = simd_kernels();
+
+    // Same buffer roles as xception_inference(); a 16-bit conv1 reads the
+    // image rounded into buf_block_out1, which nothing writes before conv1
+    // has read it
+    const float* image = input_image;
+    if (p[POLICY_CONV1] != LAYER_FP32) {
+        simd.float_to_half[half_format(p[POLICY_CONV1])](INPUT_H * INPUT_W * INPUT_C, input_image,
+                                                         half_buffer(ctx.buf_block_out1));
+        image = ctx.buf_block_out1;
+    }
+
+    // === Entry Flow ===
+    mixed_convolution(image, entry_conv1_weights, entry_conv1_biases, ctx.buf_conv1,
+                      INPUT_H, INPUT_W, INPUT_C, CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT,
+                      3, 2, 1, true, p[POLICY_CONV1]);
+    const float* conv1 = mixed_input(ctx.buf_conv1, p[POLICY_CONV1], p[POLICY_CONV2], 0, BUF_CONV1_SIZE);
+    mixed_convolution(conv1, entry_conv2_weights, entry_conv2_biases, ctx.buf_conv2,
+                      CONV1_H_OUT, CONV1_W_OUT, CONV1_C_OUT, CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT,
+                      3, 1, 1, true, p[POLICY_CONV2]);
+
+    // --- Block 1: residual and main paths as concurrent branches, each
+    // with its own conversion slot ---
+    const int block1_size = B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT;
+    const double block1_cost = (double)B1_POOL_H_OUT * B1_POOL_W_OUT * CONV2_C_OUT * B1_SEP2_C_OUT +
+        (double)CONV2_H_OUT * CONV2_W_OUT * (CONV2_C_OUT * (9 + B1_SEP1_C_OUT) + B1_SEP1_C_OUT * (9 + B1_SEP2_C_OUT));
+    parallel_branches(block1_cost, {
+        [&] {
+            // Residual Path (Conv 1x1, S=2)
+            const float* in = mixed_input(ctx.buf_conv2, p[POLICY_CONV2], p[POLICY_BLOCK1_RESIDUAL], 0, BUF_CONV2_SIZE);
+            mixed_convolution(in, entry_b1_res_conv_weights, entry_b1_res_conv_biases, ctx.buf_res_conv,
+                              CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_POOL_H_OUT, B1_POOL_W_OUT, B1_SEP2_C_OUT,
+                              1, 2, 0, false, p[POLICY_BLOCK1_RESIDUAL]);
+        },
+        [&] {
+            // Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2)
+            const float* in = mixed_input(ctx.buf_conv2, p[POLICY_CONV2], p[POLICY_BLOCK1_SEP1], 1, BUF_CONV2_SIZE);
+            mixed_separable(in, ctx.buf_block_out1, CONV2_H_OUT, CONV2_W_OUT, CONV2_C_OUT, B1_SEP1_C_OUT,
+                            entry_b1_sep1_dw_weights, false,
+                            entry_b1_sep1_pw_weights, entry_b1_sep1_pw_biases, true,
+                            ctx.buf_sep_dw, p[POLICY_BLOCK1_SEP1]);
+            in = mixed_input(ctx.buf_block_out1, p[POLICY_BLOCK1_SEP1], p[POLICY_BLOCK1_SEP2], 1,
+                             CONV2_H_OUT * CONV2_W_OUT * B1_SEP1_C_OUT);
+            mixed_separable(in, ctx.buf_block_out2, CONV2_H_OUT, CONV2_W_OUT, B1_SEP1_C_OUT, B1_SEP2_C_OUT,
+                            entry_b1_sep2_dw_weights, false,
+                            entry_b1_sep2_pw_weights, entry_b1_sep2_pw_biases, false,
+                            ctx.buf_sep_dw, p[POLICY_BLOCK1_SEP2]);
+            mixed_max_pooling(ctx.buf_block_out2, ctx.buf_block_out1, CONV2_H_OUT, CONV2_W_OUT, B1_SEP2_C_OUT,
+                              B1_POOL_H_OUT, B1_POOL_W_OUT, 3, 2, p[POLICY_BLOCK1_SEP2]);
+        }
+    });
+    const float* res = mixed_input(ctx.buf_res_conv, p[POLICY_BLOCK1_RESIDUAL], p[POLICY_BLOCK1_SEP2], 0, block1_size);
+    mixed_add(ctx.buf_block_out1, res, ctx.buf_block_in, block1_size, p[POLICY_BLOCK1_SEP2]);
+    LayerPrecision block_in = p[POLICY_BLOCK1_SEP2]; // Precision buf_block_in is stored at
+
+    // (Blocks 2 and 3 are omitted, as in xception_inference())
+
+    // === Middle Flow (Repeat 8 times) ===
+    for (int i = 0; i < 8; ++i) {
+        memcpy(ctx.buf_res_conv, ctx.buf_block_in, BUF_MIDDLE_SIZE * precision_bytes(block_in));
+        const float* in = mixed_input(ctx.buf_block_in, block_in, p[POLICY_MIDDLE_SEP1], 0, BUF_MIDDLE_SIZE);
+        mixed_separable(in, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                        middle_b4_sep1_dw_weights, true,
+                        middle_b4_sep1_pw_weights, middle_b4_sep1_pw_biases, true,
+                        ctx.buf_sep_dw, p[POLICY_MIDDLE_SEP1]);
+        in = mixed_input(ctx.buf_block_out1, p[POLICY_MIDDLE_SEP1], p[POLICY_MIDDLE_SEP2], 0, BUF_MIDDLE_SIZE);
+        mixed_separable(in, ctx.buf_block_out2, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                        middle_b4_sep2_dw_weights, true,
+                        middle_b4_sep2_pw_weights, middle_b4_sep2_pw_biases, true,
+                        ctx.buf_sep_dw, p[POLICY_MIDDLE_SEP2]);
+        in = mixed_input(ctx.buf_block_out2, p[POLICY_MIDDLE_SEP2], p[POLICY_MIDDLE_SEP3], 0, BUF_MIDDLE_SIZE);
+        mixed_separable(in, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, MIDDLE_C,
+                        middle_b4_sep3_dw_weights, true,
+                        middle_b4_sep3_pw_weights, middle_b4_sep3_pw_biases, false,
+                        ctx.buf_sep_dw, p[POLICY_MIDDLE_SEP3]);
+        res = mixed_input(ctx.buf_res_conv, block_in, p[POLICY_MIDDLE_SEP3], 0, BUF_MIDDLE_SIZE);
+        mixed_add(ctx.buf_block_out1, res, ctx.buf_block_in, BUF_MIDDLE_SIZE, p[POLICY_MIDDLE_SEP3]);
+        block_in = p[POLICY_MIDDLE_SEP3];
+    }
+
+    // === Exit Flow ===
+    // --- Block 12: residual and main paths as concurrent branches, as in
+    // block 1, both reading the middle-flow output ---
+    const int block12_size = B5_POOL_H_OUT * B5_POOL_W_OUT * B5_SEP2_C_OUT;
+    const double block12_cost = (double)B5_POOL_H_OUT * B5_POOL_W_OUT * MIDDLE_C * B5_SEP2_C_OUT +
+        (double)MIDDLE_H * MIDDLE_W * (MIDDLE_C * (9 + B5_SEP1_C_OUT) + B5_SEP1_C_OUT * (9 + B5_SEP2_C_OUT));
+    parallel_branches(block12_cost, {
+        [&] {
+            // Residual Path (Conv 1x1, S=2)
+            const float* in = mixed_input(ctx.buf_block_in, block_in, p[POLICY_BLOCK12_RESIDUAL], 0, BUF_MIDDLE_SIZE);
+            mixed_convolution(in, exit_b12_res_conv_weights, exit_b12_res_conv_biases, ctx.buf_res_conv,
+                              MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT,
+                              1, 2, 0, false, p[POLICY_BLOCK12_RESIDUAL]);
+        },
+        [&] {
+            // Main Path: SepConv1 -> ReLU -> SepConv2 -> MaxPool (S=2)
+            const float* in = mixed_input(ctx.buf_block_in, block_in, p[POLICY_BLOCK12_SEP1], 1, BUF_MIDDLE_SIZE);
+            mixed_separable(in, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, MIDDLE_C, B5_SEP1_C_OUT,
+                            exit_b12_sep1_dw_weights, false,
+                            exit_b12_sep1_pw_weights, exit_b12_sep1_pw_biases, true,
+                            ctx.buf_sep_dw, p[POLICY_BLOCK12_SEP1]);
+            in = mixed_input(ctx.buf_block_out1, p[POLICY_BLOCK12_SEP1], p[POLICY_BLOCK12_SEP2], 1,
+                             MIDDLE_H * MIDDLE_W * B5_SEP1_C_OUT);
+            mixed_separable(in, ctx.buf_block_out2, MIDDLE_H, MIDDLE_W, B5_SEP1_C_OUT, B5_SEP2_C_OUT,
+                            exit_b12_sep2_dw_weights, false,
+                            exit_b12_sep2_pw_weights, exit_b12_sep2_pw_biases, false,
+                            ctx.buf_sep_dw, p[POLICY_BLOCK12_SEP2]);
+            mixed_max_pooling(ctx.buf_block_out2, ctx.buf_block_out1, MIDDLE_H, MIDDLE_W, B5_SEP2_C_OUT,
+                              B5_POOL_H_OUT, B5_POOL_W_OUT, 3, 2, p[POLICY_BLOCK12_SEP2]);
+        }
+    });
+    res = mixed_input(ctx.buf_res_conv, p[POLICY_BLOCK12_RESIDUAL], p[POLICY_BLOCK12_SEP2], 0, block12_size);
+    mixed_add(ctx.buf_block_out1, res, ctx.buf_final_block, block12_size, p[POLICY_BLOCK12_SEP2]);
+
+    // Block 13: two separable convs, no residual, no pool, on block 12's sum
+    const float* in = mixed_input(ctx.buf_final_block, p[POLICY_BLOCK12_SEP2], p[POLICY_BLOCK13_SEP1], 0,
+                                  block12_size);
+    mixed_separable(in, ctx.buf_block_out1, B5_POOL_H_OUT, B5_POOL_W_OUT, B5_SEP2_C_OUT, B6_SEP1_C_OUT,
+                    exit_b13_sep1_dw_weights, true,
+                    exit_b13_sep1_pw_weights, exit_b13_sep1_pw_biases, true,
+                    ctx.buf_sep_dw, p[POLICY_BLOCK13_SEP1]);
+    in = mixed_input(ctx.buf_block_out1, p[POLICY_BLOCK13_SEP1], p[POLICY_BLOCK13_SEP2], 0,
+                     B6_H_OUT * B6_W_OUT * B6_SEP1_C_OUT);
+    mixed_separable(in, ctx.buf_final_block, B6_H_OUT, B6_W_OUT, B6_SEP1_C_OUT, B6_SEP2_C_OUT,
+                    exit_b13_sep2_dw_weights, true,
+                    exit_b13_sep2_pw_weights, exit_b13_sep2_pw_biases, true,
+                    ctx.buf_sep_dw, p[POLICY_BLOCK13_SEP2]);
+
+    // GAP into fp32, then the classifier: a 16-bit one rounds the GAP vector
+    // into buf_block_out1 and its logits into buf_block_out2
+    mixed_global_average_pooling(ctx.buf_final_block, ctx.buf_gap, B6_H_OUT, B6_W_OUT, B6_SEP2_C_OUT,
+                                 p[POLICY_BLOCK13_SEP2]);
+    if (p[POLICY_CLASSIFIER] == LAYER_FP32) {
+        convolution_fixed<1, 1, GAP_OUT_SIZE, NUM_CLASSES, 1, 1, 0>(
+            ctx.buf_gap, final_conv_weights, final_conv_biases, output_logits, false);
+    } else {
+        const HalfFormat format = half_format(p[POLICY_CLASSIFIER]);
+        simd.float_to_half[format](GAP_OUT_SIZE, ctx.buf_gap, half_buffer(ctx.buf_block_out1));
+        pointwise_convolution_half(half_buffer(ctx.buf_block_out1), final_conv_weights, final_conv_biases,
+                                   half_buffer(ctx.buf_block_out2), 1, GAP_OUT_SIZE, NUM_CLASSES, false, format);
+        simd.half_to_float[format](NUM_CLASSES, half_buffer(ctx.buf_block_out2), output_logits);
+    }
+}
+
+//--------------------------------------------------------------------------
+// 16-Bit Xception
+//--------------------------------------------------------------------------
+void xception_half(InferenceContext& ctx, const float input_image[INPUT_H * INPUT_W * INPUT_C],
+                   float output_logits[NUM_CLASSES], HalfFormat format)
+{
+    // Every map and weight matrix at `format`; GAP output and classifier fp32
+    PrecisionPolicy policy = uniform_precision_policy((format == HALF_BF16) ? LAYER_BF16 : LAYER_FP16);
+    policy.layer[POLICY_CLASSIFIER] = LAYER_FP32;
+    xception_mixed(ctx, policy, input_image, output_logits);
+}
+
+#endif // __SYNTHESIS__
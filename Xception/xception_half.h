@@ -0,0 +1,62 @@
+#ifndef XCEPTION_HALF_H
+#define XCEPTION_HALF_H
+
+#include "xception.h"
+#include "xception_precision.h"
+#include "xception_simd.h" // For HalfFormat
+
+// ==========================================================================
+// === FP16 / BF16 Storage (Host Builds Only) ===============================
+// ==========================================================================
+// Xception moves far more bytes than it computes on: its weights run to tens
+// of MB and the entry-flow maps to over a million values (buf_conv2), so
+// memory bandwidth, not FLOPs, limits the host path. xception_half() runs the
+// xception_inference() layer sequence with every weight matrix and every
+// inter-layer map stored as 16-bit fp16 or bf16, halving the bytes each
+// layer moves. Values are widened to fp32 only in cache-sized scratch, as
+// the kernels pack or stage them; products and sums stay fp32 and each layer
+// output is rounded once, when it is stored:
+//   - Convolutions: convolution_gemm_half() / pointwise_convolution_half()
+//     (xception_gemm.h) on 16-bit weight panels from the weight store,
+//     through the fp32 SGEMM micro-kernel.
+//   - Depthwise convolution, max pooling, residual adds and GAP widen one
+//     channel plane (or block) at a time into fp32 scratch, run the fp32
+//     SIMD kernels on it and round the result.
+// The image is rounded on entry. Depthwise weights (9 per channel), biases,
+// the GAP output and the classifier stay fp32. The 16-bit maps live in the
+// context's float buffers, each of which holds twice as many halves.
+//
+// fp16 keeps 3 more mantissa bits than bf16 but tops out at 65504, so it
+// suits trained, normalized activations; bf16 has the range of fp32.
+//
+// xception_mixed() runs the same layers with a precision per layer
+// (xception_precision.h): fp32 layers on the float kernels of xception.cpp,
+// 16-bit layers as above. A map whose consumer runs at another precision is
+// converted, in blocks, into per-thread scratch. xception_half() is the
+// policy with every layer at one 16-bit format but the classifier.
+// ==========================================================================
+
+// Arithmetic xception_inference() (and so Xception()) uses on the host
+enum InferencePrecision {
+    PRECISION_FP32,  // Float weights and maps (default)
+    PRECISION_FP16,  // xception_half() with IEEE half storage
+    PRECISION_BF16,  // xception_half() with bfloat16 storage
+    PRECISION_MIXED  // xception_mixed() under precision_policy() (xception_precision.h)
+};
+
+// Select the precision at init, before inferences run. Every SIMD level
+// supports both formats (F16C / AVX512-BF16 where the CPU has them).
+// set_precision_policy() selects PRECISION_MIXED along with its policy.
+void set_inference_precision(InferencePrecision precision);
+InferencePrecision inference_precision();
+
+// The 16-bit network on the caller's context
+void xception_half(InferenceContext& ctx, const float input_image[INPUT_H * INPUT_W * INPUT_C],
+                   float output_logits[NUM_CLASSES], HalfFormat format);
+
+// The network under a per-layer policy on the caller's context
+void xception_mixed(InferenceContext& ctx, const PrecisionPolicy& policy,
+                    const float input_image[INPUT_H * INPUT_W * INPUT_C],
+                    float output_logits[NUM_CLASSES]);
+
+#endif // XCEPTION_HALF_H
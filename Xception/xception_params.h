@@ -84,12 +84,26 @@
 #define BUF_ENTRY_MAX_SIZE (B3_POOL_H_OUT * B3_POOL_W_OUT * B3_SEP2_C_OUT) // 19*19*728 = 262808 (Max size in Entry Flow before Middle)
 #define BUF_MIDDLE_SIZE (MIDDLE_H * MIDDLE_W * MIDDLE_C)             // 19*19*728 = 262808
 #define BUF_EXIT_MAX_SIZE (B6_H_OUT * B6_W_OUT * B6_SEP2_C_OUT)        // 10*10*2048 = 204800 (Max size in Exit Flow before GAP)
+#define BUF_BLOCK_MAX_SIZE (CONV2_H_OUT * CONV2_W_OUT * B1_SEP2_C_OUT)   // 150*150*128 = 2880000 (Block 1 sep conv outputs, before pool)
+#define BUF_RESIDUAL_MAX_SIZE (B1_POOL_H_OUT * B1_POOL_W_OUT * B1_SEP2_C_OUT) // 75*75*128 = 720000 (Block 1 residual conv / sum)
 
 // Buffers for separable conv intermediate results (depthwise output)
 // Size based on largest possible intermediate map before pointwise
-#define MAX_SEP_DW_SIZE (MIDDLE_H * MIDDLE_W * MIDDLE_C) // Middle flow sep conv1 output: 19*19*728
+#define MAX_SEP_DW_SIZE (CONV2_H_OUT * CONV2_W_OUT * B1_SEP1_C_OUT) // Block 1 sep conv2 depthwise output: 150*150*128
 
 // Buffers for residual connections (needs to hold input to a block)
 #define MAX_RESIDUAL_SIZE (BUF_MIDDLE_SIZE) // Max size of a block's input
 
+// Row buffer of the separable 3x3/stride-2 pool (one row of horizontal maxima)
+#define POOL_MAX_W_OUT B1_POOL_W_OUT // 75, the widest pool output
+
+// Fixed-point network (xception_fixed_point.h): ap_fixed<W, I> widths.
+// Maps, weights and biases are ap_fixed<16,6> (range +-32, step 2^-10);
+// sums keep a product's 20 fraction bits exactly, with 16 integer bits of
+// headroom for the 2048-channel reductions (fits the DSP48 accumulator)
+#define FIXED_DATA_W 16
+#define FIXED_DATA_I 6
+#define FIXED_ACC_W 36
+#define FIXED_ACC_I 16
+
 #endif // XCEPTION_PARAMS_H
\ No newline at end of file
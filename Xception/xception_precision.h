@@ -0,0 +1,123 @@
+#ifndef XCEPTION_PRECISION_H
+#define XCEPTION_PRECISION_H
+
+#include "xception_params.h"
+
+// ==========================================================================
+// === Per-Layer Mixed Precision (Host Builds Only) =========================
+// ==========================================================================
+// A precision policy gives every layer of Xception() its own storage: fp32
+// (the float layers of xception.cpp) or fp16 / bf16 (the 16-bit kernels of
+// xception_half.h). Pools, residual adds and the GAP run at the precision of
+// the layer producing their input: the block 1 pool and add at block1/sep2's,
+// each middle-flow add at middle/sep3's, the block 12 pool and add at
+// block12/sep2's, the GAP at block13/sep2's.
+// xception_mixed() converts a map wherever its producer and its consumer
+// disagree; a 16-bit classifier rounds the GAP vector and widens the logits.
+//
+// Policies are read from a text file, one "<layer> <precision>" pair per
+// line; "default <precision>" covers the layers that are not named, and
+// layers left out without a default run fp32. '#' starts a comment.
+//   # Keep the first and last layer in float
+//   default    fp16
+//   conv1      fp32
+//   classifier fp32
+//
+// The sweep runs a validation set under a list of policies and measures
+// each one's mean latency, its top-1 change and its largest logit change
+// against fp32, so the fastest policy within an accuracy budget can be
+// picked.
+// ==========================================================================
+
+// Storage of one layer's weights and output map
+enum LayerPrecision {
+    LAYER_FP32,
+    LAYER_FP16,
+    LAYER_BF16,
+    LAYER_NUM_PRECISIONS
+};
+
+// Layers with their own precision, named as in the calibration scale file
+enum PolicyLayer {
+    POLICY_CONV1, POLICY_CONV2,
+    POLICY_BLOCK1_RESIDUAL,
+    POLICY_BLOCK1_SEP1,
+    POLICY_BLOCK1_SEP2,      // + the block 1 pool and add
+    POLICY_MIDDLE_SEP1, POLICY_MIDDLE_SEP2,
+    POLICY_MIDDLE_SEP3,      // + the middle-flow add
+    POLICY_BLOCK12_RESIDUAL,
+    POLICY_BLOCK12_SEP1,
+    POLICY_BLOCK12_SEP2,     // + the block 12 pool and add
+    POLICY_BLOCK13_SEP1,
+    POLICY_BLOCK13_SEP2,     // + GAP
+    POLICY_CLASSIFIER,
+    POLICY_NUM_LAYERS
+};
+
+struct PrecisionPolicy {
+    LayerPrecision layer[POLICY_NUM_LAYERS];
+};
+
+// Names used in policy files ("conv1", "block1/residual", ..., "classifier";
+// "fp32", "fp16", "bf16")
+const char* policy_layer_name(int layer);
+const char* layer_precision_name(int precision);
+
+// Every layer at one precision
+PrecisionPolicy uniform_precision_policy(LayerPrecision precision);
+
+// Read a policy file. False, with `policy` unchanged, if the file cannot be
+// read or names an unknown layer or precision.
+bool precision_policy_load(const char* path, PrecisionPolicy& policy);
+
+// Write every layer's precision in the same format. False on I/O errors.
+bool precision_policy_write(const char* path, const PrecisionPolicy& policy);
+
+// One-line description: the most common precision, then the exceptions
+// ("fp16 except conv1=fp32,classifier=fp32")
+void precision_policy_label(const PrecisionPolicy& policy, char label[], int size);
+
+// Run Xception() under this policy: an all-fp32 policy selects
+// PRECISION_FP32, anything else PRECISION_MIXED (xception_half.h). (A 16-bit
+// policy with an fp32 classifier is the network PRECISION_FP16 / BF16 runs.)
+void set_precision_policy(const PrecisionPolicy& policy);
+const PrecisionPolicy& precision_policy();
+
+//--------------------------------------------------------------------------
+// Latency / Accuracy Sweep
+//--------------------------------------------------------------------------
+#define PRECISION_MAX_CANDIDATES (1 + 2 * (POLICY_NUM_LAYERS + 2)) // Policies precision_policy_candidates() returns
+
+// The standard candidates: uniform fp32, fp16 and bf16, each 16-bit format
+// with each single layer kept in fp32 (which layers are sensitive), and each
+// with both conv1 and the classifier in fp32. Returns the count.
+int precision_policy_candidates(PrecisionPolicy policies[PRECISION_MAX_CANDIDATES]);
+
+struct PrecisionSweepResult {
+    PrecisionPolicy policy;
+    double ms_per_image;    // Mean Xception() latency over the set
+    double top1;            // Top-1 accuracy against the labels (agreement with fp32 without labels)
+    double top1_delta;      // top1 minus fp32's
+    double max_logit_error; // Largest |logit - fp32 logit| over the set (meaningful even when classes tie)
+};
+
+// Run N images (INPUT_H x INPUT_W x INPUT_C each) under fp32 and then under
+// each policy: one untimed warm-up call (weight packing), then the timed
+// pass. Without labels (NULL), top-1 is the fraction of images whose class
+// matches fp32's. The selected precision and policy are restored
+// afterwards. Returns the index of the fastest policy with
+// top1_delta >= -budget, or -1 if none is.
+int xception_precision_sweep(int N, const float images[], const int labels[],
+                             const PrecisionPolicy policies[], int count, double budget,
+                             PrecisionSweepResult results[]);
+
+// The sweep tool: the candidates over a validation directory of raw images
+// (as xception_calibrate_directory(); with a "labels.txt" of
+// "<file name> <class>" lines, top-1 is measured against it). Writes the
+// report, fastest first, to report_path, and the fastest policy within the
+// budget to policy_path (a policy file). Returns the number of images used,
+// or -1 if there are none or a file cannot be written.
+int xception_precision_sweep_directory(const char* dir, double budget,
+                                       const char* report_path, const char* policy_path);
+
+#endif // XCEPTION_PRECISION_H
@@ -0,0 +1,802 @@
+#include "xception_simd.h"
+#include "xception_gemm.h" // For SGEMM_MR
+#include "xception_threads.h"
+
+#ifndef __SYNTHESIS__ // Host-side kernels only
+
+#include <algorithm> // For std::min, std::max
+#include <atomic>    // For std::atomic
+#include <cfloat>    // For FLT_MAX
+#include <cstring>   // For memcpy
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86 1
+#endif
+
+//--------------------------------------------------------------------------
+// Scalar Kernels (portable fallback)
+//--------------------------------------------------------------------------
+#define SCALAR_NR 16
+
+// --- 16-Bit Storage Conversions ---
+static inline float float_from_bits(uint32_t u) {
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+static inline uint32_t bits_from_float(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static float fp16_to_float(uint16_t h) {
+    const uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    const uint32_t exp = (h >> 10) & 0x1F;
+    const uint32_t mant = h & 0x3FF;
+    if (exp == 0x1F) { // Inf / NaN (NaNs come back quiet, as with vcvtph2ps)
+        return float_from_bits(sign | 0x7F800000 | (mant << 13) | (mant ? 0x400000 : 0));
+    }
+    if (exp == 0) { // Zero / subnormal: mant * 2^-24, exact in fp32
+        float v = (float)mant * (1.0f / 16777216.0f);
+        return float_from_bits(sign | bits_from_float(v));
+    }
+    return float_from_bits(sign | ((exp + 112) << 23) | (mant << 13));
+}
+
+static uint16_t fp16_from_float(float f) {
+    const uint32_t x = bits_from_float(f);
+    const uint32_t sign = (x >> 16) & 0x8000;
+    const uint32_t abs = x & 0x7FFFFFFF;
+    if (abs > 0x7F800000) { // NaN: quiet, payload truncated
+        return (uint16_t)(sign | 0x7E00 | ((abs >> 13) & 0x3FF));
+    }
+    if (abs >= 0x47800000) { // >= 65536 (and Inf): overflows to Inf
+        return (uint16_t)(sign | 0x7C00);
+    }
+    if (abs < 0x38800000) { // Below 2^-14: subnormal result in units of 2^-24
+        if (abs < 0x33000000) { // Below 2^-25 (ties to the even zero)
+            return (uint16_t)sign;
+        }
+        const int shift = 126 - (int)(abs >> 23); // 14..24
+        const uint32_t mant = (abs & 0x7FFFFF) | 0x800000;
+        uint32_t r = mant >> shift;
+        const uint32_t rem = mant & ((1u << shift) - 1);
+        const uint32_t half = 1u << (shift - 1);
+        r += (rem > half || (rem == half && (r & 1)));
+        return (uint16_t)(sign | r);
+    }
+    // Normal: rebias the exponent, round the 13 dropped bits to nearest even
+    // (a carry out of the mantissa correctly bumps the exponent, up to Inf)
+    uint32_t r = (abs - 0x38000000) >> 13;
+    const uint32_t rem = abs & 0x1FFF;
+    r += (rem > 0x1000 || (rem == 0x1000 && (r & 1)));
+    return (uint16_t)(sign | r);
+}
+
+static float bf16_to_float(uint16_t h) {
+    return float_from_bits((uint32_t)h << 16);
+}
+
+static uint16_t bf16_from_float(float f) {
+    const uint32_t x = bits_from_float(f);
+    if ((x & 0x7FFFFFFF) > 0x7F800000) { // NaN: quiet
+        return (uint16_t)((x >> 16) | 0x40);
+    }
+    if ((x & 0x7F800000) == 0) { // Zero / denormal: signed zero
+        return (uint16_t)((x >> 16) & 0x8000);
+    }
+    return (uint16_t)((x + 0x7FFF + ((x >> 16) & 1)) >> 16);
+}
+
+template<HalfFormat F>
+static inline float half_scalar_to_float(uint16_t h) {
+    return (F == HALF_FP16) ? fp16_to_float(h) : bf16_to_float(h);
+}
+
+template<HalfFormat F>
+static inline uint16_t half_scalar_from_float(float f) {
+    return (F == HALF_FP16) ? fp16_from_float(f) : bf16_from_float(f);
+}
+
+template<HalfFormat F>
+static void half_to_float_scalar(int n, const uint16_t x[], float r[]) {
+    for (int i = 0; i < n; ++i) r[i] = half_scalar_to_float<F>(x[i]);
+}
+
+template<HalfFormat F>
+static void float_to_half_scalar(int n, const float x[], uint16_t r[]) {
+    for (int i = 0; i < n; ++i) r[i] = half_scalar_from_float<F>(x[i]);
+}
+
+static void sgemm_tile_scalar(int kc, const float A[], const float B[], int ldb,
+                              float C[], int ldc, const float bias[],
+                              bool accumulate, bool apply_relu)
+{
+    float acc[SGEMM_MR][SCALAR_NR] = {};
+
+    for (int k = 0; k < kc; ++k) {
+        // Fully unrolled rows keep the whole tile in vector registers
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            float a = A[i];
+            for (int j = 0; j < SCALAR_NR; ++j) {
+                acc[i][j] += a * B[j];
+            }
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float init = bias ? bias[i] : 0.0f;
+        for (int j = 0; j < SCALAR_NR; ++j) {
+            float v = acc[i][j] + (accumulate ? C[i * ldc + j] : init);
+            C[i * ldc + j] = (apply_relu && v < 0.0f) ? 0.0f : v;
+        }
+    }
+}
+
+static void axpy_scalar(int n, float a, const float x[], float y[]) {
+    for (int i = 0; i < n; ++i) y[i] += a * x[i];
+}
+
+static void vmax_scalar(int n, const float a[], const float b[], float r[]) {
+    for (int i = 0; i < n; ++i) r[i] = (a[i] > b[i]) ? a[i] : b[i];
+}
+
+static void vadd_scalar(int n, const float a[], const float b[], float r[]) {
+    for (int i = 0; i < n; ++i) r[i] = a[i] + b[i];
+}
+
+static float vsum_scalar(int n, const float x[]) {
+    float sum = 0.0f;
+    for (int i = 0; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+static void hmax3s2_scalar(int n, int lanes, const float a[], float r[]) {
+    for (int i = 0; i < n; ++i) {
+        const float* p = a + 2 * i * lanes;
+        for (int l = 0; l < lanes; ++l) {
+            r[i * lanes + l] = std::max(std::max(p[l], p[lanes + l]), p[2 * lanes + l]);
+        }
+    }
+}
+
+static const SimdKernels scalar_kernels = {
+    SIMD_SCALAR, "scalar", SCALAR_NR, sgemm_tile_scalar,
+    axpy_scalar, vmax_scalar, vadd_scalar, vsum_scalar, hmax3s2_scalar,
+    {half_to_float_scalar<HALF_FP16>, half_to_float_scalar<HALF_BF16>},
+    {float_to_half_scalar<HALF_FP16>, float_to_half_scalar<HALF_BF16>}
+};
+
+#ifdef SIMD_X86
+//--------------------------------------------------------------------------
+// AVX2 + FMA Kernels (8 floats per vector)
+//--------------------------------------------------------------------------
+#define AVX2_TARGET __attribute__((target("avx2,fma,f16c")))
+#define AVX2_NR 16
+
+// Eight 16-bit values <-> eight floats (F16C for fp16; bf16 is a shift, and
+// its rounding the integer form of bf16_from_float)
+template<HalfFormat F>
+AVX2_TARGET
+static inline __m256 widen8_avx2(__m128i h) {
+    if (F == HALF_FP16) {
+        return _mm256_cvtph_ps(h);
+    }
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+}
+
+template<HalfFormat F>
+AVX2_TARGET
+static inline __m128i narrow8_avx2(__m256 v) {
+    if (F == HALF_FP16) {
+        return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    const __m256i x = _mm256_castps_si256(v);
+    const __m256i hi = _mm256_srli_epi32(x, 16);
+    __m256i r = _mm256_add_epi32(x, _mm256_add_epi32(_mm256_set1_epi32(0x7FFF),
+                                                     _mm256_and_si256(hi, _mm256_set1_epi32(1))));
+    r = _mm256_srli_epi32(r, 16);
+    const __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7FFFFFFF)),
+                                           _mm256_set1_epi32(0x7F800000));
+    const __m256i tiny = _mm256_cmpeq_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7F800000)),
+                                            _mm256_setzero_si256());
+    r = _mm256_blendv_epi8(r, _mm256_or_si256(hi, _mm256_set1_epi32(0x40)), nan);
+    r = _mm256_blendv_epi8(r, _mm256_and_si256(hi, _mm256_set1_epi32(0x8000)), tiny);
+    // Pack the 32-bit lanes to 16 bits (values fit, so no saturation), then
+    // undo packus' per-128-bit-lane interleave
+    r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm256_castsi256_si128(r);
+}
+
+template<HalfFormat F>
+AVX2_TARGET
+static void half_to_float_avx2(int n, const uint16_t x[], float r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i, widen8_avx2<F>(_mm_loadu_si128((const __m128i*)(x + i))));
+    }
+    half_to_float_scalar<F>(n - i, x + i, r + i);
+}
+
+template<HalfFormat F>
+AVX2_TARGET
+static void float_to_half_avx2(int n, const float x[], uint16_t r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm_storeu_si128((__m128i*)(r + i), narrow8_avx2<F>(_mm256_loadu_ps(x + i)));
+    }
+    float_to_half_scalar<F>(n - i, x + i, r + i);
+}
+
+// 6x16 tile: 12 ymm accumulators + 2 B vectors + 1 broadcast
+AVX2_TARGET
+static void sgemm_tile_avx2(int kc, const float A[], const float B[], int ldb,
+                            float C[], int ldc, const float bias[],
+                            bool accumulate, bool apply_relu)
+{
+    __m256 c[SGEMM_MR][2];
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        c[i][0] = _mm256_setzero_ps();
+        c[i][1] = _mm256_setzero_ps();
+    }
+
+    for (int k = 0; k < kc; ++k) {
+        __m256 b0 = _mm256_loadu_ps(B);
+        __m256 b1 = _mm256_loadu_ps(B + 8);
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            __m256 a = _mm256_broadcast_ss(A + i);
+            c[i][0] = _mm256_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm256_fmadd_ps(a, b1, c[i][1]);
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float* row = C + i * ldc;
+        __m256 init0, init1;
+        if (accumulate) {
+            init0 = _mm256_loadu_ps(row);
+            init1 = _mm256_loadu_ps(row + 8);
+        } else {
+            init0 = init1 = _mm256_set1_ps(bias ? bias[i] : 0.0f);
+        }
+        __m256 v0 = _mm256_add_ps(c[i][0], init0);
+        __m256 v1 = _mm256_add_ps(c[i][1], init1);
+        if (apply_relu) {
+            v0 = _mm256_max_ps(v0, zero);
+            v1 = _mm256_max_ps(v1, zero);
+        }
+        _mm256_storeu_ps(row, v0);
+        _mm256_storeu_ps(row + 8, v1);
+    }
+}
+
+AVX2_TARGET
+static void axpy_avx2(int n, float a, const float x[], float y[]) {
+    __m256 va = _mm256_set1_ps(a);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < n; ++i) y[i] += a * x[i];
+}
+
+AVX2_TARGET
+static void vmax_avx2(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i, _mm256_max_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < n; ++i) r[i] = (a[i] > b[i]) ? a[i] : b[i];
+}
+
+AVX2_TARGET
+static void vadd_avx2(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < n; ++i) r[i] = a[i] + b[i];
+}
+
+AVX2_TARGET
+static float vsum_avx2(int n, const float x[]) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(x + i));
+        acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(x + i + 8));
+    }
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(x + i));
+    }
+    __m256 acc = _mm256_add_ps(acc0, acc1);
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_movehdup_ps(s));
+    float sum = _mm_cvtss_f32(s);
+    for (; i < n; ++i) sum += x[i];
+    return sum;
+}
+
+// Pixels of a multiple of 8 lanes are whole vectors. Plain rows are
+// deinterleaved: the even and odd columns of 16 inputs (and the even columns
+// one pixel to the right, the third tap) come out of in-lane shuffles in the
+// same order, so a single cross-lane permute fixes up the max.
+AVX2_TARGET
+static void hmax3s2_avx2(int n, int lanes, const float a[], float r[]) {
+    if (lanes % 8 == 0) {
+        for (int i = 0; i < n; ++i) {
+            const float* p = a + 2 * i * lanes;
+            for (int l = 0; l < lanes; l += 8) {
+                __m256 m = _mm256_max_ps(_mm256_loadu_ps(p + l), _mm256_loadu_ps(p + lanes + l));
+                _mm256_storeu_ps(r + i * lanes + l, _mm256_max_ps(m, _mm256_loadu_ps(p + 2 * lanes + l)));
+            }
+        }
+        return;
+    }
+    if (lanes != 1) {
+        hmax3s2_scalar(n, lanes, a, r);
+        return;
+    }
+
+    int i = 0;
+    for (; i + 8 < n; i += 8) { // Reads a[2i .. 2i+17]
+        const float* p = a + 2 * i;
+        __m256 lo = _mm256_loadu_ps(p), hi = _mm256_loadu_ps(p + 8);
+        __m256 lo2 = _mm256_loadu_ps(p + 2), hi2 = _mm256_loadu_ps(p + 10);
+        __m256 even = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 odd = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 next = _mm256_shuffle_ps(lo2, hi2, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 m = _mm256_max_ps(_mm256_max_ps(even, odd), next);
+        m = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(m), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(r + i, m);
+    }
+    hmax3s2_scalar(n - i, 1, a + 2 * i, r + i);
+}
+
+static const SimdKernels avx2_kernels = {
+    SIMD_AVX2, "avx2", AVX2_NR, sgemm_tile_avx2,
+    axpy_avx2, vmax_avx2, vadd_avx2, vsum_avx2, hmax3s2_avx2,
+    {half_to_float_avx2<HALF_FP16>, half_to_float_avx2<HALF_BF16>},
+    {float_to_half_avx2<HALF_FP16>, float_to_half_avx2<HALF_BF16>}
+};
+
+//--------------------------------------------------------------------------
+// AVX-512F Kernels (16 floats per vector)
+//--------------------------------------------------------------------------
+#define AVX512_TARGET __attribute__((target("avx512f,f16c")))
+
+// GCC 12's AVX-512 intrinsics seed some results with a self-initialized
+// "undefined" vector, which trips -Wuninitialized when they are inlined
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#define AVX512_NR 32
+
+// 6x32 tile: 12 zmm accumulators, enough independent FMAs to cover latency
+AVX512_TARGET
+static void sgemm_tile_avx512(int kc, const float A[], const float B[], int ldb,
+                              float C[], int ldc, const float bias[],
+                              bool accumulate, bool apply_relu)
+{
+    __m512 c[SGEMM_MR][2];
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        c[i][0] = _mm512_setzero_ps();
+        c[i][1] = _mm512_setzero_ps();
+    }
+
+    for (int k = 0; k < kc; ++k) {
+        __m512 b0 = _mm512_loadu_ps(B);
+        __m512 b1 = _mm512_loadu_ps(B + 16);
+#pragma GCC unroll 16
+        for (int i = 0; i < SGEMM_MR; ++i) {
+            __m512 a = _mm512_set1_ps(A[i]);
+            c[i][0] = _mm512_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm512_fmadd_ps(a, b1, c[i][1]);
+        }
+        A += SGEMM_MR;
+        B += ldb;
+    }
+
+    const __m512 zero = _mm512_setzero_ps();
+#pragma GCC unroll 16
+    for (int i = 0; i < SGEMM_MR; ++i) {
+        float* row = C + i * ldc;
+        __m512 init0, init1;
+        if (accumulate) {
+            init0 = _mm512_loadu_ps(row);
+            init1 = _mm512_loadu_ps(row + 16);
+        } else {
+            init0 = init1 = _mm512_set1_ps(bias ? bias[i] : 0.0f);
+        }
+        __m512 v0 = _mm512_add_ps(c[i][0], init0);
+        __m512 v1 = _mm512_add_ps(c[i][1], init1);
+        if (apply_relu) {
+            v0 = _mm512_max_ps(v0, zero);
+            v1 = _mm512_max_ps(v1, zero);
+        }
+        _mm512_storeu_ps(row, v0);
+        _mm512_storeu_ps(row + 16, v1);
+    }
+}
+
+// Sixteen 16-bit values <-> sixteen floats
+template<HalfFormat F>
+AVX512_TARGET
+static inline __m512 widen16_avx512(__m256i h) {
+    if (F == HALF_FP16) {
+        return _mm512_cvtph_ps(h);
+    }
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+}
+
+template<HalfFormat F>
+AVX512_TARGET
+static inline __m256i narrow16_avx512(__m512 v) {
+    if (F == HALF_FP16) {
+        return _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    const __m512i x = _mm512_castps_si512(v);
+    const __m512i hi = _mm512_srli_epi32(x, 16);
+    __m512i r = _mm512_add_epi32(x, _mm512_add_epi32(_mm512_set1_epi32(0x7FFF),
+                                                     _mm512_and_si512(hi, _mm512_set1_epi32(1))));
+    r = _mm512_srli_epi32(r, 16);
+    const __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(x, _mm512_set1_epi32(0x7FFFFFFF)),
+                                                  _mm512_set1_epi32(0x7F800000));
+    const __mmask16 tiny = _mm512_testn_epi32_mask(x, _mm512_set1_epi32(0x7F800000));
+    r = _mm512_mask_mov_epi32(r, nan, _mm512_or_si512(hi, _mm512_set1_epi32(0x40)));
+    r = _mm512_mask_mov_epi32(r, tiny, _mm512_and_si512(hi, _mm512_set1_epi32(0x8000)));
+    return _mm512_cvtepi32_epi16(r);
+}
+
+template<HalfFormat F>
+AVX512_TARGET
+static void half_to_float_avx512(int n, const uint16_t x[], float r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(r + i, widen16_avx512<F>(_mm256_loadu_si256((const __m256i*)(x + i))));
+    }
+    half_to_float_scalar<F>(n - i, x + i, r + i);
+}
+
+template<HalfFormat F>
+AVX512_TARGET
+static void float_to_half_avx512(int n, const float x[], uint16_t r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm256_storeu_si256((__m256i*)(r + i), narrow16_avx512<F>(_mm512_loadu_ps(x + i)));
+    }
+    float_to_half_scalar<F>(n - i, x + i, r + i);
+}
+
+// Tails use masked loads/stores instead of a scalar loop
+AVX512_TARGET
+static void axpy_avx512(int n, float a, const float x[], float y[]) {
+    __m512 va = _mm512_set1_ps(a);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        __m512 vy = _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(m, x + i), _mm512_maskz_loadu_ps(m, y + i));
+        _mm512_mask_storeu_ps(y + i, m, vy);
+    }
+}
+
+AVX512_TARGET
+static void vmax_avx512(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(r + i, _mm512_max_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(r + i, m, _mm512_max_ps(_mm512_maskz_loadu_ps(m, a + i),
+                                                      _mm512_maskz_loadu_ps(m, b + i)));
+    }
+}
+
+AVX512_TARGET
+static void vadd_avx512(int n, const float a[], const float b[], float r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm512_storeu_ps(r + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        _mm512_mask_storeu_ps(r + i, m, _mm512_add_ps(_mm512_maskz_loadu_ps(m, a + i),
+                                                      _mm512_maskz_loadu_ps(m, b + i)));
+    }
+}
+
+AVX512_TARGET
+static float vsum_avx512(int n, const float x[]) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(x + i));
+        acc1 = _mm512_add_ps(acc1, _mm512_loadu_ps(x + i + 16));
+    }
+    for (; i + 16 <= n; i += 16) {
+        acc0 = _mm512_add_ps(acc0, _mm512_loadu_ps(x + i));
+    }
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        acc1 = _mm512_add_ps(acc1, _mm512_maskz_loadu_ps(m, x + i));
+    }
+    return _mm512_reduce_add_ps(_mm512_add_ps(acc0, acc1));
+}
+
+// Pooled rows are short (at most a few dozen vectors), so AVX-512 machines
+// (which all have AVX2) use the AVX2 row-max kernel
+static const SimdKernels avx512_kernels = {
+    SIMD_AVX512, "avx512", AVX512_NR, sgemm_tile_avx512,
+    axpy_avx512, vmax_avx512, vadd_avx512, vsum_avx512, hmax3s2_avx2,
+    {half_to_float_avx512<HALF_FP16>, half_to_float_avx512<HALF_BF16>},
+    {float_to_half_avx512<HALF_FP16>, float_to_half_avx512<HALF_BF16>}
+};
+
+//--------------------------------------------------------------------------
+// AVX-512 BF16 Kernels (vcvtneps2bf16: 16 floats to bf16 in one instruction)
+//--------------------------------------------------------------------------
+#define AVX512_BF16_TARGET __attribute__((target("avx512f,avx512bf16")))
+
+AVX512_BF16_TARGET
+static void float_to_bf16_avx512bf16(int n, const float x[], uint16_t r[]) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        _mm256_storeu_si256((__m256i*)(r + i), (__m256i)_mm512_cvtneps_pbh(_mm512_loadu_ps(x + i)));
+    }
+    float_to_half_scalar<HALF_BF16>(n - i, x + i, r + i);
+}
+
+// Widening bf16 is a shift, which AVX-512F already does at full width
+static const SimdKernels avx512_bf16_kernels = {
+    SIMD_AVX512_BF16, "avx512-bf16", AVX512_NR, sgemm_tile_avx512,
+    axpy_avx512, vmax_avx512, vadd_avx512, vsum_avx512, hmax3s2_avx2,
+    {half_to_float_avx512<HALF_FP16>, half_to_float_avx512<HALF_BF16>},
+    {float_to_half_avx512<HALF_FP16>, float_to_bf16_avx512bf16}
+};
+#pragma GCC diagnostic pop
+#endif // SIMD_X86
+
+//--------------------------------------------------------------------------
+// Dispatch
+//--------------------------------------------------------------------------
+SimdLevel simd_detect() {
+#ifdef SIMD_X86
+    // __builtin_cpu_supports also checks that the OS saves the wider registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bf16")) {
+        return SIMD_AVX512_BF16;
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("f16c")) {
+        return SIMD_AVX2;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+static const SimdKernels* kernels_for(SimdLevel level) {
+#ifdef SIMD_X86
+    if (level == SIMD_AVX512_BF16) return &avx512_bf16_kernels;
+    if (level == SIMD_AVX512) return &avx512_kernels;
+    if (level == SIMD_AVX2) return &avx2_kernels;
+#endif
+    (void)level;
+    return &scalar_kernels;
+}
+
+// Atomic so inference threads can resolve the default on their first call
+// concurrently (they all store the same table)
+static std::atomic<const SimdKernels*> active_kernels(nullptr);
+
+const SimdKernels& simd_kernels() {
+    const SimdKernels* kernels = active_kernels.load(std::memory_order_acquire);
+    if (!kernels) {
+        kernels = kernels_for(simd_detect());
+        active_kernels.store(kernels, std::memory_order_release);
+    }
+    return *kernels;
+}
+
+bool set_simd_level(SimdLevel level) {
+    if (level > simd_detect()) {
+        return false;
+    }
+    active_kernels.store(kernels_for(level), std::memory_order_release);
+    return true;
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Max Pooling
+//--------------------------------------------------------------------------
+void max_pool_row_3s2(const float row[], int InW, int lanes, float out[], int OutW) {
+    const int full = std::max(0, std::min(OutW, (InW - 1) / 2)); // Windows with all 3 taps
+    simd_kernels().hmax3s2(full, lanes, row, out);
+    for (int ow = full; ow < OutW; ++ow) {
+        int taps = std::min(3, InW - 2 * ow);
+        for (int l = 0; l < lanes; ++l) {
+            float max_val = -FLT_MAX;
+            for (int kw = 0; kw < taps; ++kw) {
+                max_val = std::max(max_val, row[(2 * ow + kw) * lanes + l]);
+            }
+            out[ow * lanes + l] = max_val;
+        }
+    }
+}
+
+// 3x3/stride-2 (the entry/exit block pools): separable. Each input row's horizontal
+// maxima are computed once, and the last row of one window is carried over
+// as the first row of the next, so output row oh only adds rows 2oh+1, 2oh+2.
+static void max_pooling_3x3s2_simd(
+    const SimdKernels& k, const float plane[], int InH, int InW,
+    float out[], int OutH, int OutW)
+{
+    float h_carry[SIMD_MAX_ROW_WIDTH];
+    float h_row[SIMD_MAX_ROW_WIDTH];
+
+    for (int oh = 0; oh < OutH; ++oh) {
+        int ih0 = oh * 2;
+        int rows = std::min(3, InH - ih0);
+        float* out_row = out + oh * OutW;
+        if (rows <= 0) {
+            std::fill(out_row, out_row + OutW, -FLT_MAX);
+            continue;
+        }
+        if (oh == 0) {
+            max_pool_row_3s2(plane, InW, 1, h_carry, OutW);
+        }
+        if (rows == 1) {
+            memcpy(out_row, h_carry, OutW * sizeof(float));
+            continue;
+        }
+        max_pool_row_3s2(plane + (ih0 + 1) * InW, InW, 1, h_row, OutW);
+        k.vmax(OutW, h_carry, h_row, out_row);
+        if (rows == 3) {
+            max_pool_row_3s2(plane + (ih0 + 2) * InW, InW, 1, h_carry, OutW);
+            k.vmax(OutW, out_row, h_carry, out_row);
+        }
+    }
+}
+
+// Other windows, per output row: the KH input rows are reduced with a
+// vertical vector max over the full width, then each window only scans KW
+// adjacent values.
+void max_pooling_simd(
+    const float input[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW)
+{
+    const SimdKernels& k = simd_kernels();
+    // Channel planes are independent work items
+    const double plane_cost = (double)OutH * (KH * InW + OutW * KW);
+    if (KH == 3 && KW == 3 && StrideH == 2 && StrideW == 2) {
+        parallel_for(InC, plane_cost, [&](int c0, int c1) {
+            for (int c = c0; c < c1; ++c) {
+                max_pooling_3x3s2_simd(k, input + c * InH * InW, InH, InW,
+                                       output + c * OutH * OutW, OutH, OutW);
+            }
+        });
+        return;
+    }
+
+    parallel_for(InC, plane_cost, [&](int c0, int c1) {
+        float row_max[SIMD_MAX_ROW_WIDTH];
+
+        for (int c = c0; c < c1; ++c) {
+            const float* plane = input + c * InH * InW;
+            float* out = output + c * OutH * OutW;
+            for (int oh = 0; oh < OutH; ++oh) {
+                int ih0 = oh * StrideH;
+                int rows = std::min(KH, InH - ih0);
+                if (rows <= 0) {
+                    std::fill(out + oh * OutW, out + (oh + 1) * OutW, -FLT_MAX);
+                    continue;
+                }
+                memcpy(row_max, plane + ih0 * InW, InW * sizeof(float));
+                for (int r = 1; r < rows; ++r) {
+                    k.vmax(InW, row_max, plane + (ih0 + r) * InW, row_max);
+                }
+                for (int ow = 0; ow < OutW; ++ow) {
+                    int iw0 = ow * StrideW;
+                    int taps = std::min(KW, InW - iw0);
+                    float max_val = -FLT_MAX;
+                    for (int kw = 0; kw < taps; ++kw) {
+                        max_val = std::max(max_val, row_max[iw0 + kw]);
+                    }
+                    out[oh * OutW + ow] = max_val;
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Global Average Pooling
+//--------------------------------------------------------------------------
+void global_average_pooling_simd(
+    const float input[], float output[], int InH, int InW, int InC)
+{
+    const SimdKernels& k = simd_kernels();
+    const int HW = InH * InW;
+    for (int c = 0; c < InC; ++c) {
+        output[c] = k.vsum(HW, input + c * HW) / (float)HW;
+    }
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Depthwise Convolution (stride 1 along W)
+//--------------------------------------------------------------------------
+void depthwise_convolution_simd(
+    const float input[], const float weights[], const float biases[], float output[],
+    int InH, int InW, int C, int OutH, int OutW,
+    int KH, int KW, int StrideH, int PadH, int PadW,
+    bool apply_relu)
+{
+    const SimdKernels& k = simd_kernels();
+
+    // Channels are independent work items
+    parallel_for(C, (double)OutH * OutW * KH * KW, [&](int c0, int c1) {
+        for (int c = c0; c < c1; ++c) {
+            const float* plane = input + c * InH * InW;
+            const float* w = weights + c * KH * KW;
+            for (int oh = 0; oh < OutH; ++oh) {
+                float* out = output + c * OutH * OutW + oh * OutW;
+                std::fill(out, out + OutW, biases ? biases[c] : 0.0f);
+
+                for (int kh = 0; kh < KH; ++kh) {
+                    int ih = oh * StrideH + kh - PadH;
+                    if (ih < 0 || ih >= InH) {
+                        continue;
+                    }
+                    const float* in_row = plane + ih * InW;
+                    for (int kw = 0; kw < KW; ++kw) {
+                        // Output columns whose tap (ow + kw - PadW) lands inside the row
+                        int ow_lo = std::max(0, PadW - kw);
+                        int ow_hi = std::min(OutW, InW + PadW - kw);
+                        if (ow_hi > ow_lo) {
+                            k.axpy(ow_hi - ow_lo, w[kh * KW + kw],
+                                   in_row + ow_lo + kw - PadW, out + ow_lo);
+                        }
+                    }
+                }
+
+                if (apply_relu) {
+                    for (int ow = 0; ow < OutW; ++ow) {
+                        out[ow] = (out[ow] < 0.0f) ? 0.0f : out[ow];
+                    }
+                }
+            }
+        }
+    });
+}
+
+//--------------------------------------------------------------------------
+// Vectorized Element-wise Addition
+//--------------------------------------------------------------------------
+void add_arrays_simd(const float a[], const float b[], float result[], int size) {
+    simd_kernels().vadd(size, a, b, result);
+}
+
+#endif // __SYNTHESIS__
@@ -0,0 +1,97 @@
+#ifndef XCEPTION_SIMD_H
+#define XCEPTION_SIMD_H
+
+// ==========================================================================
+// === SIMD Kernels with Runtime CPU Dispatch (Host Builds Only) ===========
+// ==========================================================================
+// Every x86 kernel is compiled with a per-function target attribute, so one
+// binary built without -mavx2/-mavx512f carries all variants. The best level
+// the CPU (and OS) supports is picked via cpuid the first time the table is
+// requested; the plain C++ loops are the portable fallback (SIMD_SCALAR).
+// ==========================================================================
+
+#include <cstdint> // For the 16-bit storage operands
+
+enum SimdLevel {
+    SIMD_SCALAR,  // Portable C++ (also the non-x86 path)
+    SIMD_AVX2,    // AVX2 + FMA + F16C (Haswell and newer)
+    SIMD_AVX512,  // AVX-512F (Skylake-SP, Ice Lake and newer)
+    SIMD_AVX512_BF16 // AVX-512F + BF16 (Cooper Lake, Sapphire Rapids, Zen 4)
+};
+
+// 16-bit storage formats of the reduced-precision path (xception_half.h)
+enum HalfFormat {
+    HALF_FP16,  // IEEE binary16: 10-bit mantissa, max 65504
+    HALF_BF16,  // bfloat16: the top half of an fp32 (8-bit mantissa, fp32 range)
+    HALF_NUM_FORMATS
+};
+
+#define SIMD_MAX_NR 32          // Widest SGEMM micro-kernel tile (AVX-512)
+#define SIMD_MAX_ROW_WIDTH 1024 // Longest feature-map row the row-based kernels buffer
+
+// Kernel table for one instruction set
+struct SimdKernels {
+    SimdLevel level;
+    const char* name;
+
+    // SGEMM micro-kernel: full SGEMM_MR x sgemm_nr tile of C (see _gemm.cpp for
+    // the bias/accumulate/ReLU epilogue contract). B rows are ldb floats apart.
+    int sgemm_nr;
+    void (*sgemm_tile)(int kc, const float A[], const float B[], int ldb,
+                       float C[], int ldc, const float bias[],
+                       bool accumulate, bool apply_relu);
+
+    // Streaming primitives over n contiguous floats
+    void (*axpy)(int n, float a, const float x[], float y[]);            // y += a * x
+    void (*vmax)(int n, const float a[], const float b[], float r[]);    // r = max(a, b)
+    void (*vadd)(int n, const float a[], const float b[], float r[]);    // r = a + b
+    float (*vsum)(int n, const float x[]);                               // sum(x)
+
+    // Horizontal pass of a 3x3/stride-2 max pool over a row of pixels that are
+    // `lanes` floats wide (1 for CHW rows): r[i*lanes + l] =
+    // max(a[(2i+t)*lanes + l], t = 0..2) for i < n, so a must hold 2n+1 pixels
+    void (*hmax3s2)(int n, int lanes, const float a[], float r[]);
+
+    // 16-bit storage, indexed by HalfFormat. Conversions of n contiguous
+    // values; narrowing rounds to nearest even (bf16 also flushes fp32
+    // denormals to zero, as vcvtneps2bf16 does), so every level produces the
+    // same bits.
+    void (*half_to_float[HALF_NUM_FORMATS])(int n, const uint16_t x[], float r[]);
+    void (*float_to_half[HALF_NUM_FORMATS])(int n, const float x[], uint16_t r[]);
+};
+
+// Best level supported by this CPU
+SimdLevel simd_detect();
+
+// Active kernel table (selected on first use)
+const SimdKernels& simd_kernels();
+
+// Force a level (e.g. to compare against the scalar fallback).
+// Returns false and keeps the current table if the CPU does not support it.
+bool set_simd_level(SimdLevel level);
+
+// --- Vectorized Layer Kernels (same contracts as the xception.h versions) ---
+void max_pooling_simd(
+    const float input[], float output[],
+    int InH, int InW, int InC, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW);
+
+// Horizontal 3-wide/stride-2 maxima of one row of InW pixels (`lanes` floats
+// each) for OutW outputs; a window clipped at the right edge only takes the
+// pixels that exist
+void max_pool_row_3s2(const float row[], int InW, int lanes, float out[], int OutW);
+
+void global_average_pooling_simd(
+    const float input[], float output[], int InH, int InW, int InC);
+
+// Depthwise convolution, stride 1 in W (the only case xception.cpp routes here):
+// each (channel, output row) is built as a sum of shifted input rows via axpy
+void depthwise_convolution_simd(
+    const float input[], const float weights[], const float biases[], float output[],
+    int InH, int InW, int C, int OutH, int OutW,
+    int KH, int KW, int StrideH, int PadH, int PadW,
+    bool apply_relu);
+
+void add_arrays_simd(const float a[], const float b[], float result[], int size);
+
+#endif // XCEPTION_SIMD_H
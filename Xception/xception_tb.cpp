@@ -1,12 +1,104 @@
 #include <iostream>
+#include <cstdio>  // For printf and std::remove
 #include <vector>
 #include <cmath>
 #include <algorithm>
 #include <iterator>
 
 #include "xception.h"            // Includes params, weights, prototypes
+#include "xception_half.h"       // FP16 / BF16 precision modes
+#include "xception_precision.h"  // Per-layer precision policies
+#include "xception_fixed_point.h" // ap_fixed network
+#include "xception_calibration.h" // Activation ranges (fixed-point check)
+#include "xception_weight_store.h" // Pre-packed weight cache
 #include "./Test/input_image_xception.h" // Includes the sample input image data
 
+// Largest logit error a 16-bit path may show against fp32, as a fraction of
+// the largest |fp32 logit|
+#define TOLERANCE_FP16 0.002f
+#define TOLERANCE_BF16 0.02f
+#define TOLERANCE_FIXED 0.1f // ap_fixed<16,6> (steps of 2^-10)
+
+//--------------------------------------------------------------------------
+// Synthetic Weights
+//--------------------------------------------------------------------------
+// The shipped xception_weights.cpp holds all-zero placeholders, under which
+// every path returns all-zero logits and no check below can fail. The
+// testbench then loads seeded weights instead: uniform in +-sqrt(4.5 / fan-in)
+// (a depthwise filter's fan-in is its 3x3 window) with biases in +-0.01,
+// from a fixed xorshift sequence, so every run sees the same ones. That is
+// 3/4 of He scaling: the eight middle-flow passes share one block's weights,
+// and under full He scaling they grow the maps past ap_fixed<16,6>'s +-32;
+// here every map stays within about +-10. Entry blocks 2 and 3 are not run
+// by Xception() and stay zero.
+static unsigned synthetic_state = 1234;
+
+static float synthetic_uniform(float limit) {
+    synthetic_state ^= synthetic_state << 13;
+    synthetic_state ^= synthetic_state >> 17;
+    synthetic_state ^= synthetic_state << 5;
+    return limit * ((synthetic_state >> 8) * (2.0f / 16777216.0f) - 1.0f);
+}
+
+static void synthetic_layer(float weights[], float biases[], int OutC, int fan_in) {
+    const float limit = std::sqrt(4.5f / fan_in);
+    for (int i = 0; i < OutC * fan_in; ++i) weights[i] = synthetic_uniform(limit);
+    for (int i = 0; i < OutC; ++i) biases[i] = synthetic_uniform(0.01f);
+}
+
+static void synthetic_separable(float dw_weights[], float pw_weights[], float pw_biases[], int InC, int OutC) {
+    const float limit = std::sqrt(4.5f / 9);
+    for (int i = 0; i < InC * 3 * 3; ++i) dw_weights[i] = synthetic_uniform(limit);
+    synthetic_layer(pw_weights, pw_biases, OutC, InC);
+}
+
+static void load_synthetic_weights() {
+    synthetic_layer(entry_conv1_weights, entry_conv1_biases, CONV1_C_OUT, CONV1_C * 3 * 3);
+    synthetic_layer(entry_conv2_weights, entry_conv2_biases, CONV2_C_OUT, CONV2_C * 3 * 3);
+    synthetic_layer(entry_b1_res_conv_weights, entry_b1_res_conv_biases, B1_SEP2_C_OUT, CONV2_C_OUT);
+    synthetic_separable(entry_b1_sep1_dw_weights, entry_b1_sep1_pw_weights, entry_b1_sep1_pw_biases,
+                        CONV2_C_OUT, B1_SEP1_C_OUT);
+    synthetic_separable(entry_b1_sep2_dw_weights, entry_b1_sep2_pw_weights, entry_b1_sep2_pw_biases,
+                        B1_SEP1_C_OUT, B1_SEP2_C_OUT);
+    synthetic_separable(middle_b4_sep1_dw_weights, middle_b4_sep1_pw_weights, middle_b4_sep1_pw_biases,
+                        MIDDLE_C, MIDDLE_C);
+    synthetic_separable(middle_b4_sep2_dw_weights, middle_b4_sep2_pw_weights, middle_b4_sep2_pw_biases,
+                        MIDDLE_C, MIDDLE_C);
+    synthetic_separable(middle_b4_sep3_dw_weights, middle_b4_sep3_pw_weights, middle_b4_sep3_pw_biases,
+                        MIDDLE_C, MIDDLE_C);
+    synthetic_layer(exit_b12_res_conv_weights, exit_b12_res_conv_biases, B5_SEP2_C_OUT, MIDDLE_C);
+    synthetic_separable(exit_b12_sep1_dw_weights, exit_b12_sep1_pw_weights, exit_b12_sep1_pw_biases,
+                        MIDDLE_C, B5_SEP1_C_OUT);
+    synthetic_separable(exit_b12_sep2_dw_weights, exit_b12_sep2_pw_weights, exit_b12_sep2_pw_biases,
+                        B5_SEP1_C_OUT, B5_SEP2_C_OUT);
+    synthetic_separable(exit_b13_sep1_dw_weights, exit_b13_sep1_pw_weights, exit_b13_sep1_pw_biases,
+                        B5_SEP2_C_OUT, B6_SEP1_C_OUT);
+    synthetic_separable(exit_b13_sep2_dw_weights, exit_b13_sep2_pw_weights, exit_b13_sep2_pw_biases,
+                        B6_SEP1_C_OUT, B6_SEP2_C_OUT);
+    synthetic_layer(final_conv_weights, final_conv_biases, NUM_CLASSES, GAP_OUT_SIZE);
+}
+
+// One failed check when a path's class differs from fp32's or its largest
+// logit error exceeds `limit`
+static int check_path(const char* path, bool class_matches, float error, float limit) {
+    if (class_matches && error <= limit) {
+        return 0;
+    }
+    std::cout << "ERROR: " << path << ": " << (class_matches ? "" : "class differs from fp32, ")
+              << "max logit error " << error << " (limit " << limit << ")" << std::endl;
+    return 1;
+}
+
+// Tolerance of a policy: that of its coarsest format
+static float policy_tolerance(const PrecisionPolicy& policy) {
+    float tolerance = 0.0f;
+    for (int l = 0; l < POLICY_NUM_LAYERS; ++l) {
+        if (policy.layer[l] == LAYER_BF16) tolerance = std::max(tolerance, TOLERANCE_BF16);
+        if (policy.layer[l] == LAYER_FP16) tolerance = std::max(tolerance, TOLERANCE_FP16);
+    }
+    return tolerance;
+}
+
 int main() {
     std::cout << "--- Xception HLS Testbench ---" << std::endl;
 
@@ -18,6 +110,16 @@ int main() {
     std::cout << "Input image dimensions: " << INPUT_H << "x" << INPUT_W << "x" << INPUT_C << std::endl;
     std::cout << "Network output classes: " << NUM_CLASSES << std::endl;
 
+    bool placeholder = std::all_of(entry_conv1_weights, entry_conv1_weights + CONV1_C_OUT * CONV1_C * 3 * 3,
+                                   [](float w) { return w == 0.0f; }) &&
+                       std::all_of(final_conv_weights, final_conv_weights + NUM_CLASSES * GAP_OUT_SIZE,
+                                   [](float w) { return w == 0.0f; });
+    if (placeholder) {
+        std::cout << "Placeholder (all-zero) weights: running on seeded synthetic weights" << std::endl;
+        load_synthetic_weights();
+    }
+    int failures = 0; // Checks failed below
+
     // --- Execute the Xception Model ---
     std::cout << "Running Xception inference..." << std::endl;
     Xception(input_image_data, output_logits);
@@ -41,9 +143,139 @@ int main() {
     std::cout << "\nPredicted Class (Max Logit Index): " << predicted_class << std::endl;
     std::cout << "Logit value: " << *max_logit_ptr << std::endl;
 
+    // Tolerances below are relative to the largest |fp32 logit|
+    float logit_scale = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        logit_scale = std::max(logit_scale, std::fabs(output_logits[i]));
+    }
+
+    // --- 16-Bit Storage Paths ---
+    // Rerun with fp16 and bf16 weights and activations and check that each
+    // predicts the same class as the float network, within its tolerance.
+    // A second call must repeat the logits exactly: no layer may read
+    // anything the previous call left in the context.
+    const InferencePrecision half_modes[] = {PRECISION_FP16, PRECISION_BF16};
+    const char* half_names[] = {"FP16", "BF16"};
+    const float half_tolerances[] = {TOLERANCE_FP16, TOLERANCE_BF16};
+    std::cout << std::endl;
+    for (int m = 0; m < 2; ++m) {
+        set_inference_precision(half_modes[m]);
+        float half_logits[NUM_CLASSES], repeat_logits[NUM_CLASSES];
+        Xception(input_image_data, half_logits);
+        Xception(input_image_data, repeat_logits);
+        if (!std::equal(half_logits, half_logits + NUM_CLASSES, repeat_logits)) {
+            std::cout << "ERROR: " << half_names[m] << ": a second call changed the logits" << std::endl;
+            ++failures;
+        }
+        int half_class = std::distance(half_logits, std::max_element(half_logits, half_logits + NUM_CLASSES));
+        float half_error = 0.0f;
+        for (int i = 0; i < NUM_CLASSES; ++i) {
+            half_error = std::max(half_error, std::fabs(half_logits[i] - output_logits[i]));
+        }
+        std::cout << half_names[m] << " Predicted Class: " << half_class
+                  << (half_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+                  << ", max logit error " << half_error << std::endl;
+        failures += check_path(half_names[m], half_class == predicted_class, half_error,
+                               half_tolerances[m] * logit_scale);
+    }
+    set_inference_precision(PRECISION_FP32);
+
+    // --- Mixed-Precision Policy ---
+    // Keep conv1 and the classifier in fp32 and run the rest at fp16, then
+    // sweep the candidate policies on the sample image for the fastest one
+    // that keeps the fp32 class. Every policy must keep the class and stay
+    // within the tolerance of its coarsest format.
+    PrecisionPolicy policy = uniform_precision_policy(LAYER_FP16);
+    policy.layer[POLICY_CONV1] = LAYER_FP32;
+    policy.layer[POLICY_CLASSIFIER] = LAYER_FP32;
+    set_precision_policy(policy);
+    float mixed_logits[NUM_CLASSES];
+    Xception(input_image_data, mixed_logits);
+    set_precision_policy(uniform_precision_policy(LAYER_FP32));
+    int mixed_class = std::distance(mixed_logits, std::max_element(mixed_logits, mixed_logits + NUM_CLASSES));
+    float mixed_error = 0.0f;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        mixed_error = std::max(mixed_error, std::fabs(mixed_logits[i] - output_logits[i]));
+    }
+    std::cout << "Mixed-Precision Predicted Class: " << mixed_class
+              << (mixed_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+              << ", max logit error " << mixed_error << std::endl;
+    failures += check_path("Mixed-Precision", mixed_class == predicted_class, mixed_error,
+                           policy_tolerance(policy) * logit_scale);
+
+    PrecisionPolicy candidates[PRECISION_MAX_CANDIDATES];
+    PrecisionSweepResult sweep[PRECISION_MAX_CANDIDATES];
+    int candidate_count = precision_policy_candidates(candidates);
+    int fastest = xception_precision_sweep(1, input_image_data, NULL, candidates, candidate_count, 0.0, sweep);
+    char policy_label[256];
+    std::cout << "Precision sweep (ms/image, max logit error vs fp32, policy):" << std::endl;
+    for (int i = 0; i < candidate_count; ++i) {
+        precision_policy_label(sweep[i].policy, policy_label, sizeof(policy_label));
+        printf("  %9.3f  %12.6g  %s\n", sweep[i].ms_per_image, sweep[i].max_logit_error, policy_label);
+        failures += check_path(policy_label, sweep[i].top1 == 1.0, (float)sweep[i].max_logit_error,
+                               policy_tolerance(sweep[i].policy) * logit_scale);
+    }
+    if (fastest < 0) {
+        std::cout << "ERROR: no policy keeps the fp32 class" << std::endl;
+        ++failures;
+    } else {
+        precision_policy_label(sweep[fastest].policy, policy_label, sizeof(policy_label));
+        std::cout << "Fastest policy keeping the fp32 class: " << policy_label << " ("
+                  << sweep[fastest].ms_per_image << " ms vs " << sweep[0].ms_per_image << " ms at fp32"
+                  << ", max logit error " << sweep[fastest].max_logit_error << ")" << std::endl;
+    }
+
+    // --- Fixed-Point Path ---
+    // Check the sample image's calibrated activation ranges against
+    // ap_fixed<16,6>, round the image and weights to it, run the fixed-point
+    // top and check that it predicts the same class as the float network,
+    // within TOLERANCE_FIXED
+    const char* fixed_scale_path = "xception_tb_scales.txt";
+    float calibration_logits[NUM_CLASSES];
+    calibration_begin();
+    Xception(input_image_data, calibration_logits);
+    calibration_end();
+    int saturating = calibration_write(fixed_scale_path) ? xception_fixed_point_check_ranges(fixed_scale_path) : -1;
+    std::remove(fixed_scale_path);
+    if (saturating < 0) {
+        std::cout << "ERROR: Fixed-Point: could not write or read " << fixed_scale_path << std::endl;
+        ++failures;
+    } else if (saturating > 0) {
+        std::cout << "ERROR: Fixed-Point: " << saturating << " layer ranges saturate ap_fixed<16,6>" << std::endl;
+        ++failures;
+    }
+    static fixed_data_t fixed_image[INPUT_H * INPUT_W * INPUT_C];
+    static fixed_data_t fixed_weights[XCEPTION_FIXED_POINT_WEIGHTS];
+    fixed_data_t fixed_logits[NUM_CLASSES];
+    for (int i = 0; i < INPUT_H * INPUT_W * INPUT_C; ++i) fixed_image[i] = fixed_data_t(input_image_data[i]);
+    xception_fixed_point_weights(fixed_weights);
+    XceptionFixedPoint(fixed_image, fixed_weights, fixed_logits);
+    float fixed_error = 0.0f;
+    int fixed_class = 0;
+    for (int i = 0; i < NUM_CLASSES; ++i) {
+        fixed_error = std::max(fixed_error, std::fabs(fixed_logits[i].to_float() - output_logits[i]));
+        if (fixed_logits[i] > fixed_logits[fixed_class]) fixed_class = i;
+    }
+    std::cout << "Fixed-Point Predicted Class: " << fixed_class
+              << (fixed_class == predicted_class ? " (matches fp32)" : " (MISMATCH with fp32)")
+              << ", max logit error " << fixed_error << std::endl;
+    failures += check_path("Fixed-Point", fixed_class == predicted_class, fixed_error, TOLERANCE_FIXED * logit_scale);
+
+    // --- Weight Store ---
+    // Every path above packs the same weight arrays, so the store must hold them all
+    int store_overflows = weight_store_overflows();
+    if (store_overflows > 0) {
+        std::cout << "ERROR: the weight store was full for " << store_overflows << " lookups" << std::endl;
+        ++failures;
+    }
+
     // --- Verification (Optional) ---
     // Compare output_logits against golden reference data if available.
 
+    if (failures > 0) {
+        std::cout << "--- Testbench FAILED (" << failures << " checks) ---" << std::endl;
+        return 1;
+    }
     std::cout << "--- Testbench Finished ---" << std::endl;
     return 0; // Return 0 for success
 }
\ No newline at end of file
@@ -0,0 +1,329 @@
+#ifndef XCEPTION_TYPED_H
+#define XCEPTION_TYPED_H
+
+#include "xception.h"
+#include "xception_types.h"
+
+// ==========================================================================
+// === Datatype-Templated Layers ============================================
+// ==========================================================================
+// The direct loop nests of the layers, templated on the data type T (maps,
+// weights, biases) and the accumulator type Acc (see xception_types.h).
+// Products are added to an Acc sum that starts at the bias, and each output
+// is converted to T once, after the ReLU.
+//
+// The float layers in xception.h are these templates at <float, float>:
+// they try the host backends (GEMM, SIMD) first and fall back to the loops
+// here, which is all the HLS design runs. A call without template arguments
+// on float data picks the float layer; convolution<T, Acc>(...) always runs
+// the loops. The fixed-point network (xception_fixed_point.h) instantiates
+// them with ap_fixed.
+// ==========================================================================
+
+//--------------------------------------------------------------------------
+// Per-Pixel Window Kernels (Same as SqueezeNet)
+//--------------------------------------------------------------------------
+// One output pixel of a convolution; (ih0, iw0) is the top-left input tap.
+// Border=false is only used where the whole window lies inside the input,
+// so its bounds checks compile away.
+template <bool Border, class T, class Acc = T>
+inline T conv_pixel(
+    const T input[], const T weights[], T bias,
+    int InH, int InW, int InC, int KH, int KW,
+    int oc, int ih0, int iw0, bool apply_relu)
+{
+#pragma HLS INLINE
+    Acc sum = bias;
+    IN_C_LOOP: for (int ic = 0; ic < InC; ++ic) {
+        KERNEL_H_LOOP: for (int kh = 0; kh < KH; ++kh) {
+            KERNEL_W_LOOP: for (int kw = 0; kw < KW; ++kw) {
+                int ih = ih0 + kh;
+                int iw = iw0 + kw;
+
+                // Check bounds (for padding)
+                if (!Border || (ih >= 0 && ih < InH && iw >= 0 && iw < InW)) {
+                    int input_idx = ic * InH * InW + ih * InW + iw;
+                    int weight_idx = oc * (InC * KH * KW) + ic * (KH * KW) + kh * KW + kw;
+                    sum += input[input_idx] * weights[weight_idx];
+                }
+            }
+        }
+    }
+    return T(apply_relu ? relu_activation(sum) : sum);
+}
+
+// One output pixel of max_pooling(); only Border=true checks for windows
+// clipped at the bottom/right edge
+template <bool Border, class T>
+inline T pool_pixel(
+    const T input[], int InH, int InW, int KH, int KW, int ih0, int iw0)
+{
+#pragma HLS INLINE
+    T max_val = LayerTraits<T>::lowest();
+    POOL_KH_LOOP: for (int kh = 0; kh < KH; ++kh) {
+        POOL_KW_LOOP: for (int kw = 0; kw < KW; ++kw) {
+            int ih = ih0 + kh;
+            int iw = iw0 + kw;
+            if (!Border || (ih < InH && iw < InW)) {
+                int input_idx = ih * InW + iw;
+                if (input[input_idx] > max_val) {
+                    max_val = input[input_idx];
+                }
+            }
+        }
+    }
+    return max_val;
+}
+
+// Horizontal 3-tap max starting at column iw0 of one row; only Border=true
+// checks for a window clipped at the right edge
+template <bool Border, class T>
+inline T pool_hmax3(const T row[], int W, int iw0) {
+#pragma HLS INLINE
+    T max_val = (!Border || iw0 < W) ? row[iw0] : LayerTraits<T>::lowest();
+    if ((!Border || iw0 + 1 < W) && row[iw0 + 1] > max_val) max_val = row[iw0 + 1];
+    if ((!Border || iw0 + 2 < W) && row[iw0 + 2] > max_val) max_val = row[iw0 + 2];
+    return max_val;
+}
+
+// One output pixel of max_pool_3x3s2(): the three window rows (`rows` of
+// them exist) go through pool_hmax3(). The top row's maximum is the bottom
+// row's of the output above, so it comes from `carry` (except on the first
+// output row) and the bottom row's maximum is left there for the next one.
+template <bool Border, class T>
+inline T pool3s2_pixel(
+    const T row0[], int rows, int W, int ow, bool first, T& carry)
+{
+#pragma HLS INLINE
+    const int iw0 = ow * 2;
+    T max_val = first ? pool_hmax3<Border>(row0, W, iw0) : carry;
+    if (rows > 1) {
+        T m1 = pool_hmax3<Border>(row0 + W, W, iw0);
+        if (m1 > max_val) max_val = m1;
+    }
+    if (rows > 2) {
+        T m2 = pool_hmax3<Border>(row0 + 2 * W, W, iw0);
+        if (m2 > max_val) max_val = m2;
+        carry = m2;
+    }
+    return max_val;
+}
+
+// 3x3/stride-2 max pooling of one channel (rows x W, no padding) into n_out
+// rows of OutW (<= POOL_MAX_W_OUT). Separable: every input row's horizontal
+// maxima are computed once, and the row shared by vertically neighbouring
+// windows is carried in row_carry instead of being scanned twice.
+template <class T>
+void max_pool_3x3s2(
+    const T in_c[], int rows, int W, T out_c[], int n_out, int OutW)
+{
+    T row_carry[POOL_MAX_W_OUT];
+    const int ow_hi = window_interior_end(W, OutW, 3, 2, 0);
+
+    POOL3S2_OH_LOOP: for (int oh = 0; oh < n_out; ++oh) {
+        const T* row0 = in_c + oh * 2 * W;
+        const int oh_rows = rows - oh * 2;
+        T* out_row = out_c + oh * OutW;
+        if (oh_rows <= 0) {
+            POOL3S2_EMPTY_LOOP: for (int ow = 0; ow < OutW; ++ow) {
+                out_row[ow] = LayerTraits<T>::lowest();
+            }
+            continue;
+        }
+
+        POOL3S2_OW_INTERIOR_LOOP: for (int ow = 0; ow < ow_hi; ++ow) {
+#pragma HLS PIPELINE II=1
+            out_row[ow] = pool3s2_pixel<false>(row0, oh_rows, W, ow, oh == 0, row_carry[ow]);
+        }
+        POOL3S2_OW_BORDER_LOOP: for (int ow = ow_hi; ow < OutW; ++ow) {
+#pragma HLS PIPELINE II=1
+            out_row[ow] = pool3s2_pixel<true>(row0, oh_rows, W, ow, oh == 0, row_carry[ow]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Standard Convolution
+//--------------------------------------------------------------------------
+template <class T, class Acc = T>
+void convolution(
+    const T input[], const T weights[], const T biases[], T output[],
+    int InH, int InW, int InC, int OutH, int OutW, int OutC,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu)
+{
+    const int oh_lo = window_interior_begin(OutH, StrideH, PadH);
+    const int oh_hi = window_interior_end(InH, OutH, KH, StrideH, PadH);
+    const int ow_lo = window_interior_begin(OutW, StrideW, PadW);
+    const int ow_hi = window_interior_end(InW, OutW, KW, StrideW, PadW);
+
+    // Output Feature Map (OFM) Loops; only the border columns/rows check bounds
+    OUT_C_LOOP: for (int oc = 0; oc < OutC; ++oc) {
+        T bias = biases ? biases[oc] : T(0); // Initialize with bias if provided
+        OUT_H_LOOP: for (int oh = 0; oh < OutH; ++oh) {
+            bool interior_row = (oh >= oh_lo && oh < oh_hi);
+            int w_lo = interior_row ? ow_lo : OutW;
+            int w_hi = interior_row ? ow_hi : OutW;
+            T* out_row = output + oc * OutH * OutW + oh * OutW;
+            int ih0 = oh * StrideH - PadH;
+
+            OUT_W_BORDER_L_LOOP: for (int ow = 0; ow < w_lo; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<true, T, Acc>(input, weights, bias, InH, InW, InC, KH, KW,
+                                                       oc, ih0, ow * StrideW - PadW, apply_relu);
+            }
+            OUT_W_INTERIOR_LOOP: for (int ow = w_lo; ow < w_hi; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<false, T, Acc>(input, weights, bias, InH, InW, InC, KH, KW,
+                                                        oc, ih0, ow * StrideW - PadW, apply_relu);
+            }
+            OUT_W_BORDER_R_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<true, T, Acc>(input, weights, bias, InH, InW, InC, KH, KW,
+                                                       oc, ih0, ow * StrideW - PadW, apply_relu);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Depthwise Convolution
+//--------------------------------------------------------------------------
+template <class T, class Acc = T>
+void depthwise_convolution(
+    const T input[], const T weights[], const T biases[], T output[],
+    int InH, int InW, int C, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW, int PadH, int PadW, bool apply_relu)
+{
+    const int oh_lo = window_interior_begin(OutH, StrideH, PadH);
+    const int oh_hi = window_interior_end(InH, OutH, KH, StrideH, PadH);
+    const int ow_lo = window_interior_begin(OutW, StrideW, PadW);
+    const int ow_hi = window_interior_end(InW, OutW, KW, StrideW, PadW);
+
+    // A depthwise channel is a 1-input-channel convolution: weights are
+    // [C, 1, KH, KW], so conv_pixel() with InC = 1 on the channel's plane
+    DW_C_LOOP: for (int c = 0; c < C; ++c) { // Loop over channels (input and output)
+        const T* in_c = input + c * InH * InW;
+        T bias = biases ? biases[c] : T(0); // Use bias for this channel if provided
+        DW_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
+            bool interior_row = (oh >= oh_lo && oh < oh_hi);
+            int w_lo = interior_row ? ow_lo : OutW;
+            int w_hi = interior_row ? ow_hi : OutW;
+            T* out_row = output + c * OutH * OutW + oh * OutW;
+            int ih0 = oh * StrideH - PadH;
+
+            DW_OW_BORDER_L_LOOP: for (int ow = 0; ow < w_lo; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<true, T, Acc>(in_c, weights, bias, InH, InW, 1, KH, KW,
+                                                       c, ih0, ow * StrideW - PadW, apply_relu);
+            }
+            DW_OW_INTERIOR_LOOP: for (int ow = w_lo; ow < w_hi; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<false, T, Acc>(in_c, weights, bias, InH, InW, 1, KH, KW,
+                                                        c, ih0, ow * StrideW - PadW, apply_relu);
+            }
+            DW_OW_BORDER_R_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = conv_pixel<true, T, Acc>(in_c, weights, bias, InH, InW, 1, KH, KW,
+                                                       c, ih0, ow * StrideW - PadW, apply_relu);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Separable Convolution Block (Depthwise -> Pointwise)
+//--------------------------------------------------------------------------
+template <class T, class Acc = T>
+void separable_conv_block(
+    const T input[], T output[],
+    int InH, int InW, int InC,
+    int OutH_DW, int OutW_DW,
+    int OutH_PW, int OutW_PW, int OutC,
+    int DW_KH, int DW_KW, int DW_StrideH, int DW_StrideW, int DW_PadH, int DW_PadW,
+    const T dw_weights[], const T dw_biases[], bool apply_relu_dw,
+    const T pw_weights[], const T pw_biases[], bool apply_relu_pw,
+    T dw_buffer[])
+{
+    depthwise_convolution<T, Acc>(input, dw_weights, dw_biases, dw_buffer,
+                                  InH, InW, InC, OutH_DW, OutW_DW,
+                                  DW_KH, DW_KW, DW_StrideH, DW_StrideW, DW_PadH, DW_PadW,
+                                  apply_relu_dw);
+    convolution<T, Acc>(dw_buffer, pw_weights, pw_biases, output,
+                        OutH_DW, OutW_DW, InC, OutH_PW, OutW_PW, OutC,
+                        1, 1, 1, 1, 0, 0, apply_relu_pw);
+}
+
+//--------------------------------------------------------------------------
+// Max Pooling
+//--------------------------------------------------------------------------
+template <class T>
+void max_pooling(
+    const T input[], T output[],
+    int InH, int InW, int InC, int OutH, int OutW,
+    int KH, int KW, int StrideH, int StrideW)
+{
+    if (KH == 3 && KW == 3 && StrideH == 2 && StrideW == 2 && OutW <= POOL_MAX_W_OUT) {
+        POOL3S2_C_LOOP: for (int c = 0; c < InC; ++c) {
+            max_pool_3x3s2(input + c * InH * InW, InH, InW, output + c * OutH * OutW, OutH, OutW);
+        }
+        return;
+    }
+
+    // No padding, so only the last rows/cols can have clipped windows
+    const int oh_hi = window_interior_end(InH, OutH, KH, StrideH, 0);
+    const int ow_hi = window_interior_end(InW, OutW, KW, StrideW, 0);
+
+    POOL_C_LOOP: for (int c = 0; c < InC; ++c) {
+        const T* in_c = input + c * InH * InW;
+        POOL_OH_LOOP: for (int oh = 0; oh < OutH; ++oh) {
+            int w_hi = (oh < oh_hi) ? ow_hi : 0;
+            T* out_row = output + c * OutH * OutW + oh * OutW;
+
+            POOL_OW_INTERIOR_LOOP: for (int ow = 0; ow < w_hi; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = pool_pixel<false>(in_c, InH, InW, KH, KW, oh * StrideH, ow * StrideW);
+            }
+            POOL_OW_BORDER_LOOP: for (int ow = w_hi; ow < OutW; ++ow) {
+#pragma HLS PIPELINE II=1
+                out_row[ow] = pool_pixel<true>(in_c, InH, InW, KH, KW, oh * StrideH, ow * StrideW);
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+// Global Average Pooling
+//--------------------------------------------------------------------------
+template <class T, class Acc = T>
+void global_average_pooling(
+    const T input[], T output[], int InH, int InW, int InC)
+{
+    const typename LayerTraits<Acc>::mean_scale_t scale = LayerTraits<Acc>::mean_scale(InH * InW);
+
+    GAP_C_LOOP: for (int c = 0; c < InC; ++c) {
+#pragma HLS PIPELINE II=1
+        Acc sum = 0;
+        GAP_H_LOOP: for (int h = 0; h < InH; ++h) {
+            GAP_W_LOOP: for (int w = 0; w < InW; ++w) {
+                int input_idx = c * InH * InW + h * InW + w;
+                sum += input[input_idx];
+            }
+        }
+        output[c] = T(LayerTraits<Acc>::mean(sum, scale));
+    }
+}
+
+//--------------------------------------------------------------------------
+// Element-wise Addition (For Residual Connections)
+//--------------------------------------------------------------------------
+// result may alias a or b
+template <class T>
+void add_arrays(const T a[], const T b[], T result[], int size) {
+#pragma HLS INLINE
+    ADD_LOOP: for (int i = 0; i < size; ++i) {
+#pragma HLS PIPELINE II=1
+        result[i] = T(a[i] + b[i]);
+    }
+}
+
+#endif // XCEPTION_TYPED_H
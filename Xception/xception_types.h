@@ -0,0 +1,70 @@
+#ifndef XCEPTION_TYPES_H
+#define XCEPTION_TYPES_H
+
+#include <cfloat> // For FLT_MAX
+#include <cmath>  // For ldexp
+#include "xception_params.h"
+
+// ==========================================================================
+// === Layer Data Types =====================================================
+// ==========================================================================
+// The datatype-templated layers (xception_typed.h) take a data type T for
+// maps, weights and biases and an accumulator type Acc for the sums. float
+// is the reference instantiation. The FPGA build wants Vitis HLS ap_fixed:
+// a 16-bit fixed-point MAC is one DSP48 and no LUT-heavy float adder, so
+// several conv engines fit where one float engine did. Without the Vitis
+// headers (a plain g++ build) ap_fixed comes from the software stand-in in
+// xception_ap_fixed.h, which gives the same bits, so C simulation of the
+// fixed-point network is bit-accurate either way.
+// ==========================================================================
+
+#if defined(__has_include)
+#if __has_include(<ap_fixed.h>)
+#define XCEPTION_HAVE_AP_FIXED
+#endif
+#endif
+
+#ifdef XCEPTION_HAVE_AP_FIXED
+#include <ap_fixed.h>
+#else
+#include "xception_ap_fixed.h"
+#endif
+
+// Fixed-point network types (widths from xception_params.h). Stored data
+// rounds to nearest and saturates; the accumulator neither rounds nor
+// saturates (wrap is free in hardware, and its width leaves the headroom).
+typedef ap_fixed<FIXED_DATA_W, FIXED_DATA_I, AP_RND, AP_SAT> fixed_data_t;
+typedef ap_fixed<FIXED_ACC_W, FIXED_ACC_I> fixed_acc_t;
+
+// ReLU for any layer type (relu_activation(float) is the float overload)
+template<class T>
+inline T relu_activation(T x) {
+#pragma HLS INLINE
+    return (x < T(0)) ? T(0) : x;
+}
+
+// Per-type constants and the GAP division. float keeps the exact float
+// operations of the original layers; ap_fixed multiplies by a rounded
+// reciprocal instead of dividing (a constant after HLS inlines the layer).
+template<class T> struct LayerTraits;
+
+template<>
+struct LayerTraits<float> {
+    typedef float mean_scale_t;
+    static float lowest() { return -FLT_MAX; }
+    static float to_float(float x) { return x; }
+    static mean_scale_t mean_scale(int count) { return (float)count; }
+    static float mean(float sum, mean_scale_t scale) { return sum / scale; }
+};
+
+template<int W, int I, ap_q_mode Q, ap_o_mode O, int N>
+struct LayerTraits<ap_fixed<W, I, Q, O, N> > {
+    typedef ap_fixed<W, I, Q, O, N> T;
+    typedef ap_fixed<25, 2> mean_scale_t; // 1/count to 2^-23, a DSP48 operand
+    static T lowest() { return T(-std::ldexp(1.0, I - 1)); }
+    static float to_float(T x) { return x.to_float(); }
+    static mean_scale_t mean_scale(int count) { return mean_scale_t(1.0 / count); }
+    static T mean(T sum, mean_scale_t scale) { return T(sum * scale); }
+};
+
+#endif // XCEPTION_TYPES_H
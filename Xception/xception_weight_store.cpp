@@ -0,0 +1,162 @@
+#include "xception_weight_store.h"
+
+#ifndef __SYNTHESIS__ // Host-side only; HLS reads the weight arrays directly
+
+#include <algorithm> // For std::min
+#include <cstdio>    // For the overflow report
+#include <mutex>     // For std::mutex
+#include <vector>    // For the fp32 staging panel
+
+// One packed layer, keyed by its weight array
+struct PackedLayer {
+    const float* weights;  // Original (M, K) row-major weights
+    const float* panels;   // Packed MR-row panels (see header)
+    int M, K;
+};
+
+// One 16-bit copy of a layer, keyed by its weight array
+struct HalfLayer {
+    const float* weights;
+    const uint16_t* panels; // Full-K MR-row panels (see header)
+    int M, K;
+};
+
+static bool store_enabled = true;
+static PackedLayer layers[WEIGHT_STORE_MAX_LAYERS];
+static int num_layers = 0;
+static float panel_pool[WEIGHT_STORE_POOL_SIZE];
+static int panel_pool_used = 0;
+static HalfLayer half_layers[WEIGHT_STORE_MAX_LAYERS];
+static int num_half_layers = 0;
+static HalfFormat half_format = HALF_FP16; // Format of every 16-bit layer held
+static uint16_t half_pool[WEIGHT_STORE_POOL_SIZE];
+static int half_pool_used = 0;
+// Lookups and insertions are serialized so inference threads can share the
+// store; a hit returns a pointer into a pool that is never repacked.
+static std::mutex store_mutex;
+// Lookups turned away since the last clear. The pools are sized for every
+// layer of the network, so any overflow is a sizing bug (or weights that are
+// not the network's arrays) and costs a repack on every call.
+static int overflows = 0;
+
+void set_weight_store_enabled(bool enabled) {
+    store_enabled = enabled;
+}
+
+int weight_store_overflows() {
+    std::lock_guard<std::mutex> lock(store_mutex);
+    return overflows;
+}
+
+void weight_store_clear() {
+    std::lock_guard<std::mutex> lock(store_mutex);
+    overflows = 0;
+    num_layers = 0;
+    panel_pool_used = 0;
+    num_half_layers = 0;
+    half_pool_used = 0;
+}
+
+// Called with store_mutex held; the first overflow is reported on stderr
+static void report_overflow(const char* pool, int M, int K) {
+    if (overflows++ == 0) {
+        fprintf(stderr, "weight store: %s full, the (%d x %d) layer is repacked on every call\n",
+                pool, M, K);
+    }
+}
+
+static void pack_panels(const float weights[], int M, int K, float dst[]) {
+    const int Mpad = WEIGHT_STORE_PANELS(M, 1);
+    for (int pc = 0; pc < K; pc += SGEMM_KC) {
+        int kc = std::min(SGEMM_KC, K - pc);
+        for (int ip = 0; ip < Mpad; ip += SGEMM_MR) {
+            for (int k = 0; k < kc; ++k) {
+                for (int i = 0; i < SGEMM_MR; ++i) {
+                    int row = ip + i;
+                    dst[i] = (row < M) ? weights[row * K + pc + k] : 0.0f;
+                }
+                dst += SGEMM_MR;
+            }
+        }
+    }
+}
+
+const float* weight_store_gemm_panels(const float weights[], int M, int K) {
+    if (!store_enabled) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(store_mutex);
+    for (int l = 0; l < num_layers; ++l) {
+        if (layers[l].weights == weights && layers[l].M == M && layers[l].K == K) {
+            return layers[l].panels;
+        }
+    }
+
+    int size = WEIGHT_STORE_PANELS(M, K);
+    if (num_layers == WEIGHT_STORE_MAX_LAYERS || panel_pool_used + size > WEIGHT_STORE_POOL_SIZE) {
+        report_overflow("panel pool", M, K);
+        return 0;
+    }
+    float* panels = panel_pool + panel_pool_used;
+    pack_panels(weights, M, K, panels);
+    panel_pool_used += size;
+
+    PackedLayer& layer = layers[num_layers++];
+    layer.weights = weights;
+    layer.panels = panels;
+    layer.M = M;
+    layer.K = K;
+    return panels;
+}
+
+// Each panel is gathered in fp32, then rounded with the active SIMD table
+void weight_store_pack_half(const float weights[], int M, int K, HalfFormat format, uint16_t dst[]) {
+    const SimdKernels& simd = simd_kernels();
+    std::vector<float> panel((size_t)SGEMM_MR * K);
+    for (int ip = 0; ip < M; ip += SGEMM_MR) {
+        for (int k = 0; k < K; ++k) {
+            for (int i = 0; i < SGEMM_MR; ++i) {
+                int row = ip + i;
+                panel[k * SGEMM_MR + i] = (row < M) ? weights[row * K + k] : 0.0f;
+            }
+        }
+        simd.float_to_half[format](SGEMM_MR * K, panel.data(), dst);
+        dst += SGEMM_MR * K;
+    }
+}
+
+const uint16_t* weight_store_half_panels(const float weights[], int M, int K, HalfFormat format) {
+    if (!store_enabled) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(store_mutex);
+    if (format != half_format) {
+        num_half_layers = 0;
+        half_pool_used = 0;
+        half_format = format;
+    }
+    for (int l = 0; l < num_half_layers; ++l) {
+        const HalfLayer& layer = half_layers[l];
+        if (layer.weights == weights && layer.M == M && layer.K == K) {
+            return layer.panels;
+        }
+    }
+
+    int size = WEIGHT_STORE_PANELS(M, K);
+    if (num_half_layers == WEIGHT_STORE_MAX_LAYERS || half_pool_used + size > WEIGHT_STORE_POOL_SIZE) {
+        report_overflow("16-bit pool", M, K);
+        return 0;
+    }
+    uint16_t* panels = half_pool + half_pool_used;
+    weight_store_pack_half(weights, M, K, format, panels);
+    half_pool_used += size;
+
+    HalfLayer& layer = half_layers[num_half_layers++];
+    layer.weights = weights;
+    layer.panels = panels;
+    layer.M = M;
+    layer.K = K;
+    return panels;
+}
+
+#endif // __SYNTHESIS__
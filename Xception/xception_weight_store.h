@@ -0,0 +1,71 @@
+#ifndef XCEPTION_WEIGHT_STORE_H
+#define XCEPTION_WEIGHT_STORE_H
+
+#include "xception_params.h"
+#include "xception_gemm.h"
+#include "xception_simd.h" // For HalfFormat
+
+// ==========================================================================
+// === Pre-Packed Weight Store (Host Builds Only) ===========================
+// ==========================================================================
+// The SGEMM backends used to re-pack each layer's (OutC, InC*KH*KW) weights
+// into MR-row panels on every call. The store packs each layer once, the
+// first time its weight array is seen, and hands the kernels the cached
+// panels from then on. Layout, for every KC-deep slice of the reduction:
+//   [MR-row panel p][k][i]   = weights[p*MR + i][pc + k]  (rows zero-padded)
+// Slice pc starts at offset pc * round_up(OutC, MR), and panel p of that
+// slice at (p * MR) * kc, so any MC x KC block the macro-kernel walks is
+// already contiguous. The panel shape only depends on SGEMM_MR/SGEMM_KC,
+// which are the same for every instruction set.
+//
+// The 16-bit storage path (xception_half.h) gets its own copy of each layer,
+// rounded to fp16 or bf16 and packed as MR-row panels over the whole
+// reduction ([MR-row panel p][k][i] = weights[p*MR + i][k], panel p at
+// (p * MR) * K), so a block of rows widens back to fp32 in one contiguous
+// pass and each tile's micro-kernel call covers its full K.
+// ==========================================================================
+
+#define WEIGHT_STORE_MAX_LAYERS 32
+
+// Floats needed for one packed (M x K) weight matrix
+#define WEIGHT_STORE_PANELS(M, K) ((((M) + SGEMM_MR - 1) / SGEMM_MR) * SGEMM_MR * (K))
+
+// Every conv / pointwise layer Xception() runs (the middle flow reuses one set)
+#define WEIGHT_STORE_POOL_SIZE ( \
+    WEIGHT_STORE_PANELS(CONV1_C_OUT, INPUT_C * 9) + \
+    WEIGHT_STORE_PANELS(CONV2_C_OUT, CONV1_C_OUT * 9) + \
+    WEIGHT_STORE_PANELS(B1_SEP2_C_OUT, CONV2_C_OUT) + \
+    WEIGHT_STORE_PANELS(B1_SEP1_C_OUT, CONV2_C_OUT) + \
+    WEIGHT_STORE_PANELS(B1_SEP2_C_OUT, B1_SEP1_C_OUT) + \
+    3 * WEIGHT_STORE_PANELS(MIDDLE_C, MIDDLE_C) + \
+    WEIGHT_STORE_PANELS(B5_SEP2_C_OUT, MIDDLE_C) + \
+    WEIGHT_STORE_PANELS(B5_SEP1_C_OUT, MIDDLE_C) + \
+    WEIGHT_STORE_PANELS(B5_SEP2_C_OUT, B5_SEP1_C_OUT) + \
+    WEIGHT_STORE_PANELS(B6_SEP1_C_OUT, B5_SEP2_C_OUT) + \
+    WEIGHT_STORE_PANELS(B6_SEP2_C_OUT, B6_SEP1_C_OUT) + \
+    WEIGHT_STORE_PANELS(NUM_CLASSES, GAP_OUT_SIZE))
+
+// Enable/disable the store (enabled by default; disabled = pack per call)
+void set_weight_store_enabled(bool enabled);
+
+// Packed MR-row panels for an (M x K) row-major weight matrix.
+// Returns NULL if the store is disabled or full; callers then pack per call.
+const float* weight_store_gemm_panels(const float weights[], int M, int K);
+
+// Full-K 16-bit MR-row panels for an (M x K) row-major weight matrix. The
+// store keeps one format at a time: asking for the other drops the 16-bit
+// layers, so switch formats only while no inference runs. Returns NULL if the
+// store is disabled or full; callers then pack per call.
+const uint16_t* weight_store_half_panels(const float weights[], int M, int K, HalfFormat format);
+
+// Pack full-K 16-bit panels into dst (WEIGHT_STORE_PANELS(M, K) values)
+void weight_store_pack_half(const float weights[], int M, int K, HalfFormat format, uint16_t dst[]);
+
+// Drop every cached layer (e.g. after the weight arrays were overwritten)
+void weight_store_clear();
+
+// Lookups turned away because the store was full, since the last clear. The
+// first one is reported on stderr; the testbench fails on any.
+int weight_store_overflows();
+
+#endif // XCEPTION_WEIGHT_STORE_H